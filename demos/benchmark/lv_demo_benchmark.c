@@ -48,6 +48,7 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 
+static void screen_init(void);
 static void load_scene(uint32_t scene);
 static void next_scene_timer_cb(lv_timer_t * timer);
 
@@ -435,14 +436,7 @@ void lv_demo_benchmark(void)
 {
     scene_act = 0;
 
-    lv_obj_t * scr = lv_screen_active();
-    lv_obj_remove_style_all(scr);
-    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
-    lv_obj_set_style_text_color(scr, lv_color_black(), 0);
-    lv_obj_set_style_bg_color(scr, lv_palette_lighten(LV_PALETTE_GREY, 4), 0);
-    lv_obj_set_style_pad_all(lv_screen_active(), 8, 0);
-    lv_obj_set_style_pad_top(lv_screen_active(), 48, 0);
-    lv_obj_set_style_pad_gap(lv_screen_active(), 8, 0);
+    screen_init();
 
     lv_obj_t * title = lv_label_create(lv_layer_top());
     lv_obj_set_style_bg_opa(title, LV_OPA_COVER, 0);
@@ -461,10 +455,44 @@ void lv_demo_benchmark(void)
 #endif
 }
 
+uint32_t lv_demo_benchmark_get_scene_count(void)
+{
+    uint32_t cnt = 0;
+    while(scenes[cnt].create_cb) cnt++;
+    return cnt;
+}
+
+const char * lv_demo_benchmark_get_scene_name(uint32_t scene)
+{
+    if(scene >= lv_demo_benchmark_get_scene_count()) return NULL;
+    return scenes[scene].name;
+}
+
+void lv_demo_benchmark_load_scene(uint32_t scene)
+{
+    if(scene >= lv_demo_benchmark_get_scene_count()) return;
+
+    scene_act = scene;
+    screen_init();
+    load_scene(scene);
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+static void screen_init(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_remove_style_all(scr);
+    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+    lv_obj_set_style_text_color(scr, lv_color_black(), 0);
+    lv_obj_set_style_bg_color(scr, lv_palette_lighten(LV_PALETTE_GREY, 4), 0);
+    lv_obj_set_style_pad_all(lv_screen_active(), 8, 0);
+    lv_obj_set_style_pad_top(lv_screen_active(), 48, 0);
+    lv_obj_set_style_pad_gap(lv_screen_active(), 8, 0);
+}
+
 static void load_scene(uint32_t scene)
 {
     lv_obj_t * scr = lv_screen_active();
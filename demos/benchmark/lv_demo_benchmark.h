@@ -50,6 +50,27 @@ extern "C" {
  */
 void lv_demo_benchmark(void);
 
+/**
+ * Get the number of benchmark scenes
+ * @return          the number of scenes
+ */
+uint32_t lv_demo_benchmark_get_scene_count(void);
+
+/**
+ * Get the name of a benchmark scene
+ * @param scene     index of the scene
+ * @return          the name of the scene or NULL if `scene` is out of range
+ */
+const char * lv_demo_benchmark_get_scene_name(uint32_t scene);
+
+/**
+ * Create a benchmark scene on the active screen without switching to the next scene automatically.
+ * Useful to drive the scenes from a custom runner, e.g. to render a fixed number of frames
+ * with a simulated tick and measure them in a reproducible way.
+ * @param scene     index of the scene
+ */
+void lv_demo_benchmark_load_scene(uint32_t scene);
+
 /**********************
  *      MACROS
  **********************/
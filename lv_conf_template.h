@@ -78,6 +78,20 @@
  *(Not so important, you can adjust it to modify default sizes and spaces)*/
 #define LV_DPI_DEF 130     /*[px/inch]*/
 
+/*Default max. number of invalidated areas stored by a display until the next refresh.
+ *The buffer of the areas grows dynamically up to this limit. If it's reached, the new areas are merged into the stored ones.
+ *Can be changed per display with `lv_display_set_inv_area_limit()`*/
+#define LV_DEF_INV_AREA_LIMIT 256
+
+/*Default cost of refreshing an area apart from drawing its pixels (e.g. walking the widgets, flushing).
+ *Two invalidated areas are joined if refreshing the joined area is cheaper.
+ *Can be changed per display with `lv_display_set_inv_area_overhead()`*/
+#define LV_DEF_INV_AREA_OVERHEAD 1024     /*[px]*/
+
+/*1: When a plain container with opaque background scrolls in DIRECT or TILED render mode
+ *copy the already rendered pixels to their new place and render only the newly exposed parts*/
+#define LV_REFR_SCROLL_BLIT 0
+
 /*=================
  * OPERATING SYSTEM
  *=================*/
@@ -113,6 +127,32 @@
 /*The target buffer size for simple layer chunks.*/
 #define LV_DRAW_LAYER_SIMPLE_BUF_SIZE    (24 * 1024)   /*[bytes]*/
 
+/* Allocate the draw tasks, their descriptors and the local texts of labels from a memory arena of each layer
+ * instead of allocating them one-by-one from the heap. The arena is reset when all draw tasks of the layer are finished.
+ * If the arena is full the heap is used. `lv_draw_arena_monitor()` tells the size needed to avoid the heap.
+ * 0: disable the arena*/
+#define LV_DRAW_LAYER_ARENA_SIZE    0   /*[bytes]*/
+
+/* Keep the buffers of the finished layers in a pool and reuse them for the next layers
+ * with the same color format instead of allocating a new buffer for each layer in each frame.
+ * The pool keeps at most this many bytes of idle buffers. The oldest buffers are freed first.
+ * 0: disable the pool*/
+#define LV_DRAW_LAYER_POOL_SIZE    0   /*[bytes]*/
+
+/* When an opaque fill or image task is added, drop the older, not yet rendered draw tasks it fully covers
+ * and clip the ones it covers on a full side. To let the culling see all the tasks,
+ * they are dispatched only when the layer is finished.
+ * The saved pixels are shown by the performance monitor and `lv_draw_cull_monitor()`.*/
+#define LV_DRAW_CULL_OCCLUDED_TASKS 0
+
+/* Count the added draw tasks and the pixels blended by each software draw unit.
+ * Read them with `lv_draw_task_monitor()` and `lv_draw_sw_blend_monitor()`.
+ * It adds some work to each draw task and blend call, so enable it only for profiling*/
+#define LV_USE_DRAW_MONITOR 0
+
+/*The width and height of the tiles in `LV_DISPLAY_RENDER_MODE_TILED`*/
+#define LV_DRAW_TILE_SIZE    64  /*[px]*/
+
 /* The stack size of the drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -125,6 +165,17 @@
      * > 1 means multiply threads will render the screen in parallel */
     #define LV_DRAW_SW_DRAW_UNIT_CNT    1
 
+    /* Split large fill, box shadow, image and layer draw tasks into horizontal stripes
+     * and render the stripes with the idle draw units in parallel.
+     * A task is split only if each stripe has at least this many pixels.
+     * Used only if LV_DRAW_SW_DRAW_UNIT_CNT > 1. 0: disable splitting */
+    #define LV_DRAW_SW_STRIPE_MIN_SIZE  (16 * 1024)  /*[px]*/
+
+    /* Each draw unit keeps a scratch buffer for the temporary buffers of the draw tasks (e.g. masks)
+     * and reuses it for the next tasks. It grows to the size required by the tasks but not larger than this.
+     * Larger allocations are served by the heap. 0: always use the heap */
+    #define LV_DRAW_SW_SCRATCH_MAX_SIZE (16 * 1024)  /*[bytes]*/
+
     /* Use Arm-2D to accelerate the sw render */
     #define LV_USE_DRAW_ARM2D_SYNC      0
 
@@ -138,21 +189,47 @@
     #if LV_DRAW_SW_COMPLEX == 1
         /*Allow buffering some shadow calculation.
         *LV_DRAW_SW_SHADOW_CACHE_SIZE is the max. shadow size to buffer, where shadow size is `shadow_width + radius`
-        *Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost*/
+        *A cached shadow has shadow size^2 RAM cost*/
         #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
 
+        /*Total size of the cached shadows in bytes. The least recently used shadows are dropped when it's full.
+        *0: room for 4 shadows of LV_DRAW_SW_SHADOW_CACHE_SIZE */
+        #define LV_DRAW_SW_SHADOW_CACHE_MEM_SIZE 0
+
+        /*Blur algorithm of the shadows.
+        *0: the original sliding window blur
+        *>0: a Gaussian-like blur made of this many fixed-point box blurs. 3 is a good approximation.
+        *   It's faster for wide shadows but the result is slightly different*/
+        #define LV_DRAW_SW_SHADOW_BLUR_PASSES 0
+
         /* Set number of maximally cached circle data.
         * The circumference of 1/4 circle are saved for anti-aliasing
-        * radius * 4 bytes are used per circle (the most often used radiuses are saved)
+        * radius * 6 bytes are used per circle (the most recently used radiuses are saved)
         * 0: to disable caching */
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
+
+        /*Total size of the cached circles in bytes. The least recently used circles are dropped when it's full.
+        *0: room for LV_DRAW_SW_CIRCLE_CACHE_SIZE circles with 64 px radius, or more smaller ones */
+        #define LV_DRAW_SW_CIRCLE_CACHE_MEM_SIZE 0
     #endif
 
+    /* Size of the cache of the calculated gradient color maps in bytes.
+     * A gradient needs about 4 bytes per pixel of its width (horizontal) or height (vertical).
+     * The least recently used gradients are dropped when the cache is full.
+     * Can be changed later with `lv_gradient_cache_resize()`. 0: disable caching */
+    #define LV_DRAW_SW_GRADIENT_CACHE_SIZE 0
+
+    /* Use SIMD optimized blending: LV_DRAW_SW_ASM_NONE/NEON/HELIUM/X86/CUSTOM
+     * X86 selects SSE2 or AVX2 kernels at run time based on the CPU */
     #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
         #define  LV_DRAW_SW_ASM_CUSTOM_INCLUDE ""
     #endif
+
+    /* 1: Don't use the run time selected optimized kernels, only the C implementation.
+     * Useful for debugging. Can be changed later with `lv_draw_sw_set_kernel_features()`*/
+    #define LV_DRAW_SW_FORCE_SCALAR     0
 #endif
 
 /* Use NXP's VG-Lite GPU on iMX RTxxx platforms. */
@@ -451,6 +528,11 @@
 /*Enables/disables support for compressed fonts.*/
 #define LV_USE_FONT_COMPRESSED 0
 
+/*Size of the cache of the unpacked A8 glyph bitmaps of the built-in (lv_font_fmt_txt) fonts in bytes.
+ *The least recently used glyphs are dropped when it's full.
+ *0: disable caching, the glyphs are unpacked (and decompressed) every time they are drawn*/
+#define LV_FONT_FMT_TXT_CACHE_SIZE 0
+
 /*Enable drawing placeholders when glyph dsc is not found*/
 #define LV_USE_FONT_PLACEHOLDER 1
 
@@ -103,16 +103,24 @@ typedef struct _lv_global_t {
     lv_draw_buf_handlers_t font_draw_buf_handlers;
 
     lv_ll_t img_decoder_ll;
+    lv_mutex_t img_decoder_lock;
 
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
 
     lv_draw_global_info_t draw_info;
-#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    lv_draw_sw_shadow_cache_t sw_shadow_cache;
+#if LV_USE_DRAW_SW && LV_DRAW_SW_COMPLEX && LV_DRAW_SW_SHADOW_CACHE_SIZE
+    lv_cache_t * sw_shadow_cache;
 #endif
 #if LV_DRAW_SW_COMPLEX
-    _lv_draw_sw_mask_radius_circle_dsc_arr_t sw_circle_cache;
+    lv_cache_t * sw_circle_cache;
+#endif
+#if LV_USE_DRAW_SW
+    lv_draw_sw_kernels_t draw_sw_kernels;
+    uint32_t draw_sw_cpu_features;
+    lv_draw_sw_scratch_monitor_t draw_sw_scratch_monitor;
+    lv_cache_t * sw_grad_cache;
+    lv_gradient_cache_monitor_t sw_grad_cache_monitor;
 #endif
 
 #if LV_USE_LOG
@@ -178,6 +186,7 @@ typedef struct _lv_global_t {
 #if LV_USE_FONT_COMPRESSED
     lv_font_fmt_rle_t font_fmt_rle;
 #endif
+    lv_cache_t * font_fmt_txt_cache;
 
 #if LV_USE_SPAN != 0
     struct _snippet_stack * span_snippet_stack;
@@ -20,6 +20,7 @@
 #include "../misc/lv_types.h"
 #include "../tick/lv_tick.h"
 #include "../stdlib/lv_string.h"
+#include "../misc/cache/lv_image_cache.h"
 
 /*********************
  *      DEFINES
@@ -44,6 +45,7 @@ static void draw_scrollbar(lv_obj_t * obj, lv_layer_t * layer);
 static lv_result_t scrollbar_init_draw_dsc(lv_obj_t * obj, lv_draw_rect_dsc_t * dsc);
 static bool obj_valid_child(const lv_obj_t * parent, const lv_obj_t * obj_to_find);
 static void update_obj_state(lv_obj_t * obj, lv_state_t new_state);
+static void layer_cache_free(lv_obj_t * obj);
 #if LV_USE_OBJ_PROPERTY
     static lv_result_t lv_obj_set_any(lv_obj_t *, lv_prop_id_t, const lv_property_t *);
     static lv_result_t lv_obj_get_any(const lv_obj_t *, lv_prop_id_t, lv_property_t *);
@@ -161,6 +163,10 @@ void lv_obj_remove_flag(lv_obj_t * obj, lv_obj_flag_t f)
 
     obj->flags &= (~f);
 
+    if(f & LV_OBJ_FLAG_LAYER_CACHE) {
+        layer_cache_free(obj);
+    }
+
     if(f & LV_OBJ_FLAG_HIDDEN) {
         lv_obj_invalidate(obj);
         if(lv_obj_is_layout_positioned(obj)) {
@@ -362,6 +368,15 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     /*Remove the animations from this object*/
     lv_anim_delete(obj, NULL);
 
+#if LV_REFR_SCROLL_BLIT
+    /*Forget the pending scroll of this object*/
+    lv_display_t * disp = lv_display_get_next(NULL);
+    while(disp) {
+        if(disp->scroll_blit_obj == obj) disp->scroll_blit_obj = NULL;
+        disp = lv_display_get_next(disp);
+    }
+#endif
+
     /*Delete from the group*/
     lv_group_t * group = lv_obj_get_group(obj);
     if(group) lv_group_remove_obj(obj);
@@ -373,6 +388,7 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
         }
 
         lv_event_remove_all(&obj->spec_attr->event_list);
+        layer_cache_free(obj);
 
         lv_free(obj->spec_attr);
         obj->spec_attr = NULL;
@@ -819,6 +835,16 @@ static bool obj_valid_child(const lv_obj_t * parent, const lv_obj_t * obj_to_fin
     return false;
 }
 
+static void layer_cache_free(lv_obj_t * obj)
+{
+    if(obj->spec_attr == NULL || obj->spec_attr->layer_cache == NULL) return;
+
+    lv_image_cache_drop(obj->spec_attr->layer_cache);
+    lv_draw_buf_destroy(obj->spec_attr->layer_cache);
+    obj->spec_attr->layer_cache = NULL;
+    obj->spec_attr->layer_cache_valid = 0;
+}
+
 #if LV_USE_OBJ_PROPERTY
 static lv_result_t lv_obj_set_any(lv_obj_t * obj, lv_prop_id_t id, const lv_property_t * prop)
 {
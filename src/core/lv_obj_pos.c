@@ -807,6 +807,13 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*The content of the object changed so the cached layers of it and its parents are outdated*/
+    const lv_obj_t * parent = obj;
+    while(parent) {
+        if(parent->spec_attr) parent->spec_attr->layer_cache_valid = 0;
+        parent = parent->parent;
+    }
+
     lv_display_t * disp   = lv_obj_get_display(obj);
     if(!lv_display_is_invalidation_enabled(disp)) return;
 
@@ -11,6 +11,7 @@
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_scroll.h"
 #include "../display/lv_display.h"
+#include "lv_refr.h"
 
 /*********************
  *      DEFINES
@@ -420,7 +421,11 @@ lv_result_t _lv_obj_scroll_by_raw(lv_obj_t * obj, int32_t x, int32_t y)
     lv_obj_move_children_by(obj, x, y, true);
     lv_result_t res = lv_obj_send_event(obj, LV_EVENT_SCROLL, NULL);
     if(res != LV_RESULT_OK) return res;
+#if LV_REFR_SCROLL_BLIT
+    _lv_refr_invalidate_scroll(obj, x, y);
+#else
     lv_obj_invalidate(obj);
+#endif
     return LV_RESULT_OK;
 }
 
@@ -63,6 +63,7 @@ static void full_cache_refresh(lv_obj_t * obj, lv_part_t part);
 static void fade_anim_cb(void * obj, int32_t v);
 static void fade_in_anim_completed(lv_anim_t * a);
 static bool style_has_flag(const lv_style_t * style, uint32_t flag);
+static void invalidate_on_prop_change(lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop);
 static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                               lv_style_value_t * value_act);
 
@@ -275,7 +276,7 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 
     if(!style_refr) return;
 
-    lv_obj_invalidate(obj);
+    invalidate_on_prop_change(obj, selector, prop);
 
     lv_part_t part = lv_obj_style_get_selector_part(selector);
 
@@ -306,7 +307,7 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
     if(prop == LV_STYLE_PROP_ANY || is_ext_draw) {
         lv_obj_refresh_ext_draw_size(obj);
     }
-    lv_obj_invalidate(obj);
+    invalidate_on_prop_change(obj, selector, prop);
 
     if(prop == LV_STYLE_PROP_ANY || (is_inheritable && (is_ext_draw || is_layout_refr))) {
         if(part != LV_PART_SCROLLBAR) {
@@ -352,7 +353,7 @@ void lv_obj_set_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_style_
 {
     lv_style_t * style = get_local_style(obj, selector);
     if(selector == LV_PART_MAIN && lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_TRANSFORM)) {
-        lv_obj_invalidate(obj);
+        invalidate_on_prop_change(obj, selector, prop);
     }
 
     lv_style_set_prop(style, prop, value);
@@ -1047,6 +1048,39 @@ static bool style_has_flag(const lv_style_t * style, uint32_t flag)
     return false;
 }
 
+/**
+ * Invalidate an object when a style property changes.
+ * The properties used only to blend the layer of the object don't change its content,
+ * so the cached layer of the object is kept.
+ */
+static void invalidate_on_prop_change(lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop)
+{
+    bool keep_layer_cache = false;
+    if(obj->spec_attr && obj->spec_attr->layer_cache_valid &&
+       lv_obj_style_get_selector_part(selector) == LV_PART_MAIN) {
+        switch(prop) {
+            case LV_STYLE_OPA_LAYERED:
+            case LV_STYLE_BLEND_MODE:
+            case LV_STYLE_BITMAP_MASK_SRC:
+            case LV_STYLE_TRANSFORM_SCALE_X:
+            case LV_STYLE_TRANSFORM_SCALE_Y:
+            case LV_STYLE_TRANSFORM_ROTATION:
+            case LV_STYLE_TRANSFORM_PIVOT_X:
+            case LV_STYLE_TRANSFORM_PIVOT_Y:
+            case LV_STYLE_TRANSFORM_SKEW_X:
+            case LV_STYLE_TRANSFORM_SKEW_Y:
+                keep_layer_cache = true;
+                break;
+            default:
+                break;
+        }
+    }
+
+    lv_obj_invalidate(obj);
+
+    if(keep_layer_cache) obj->spec_attr->layer_cache_valid = 1;
+}
+
 static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                               lv_style_value_t * value_act)
 {
@@ -17,6 +17,7 @@
 #include "../draw/lv_draw.h"
 #include "../font/lv_font_fmt_txt.h"
 #include "../stdlib/lv_string.h"
+#include "../misc/cache/lv_image_cache.h"
 #include "lv_global.h"
 
 /*********************
@@ -35,16 +36,37 @@
  **********************/
 static void lv_refr_join_area(void);
 static void refr_invalid_areas(void);
+static bool inv_area_add(lv_display_t * disp, const lv_area_t * area_p);
+static void inv_area_merge(lv_display_t * disp, const lv_area_t * area_p);
+static void inv_area_sort(lv_display_t * disp);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p);
 static void refr_area_part(lv_layer_t * layer);
+static void refr_area_tiled(const lv_area_t * area_p);
+static void refr_screens(lv_layer_t * layer);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj);
 static void refr_obj(lv_layer_t * layer, lv_obj_t * obj);
+static void layer_draw_dsc_init(lv_obj_t * obj, lv_draw_image_dsc_t * dsc, lv_opa_t opa, const lv_area_t * buf_area);
+static lv_result_t refr_obj_from_layer_cache(lv_layer_t * layer, lv_obj_t * obj, lv_layer_type_t layer_type,
+                                             const lv_area_t * obj_draw_size, lv_opa_t opa);
+static lv_draw_buf_t * layer_cache_update(lv_obj_t * obj, const lv_area_t * cache_area);
 static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h);
 static void draw_buf_flush(lv_display_t * disp);
 static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
-static void wait_for_flushing(lv_display_t * disp);
+static void wait_for_flush_queue(lv_display_t * disp, uint32_t max_pending);
+static uint32_t get_pending_flush_cnt(lv_display_t * disp);
+static void wait_for_buf_act(lv_display_t * disp);
+static uint32_t get_last_buf_idx(lv_display_t * disp);
+static lv_draw_buf_t * get_last_buf(lv_display_t * disp);
+#if LV_REFR_SCROLL_BLIT
+    static bool scroll_blit_is_supported(lv_display_t * disp, lv_obj_t * obj);
+    static bool scroll_blit_get_area(lv_obj_t * obj, const lv_point_t * diff, lv_area_t * blit_area);
+    static bool obj_has_custom_drawing(lv_obj_t * obj);
+    static bool obj_tree_is_on_area(lv_obj_t * obj, const lv_area_t * area);
+    static void scroll_blit_prepare(void);
+    static void scroll_blit(void);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -276,8 +298,8 @@ void _lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
 
     /*If there were at least 1 invalid area in full refresh mode, redraw the whole screen*/
     if(disp->render_mode == LV_DISPLAY_RENDER_MODE_FULL) {
-        disp->inv_areas[0] = scr_area;
-        disp->inv_p = 1;
+        disp->inv_p = 0;
+        inv_area_add(disp, &scr_area);
         lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
         return;
     }
@@ -286,23 +308,53 @@ void _lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     if(res != LV_RESULT_OK) return;
 
     /*Save only if this area is not in one of the saved areas*/
-    uint16_t i;
+    uint32_t i;
     for(i = 0; i < disp->inv_p; i++) {
         if(_lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) return;
     }
 
-    /*Save the area*/
-    lv_area_t * tmp_area_p = &com_area;
-    if(disp->inv_p >= LV_INV_BUF_SIZE) { /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        tmp_area_p = &scr_area;
+    /*Save the area. If there is no place for it, merge it into the area which grows the least*/
+    if(inv_area_add(disp, &com_area) == false) {
+        inv_area_merge(disp, &com_area);
+        disp->inv_monitor.overflow_cnt++;
     }
-    lv_area_copy(&disp->inv_areas[disp->inv_p], tmp_area_p);
-    disp->inv_p++;
 
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 }
 
+#if LV_REFR_SCROLL_BLIT
+void _lv_refr_invalidate_scroll(lv_obj_t * obj, int32_t x, int32_t y)
+{
+    lv_display_t * disp = lv_obj_get_display(obj);
+
+    /*Only one object's scrolling can be copied in a refresh*/
+    if(disp == NULL || !lv_display_is_invalidation_enabled(disp) || disp->rendering_in_progress ||
+       (disp->scroll_blit_obj != NULL && disp->scroll_blit_obj != obj) ||
+       !scroll_blit_is_supported(disp, obj)) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    /*The content changed so the cached layers of the object and its parents are outdated*/
+    lv_obj_t * parent = obj;
+    while(parent) {
+        if(parent->spec_attr) parent->spec_attr->layer_cache_valid = 0;
+        parent = parent->parent;
+    }
+
+    /*Just save the scroll steps. The areas to redraw are calculated before refreshing.*/
+    if(disp->scroll_blit_obj == NULL) {
+        disp->scroll_blit_obj = obj;
+        disp->scroll_blit_diff.x = 0;
+        disp->scroll_blit_diff.y = 0;
+    }
+    disp->scroll_blit_diff.x += x;
+    disp->scroll_blit_diff.y += y;
+
+    lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
+}
+#endif
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
@@ -369,6 +421,10 @@ void _lv_display_refr_timer(lv_timer_t * tmr)
         goto refr_finish;
     }
 
+#if LV_REFR_SCROLL_BLIT
+    scroll_blit_prepare();
+#endif
+
     lv_refr_join_area();
     refr_sync_areas();
     refr_invalid_areas();
@@ -379,32 +435,38 @@ void _lv_display_refr_timer(lv_timer_t * tmr)
     lv_display_send_event(disp_refr, LV_EVENT_RENDER_READY, NULL);
 
     if(!lv_display_is_double_buffered(disp_refr) ||
-       disp_refr->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT) goto refr_clean_up;
+       (disp_refr->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT &&
+        disp_refr->render_mode != LV_DISPLAY_RENDER_MODE_TILED)) goto refr_clean_up;
 
-    /*With double buffered direct mode synchronize the rendered areas to the other buffer*/
-    /*We need to wait for ready here to not mess up the active screen*/
-    wait_for_flushing(disp_refr);
+    /*With multi buffered direct mode the rendered areas need to be synchronized to the other buffers
+     *before rendering into them. The buffers are already swapped so the last rendered buffer is
+     *the one before the active buffer.*/
+    uint32_t buf_mask = ((1UL << disp_refr->buf_cnt) - 1) & ~(1UL << get_last_buf_idx(disp_refr));
 
     uint32_t i;
     for(i = 0; i < disp_refr->inv_p; i++) {
         if(disp_refr->inv_area_joined[i])
             continue;
 
-        lv_area_t * sync_area = _lv_ll_ins_tail(&disp_refr->sync_areas);
-        *sync_area = disp_refr->inv_areas[i];
+        lv_display_sync_area_t * sync_area = _lv_ll_ins_tail(&disp_refr->sync_areas);
+        sync_area->area = disp_refr->inv_areas[i];
+        sync_area->buf_mask = buf_mask;
     }
 
+#if LV_REFR_SCROLL_BLIT
+    /*The copied area was also changed*/
+    if(lv_area_get_size(&disp_refr->scroll_blit_area) > 0) {
+        lv_display_sync_area_t * sync_area = _lv_ll_ins_tail(&disp_refr->sync_areas);
+        sync_area->area = disp_refr->scroll_blit_area;
+        sync_area->buf_mask = buf_mask;
+    }
+#endif
+
 refr_clean_up:
-    lv_memzero(disp_refr->inv_areas, sizeof(disp_refr->inv_areas));
-    lv_memzero(disp_refr->inv_area_joined, sizeof(disp_refr->inv_area_joined));
     disp_refr->inv_p = 0;
 
 refr_finish:
 
-#if LV_DRAW_SW_COMPLEX == 1
-    _lv_draw_sw_mask_cleanup();
-#endif
-
     lv_display_send_event(disp_refr, LV_EVENT_REFR_READY, NULL);
 
     LV_TRACE_REFR("finished");
@@ -416,41 +478,140 @@ refr_finish:
  **********************/
 
 /**
- * Join the areas which has got common parts
+ * Store a new invalidated area
+ * @param disp      pointer to a display
+ * @param area_p    the area to store
+ * @return          true: the area is stored; false: the limit is reached or out of memory
+ */
+static bool inv_area_add(lv_display_t * disp, const lv_area_t * area_p)
+{
+    if(disp->inv_p >= disp->inv_area_limit) return false;
+
+    /*Grow the buffers if required*/
+    if(disp->inv_p >= disp->inv_area_capacity) {
+        uint32_t new_capacity = disp->inv_area_capacity == 0 ? LV_INV_BUF_SIZE : disp->inv_area_capacity * 2;
+        new_capacity = LV_MIN(new_capacity, disp->inv_area_limit);
+        new_capacity = LV_MAX(new_capacity, disp->inv_p + 1);
+
+        lv_area_t * new_areas = lv_realloc(disp->inv_areas, new_capacity * sizeof(lv_area_t));
+        LV_ASSERT_MALLOC(new_areas);
+        if(new_areas == NULL) return false;
+        disp->inv_areas = new_areas;
+
+        uint8_t * new_joined = lv_realloc(disp->inv_area_joined, new_capacity * sizeof(uint8_t));
+        LV_ASSERT_MALLOC(new_joined);
+        if(new_joined == NULL) return false;
+        disp->inv_area_joined = new_joined;
+
+        disp->inv_area_capacity = new_capacity;
+    }
+
+    disp->inv_areas[disp->inv_p] = *area_p;
+    disp->inv_area_joined[disp->inv_p] = 0;
+    disp->inv_p++;
+
+    lv_display_inv_monitor_t * mon = &disp->inv_monitor;
+    mon->inv_area_cnt++;
+    if(mon->inv_area_max < disp->inv_p) mon->inv_area_max = disp->inv_p;
+
+    return true;
+}
+
+/**
+ * Merge an area into the stored area which needs to grow the least to contain it
+ * @param disp      pointer to a display
+ * @param area_p    the area to merge
+ */
+static void inv_area_merge(lv_display_t * disp, const lv_area_t * area_p)
+{
+    if(disp->inv_p == 0) return; /*Out of memory*/
+
+    uint32_t best_i = 0;
+    uint32_t best_growth = UINT32_MAX;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        lv_area_t joined_area;
+        _lv_area_join(&joined_area, &disp->inv_areas[i], area_p);
+        uint32_t growth = lv_area_get_size(&joined_area) - lv_area_get_size(&disp->inv_areas[i]);
+        if(growth < best_growth) {
+            best_growth = growth;
+            best_i = i;
+        }
+    }
+
+    _lv_area_join(&disp->inv_areas[best_i], &disp->inv_areas[best_i], area_p);
+}
+
+/**
+ * Sort the invalidated areas by their top coordinate
+ * @param disp      pointer to a display
+ */
+static void inv_area_sort(lv_display_t * disp)
+{
+    /*Insertion sort as the areas are usually few and are often added in order*/
+    lv_area_t * areas = disp->inv_areas;
+    uint32_t i;
+    for(i = 1; i < disp->inv_p; i++) {
+        lv_area_t a = areas[i];
+        uint32_t j = i;
+        while(j > 0 && areas[j - 1].y1 > a.y1) {
+            areas[j] = areas[j - 1];
+            j--;
+        }
+        areas[j] = a;
+    }
+}
+
+/**
+ * Join the areas if refreshing the joined area is cheaper than refreshing them one by one.
+ * The cost of an area is its size plus the overhead of the display.
  */
 static void lv_refr_join_area(void)
 {
     LV_PROFILER_BEGIN;
+
+    /*With sorted areas only the areas starting not much below an area need to be checked*/
+    inv_area_sort(disp_refr);
+
+    lv_area_t * areas = disp_refr->inv_areas;
+    uint8_t * area_joined = disp_refr->inv_area_joined;
+    uint32_t inv_p = disp_refr->inv_p;
+    uint32_t overhead = disp_refr->inv_area_overhead;
     uint32_t join_from;
     uint32_t join_in;
     lv_area_t joined_area;
-    for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
-        if(disp_refr->inv_area_joined[join_in] != 0) continue;
-
-        /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
-            /*Handle only unjoined areas and ignore itself*/
-            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
-                continue;
-            }
+    bool joined_any;
 
-            /*Check if the areas are on each other*/
-            if(_lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
-                continue;
-            }
+    /*Joining makes the areas larger so they might be joinable with other areas too. Repeat until no change.*/
+    do {
+        joined_any = false;
+        for(join_in = 0; join_in < inv_p; join_in++) {
+            if(area_joined[join_in] != 0) continue;
+
+            for(join_from = join_in + 1; join_from < inv_p; join_from++) {
+                /*The rows between the two areas are redrawn in their full width for nothing.
+                 *If it's more than the overhead, this and the later areas can't be joined.*/
+                int32_t gap = areas[join_from].y1 - areas[join_in].y2 - 1;
+                if(gap > 0 && (uint32_t)gap * lv_area_get_width(&areas[join_in]) >= overhead) break;
 
-            _lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+                if(area_joined[join_from] != 0) continue;
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+                _lv_area_join(&joined_area, &areas[join_in], &areas[join_from]);
 
-                /*Mark 'join_form' is joined into 'join_in'*/
-                disp_refr->inv_area_joined[join_from] = 1;
+                /*Join two areas only if the joined area is cheaper to refresh*/
+                if(lv_area_get_size(&joined_area) < lv_area_get_size(&areas[join_in]) +
+                   lv_area_get_size(&areas[join_from]) + overhead) {
+                    areas[join_in] = joined_area;
+
+                    /*Mark 'join_form' is joined into 'join_in'*/
+                    area_joined[join_from] = 1;
+                    disp_refr->inv_monitor.joined_cnt++;
+                    joined_any = true;
+                }
             }
         }
-    }
+    } while(joined_any);
+
     LV_PROFILER_END;
 }
 
@@ -459,8 +620,9 @@ static void lv_refr_join_area(void)
  */
 static void refr_sync_areas(void)
 {
-    /*Do not sync if not direct or double buffered*/
-    if(disp_refr->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT) return;
+    /*Do not sync if not direct (or tiled) or double buffered*/
+    if(disp_refr->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT &&
+       disp_refr->render_mode != LV_DISPLAY_RENDER_MODE_TILED) return;
 
     /*Do not sync if not double buffered*/
     if(!lv_display_is_double_buffered(disp_refr)) return;
@@ -469,20 +631,40 @@ static void refr_sync_areas(void)
     if(_lv_ll_is_empty(&disp_refr->sync_areas)) return;
 
     LV_PROFILER_BEGIN;
-    /*With double buffered direct mode synchronize the rendered areas to the other buffer*/
-    /*We need to wait for ready here to not mess up the active screen*/
-    wait_for_flushing(disp_refr);
+    /*With multi buffered direct mode synchronize the rendered areas to the active buffer*/
+    /*We need to wait until the active buffer is not used by the display anymore*/
+    wait_for_buf_act(disp_refr);
 
     /*The buffers are already swapped.
-     *So the active buffer is the off screen buffer where LVGL will render*/
+     *So the active buffer is the off screen buffer where LVGL will render
+     *and the last rendered buffer has the up-to-date content*/
     lv_draw_buf_t * off_screen = disp_refr->buf_act;
-    lv_draw_buf_t * on_screen = disp_refr->buf_act == disp_refr->buf_1 ? disp_refr->buf_2 : disp_refr->buf_1;
+    lv_draw_buf_t * on_screen = get_last_buf(disp_refr);
+
+    /*Collect the areas which were not updated in the active buffer yet*/
+    uint32_t act_mask = 1UL << disp_refr->buf_act_idx;
+    lv_ll_t act_areas;
+    _lv_ll_init(&act_areas, sizeof(lv_area_t));
+    lv_display_sync_area_t * sync_entry = _lv_ll_get_head(&disp_refr->sync_areas);
+    while(sync_entry != NULL) {
+        lv_display_sync_area_t * next_entry = _lv_ll_get_next(&disp_refr->sync_areas, sync_entry);
+        if(sync_entry->buf_mask & act_mask) {
+            lv_area_t * a = _lv_ll_ins_tail(&act_areas);
+            *a = sync_entry->area;
+            sync_entry->buf_mask &= ~act_mask;
+            if(sync_entry->buf_mask == 0) {
+                _lv_ll_remove(&disp_refr->sync_areas, sync_entry);
+                lv_free(sync_entry);
+            }
+        }
+        sync_entry = next_entry;
+    }
 
     uint32_t hor_res = lv_display_get_horizontal_resolution(disp_refr);
     uint32_t ver_res = lv_display_get_vertical_resolution(disp_refr);
 
     /*Iterate through invalidated areas to see if sync area should be copied*/
-    uint16_t i;
+    uint32_t i;
     int8_t j;
     lv_area_t res[4] = {0};
     int8_t res_c;
@@ -492,10 +674,10 @@ static void refr_sync_areas(void)
         if(disp_refr->inv_area_joined[i]) continue;
 
         /*Iterate over sync areas*/
-        sync_area = _lv_ll_get_head(&disp_refr->sync_areas);
+        sync_area = _lv_ll_get_head(&act_areas);
         while(sync_area != NULL) {
             /*Get next sync area*/
-            next_area = _lv_ll_get_next(&disp_refr->sync_areas, sync_area);
+            next_area = _lv_ll_get_next(&act_areas, sync_area);
 
             /*Remove intersect of redraw area from sync area and get remaining areas*/
             res_c = _lv_area_diff(res, sync_area, &disp_refr->inv_areas[i]);
@@ -504,10 +686,10 @@ static void refr_sync_areas(void)
             if(res_c != -1) {
                 /*Replace old sync area with new areas*/
                 for(j = 0; j < res_c; j++) {
-                    new_area = _lv_ll_ins_prev(&disp_refr->sync_areas, sync_area);
+                    new_area = _lv_ll_ins_prev(&act_areas, sync_area);
                     *new_area = res[j];
                 }
-                _lv_ll_remove(&disp_refr->sync_areas, sync_area);
+                _lv_ll_remove(&act_areas, sync_area);
                 lv_free(sync_area);
             }
 
@@ -518,17 +700,18 @@ static void refr_sync_areas(void)
 
     lv_area_t disp_area = {0, 0, (int32_t)hor_res - 1, (int32_t)ver_res - 1};
     /*Copy sync areas (if any remaining)*/
-    for(sync_area = _lv_ll_get_head(&disp_refr->sync_areas); sync_area != NULL;
-        sync_area = _lv_ll_get_next(&disp_refr->sync_areas, sync_area)) {
+    for(sync_area = _lv_ll_get_head(&act_areas); sync_area != NULL;
+        sync_area = _lv_ll_get_next(&act_areas, sync_area)) {
         /**
          * @todo Resize SDL window will trigger crash because of sync_area is larger than disp_area
          */
-        _lv_area_intersect(sync_area, sync_area, &disp_area);
+        if(!_lv_area_intersect(sync_area, sync_area, &disp_area)) continue;
+        if(disp_refr->render_rotated) lv_display_rotate_area(disp_refr, sync_area);
         lv_draw_buf_copy(off_screen, sync_area, on_screen, sync_area);
     }
 
-    /*Clear sync areas*/
-    _lv_ll_clear(&disp_refr->sync_areas);
+    /*Clear the copied areas*/
+    _lv_ll_clear(&act_areas);
     LV_PROFILER_END;
 }
 
@@ -557,6 +740,11 @@ static void refr_invalid_areas(void)
     disp_refr->last_part = 0;
     disp_refr->rendering_in_progress = true;
 
+#if LV_REFR_SCROLL_BLIT
+    /*Copy the scrolled pixels first as the redrawn areas might overlap them*/
+    scroll_blit();
+#endif
+
     for(i = 0; i < (int32_t)disp_refr->inv_p; i++) {
         /*Refresh the unjoined areas*/
         if(disp_refr->inv_area_joined[i] == 0) {
@@ -564,6 +752,9 @@ static void refr_invalid_areas(void)
             if(i == last_i) disp_refr->last_area = 1;
             disp_refr->last_part = 0;
             refr_area(&disp_refr->inv_areas[i]);
+
+            disp_refr->inv_monitor.refr_area_cnt++;
+            disp_refr->inv_monitor.refr_px_cnt += lv_area_get_size(&disp_refr->inv_areas[i]);
         }
     }
 
@@ -577,11 +768,17 @@ static void refr_invalid_areas(void)
  */
 static void layer_reshape_draw_buf(lv_layer_t * layer)
 {
+    /*When rendering rotated the buffer is laid out in the orientation of the display's hardware*/
+    layer->rotation = disp_refr->render_rotated ? disp_refr->rotation : LV_DISPLAY_ROTATION_0;
+    bool swap_wh = layer->rotation == LV_DISPLAY_ROTATION_90 || layer->rotation == LV_DISPLAY_ROTATION_270;
+    int32_t w = lv_area_get_width(&layer->buf_area);
+    int32_t h = lv_area_get_height(&layer->buf_area);
+
     LV_ASSERT(lv_draw_buf_reshape(
                   layer->draw_buf,
                   layer->color_format,
-                  lv_area_get_width(&layer->buf_area),
-                  lv_area_get_height(&layer->buf_area),
+                  swap_wh ? h : w,
+                  swap_wh ? w : h,
                   0)
               != NULL);
 }
@@ -592,6 +789,11 @@ static void layer_reshape_draw_buf(lv_layer_t * layer)
  */
 static void refr_area(const lv_area_t * area_p)
 {
+    if(disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_TILED) {
+        refr_area_tiled(area_p);
+        return;
+    }
+
     LV_PROFILER_BEGIN;
     lv_layer_t * layer = disp_refr->layer_head;
     layer->draw_buf = disp_refr->buf_act;
@@ -672,11 +874,9 @@ static void refr_area_part(lv_layer_t * layer)
     LV_PROFILER_BEGIN;
     disp_refr->refreshed_area = layer->_clip_area;
 
-    /* In single buffered mode wait here until the buffer is freed.
+    /* Wait here until the buffer is freed.
      * Else we would draw into the buffer while it's still being transferred to the display*/
-    if(!lv_display_is_double_buffered(disp_refr)) {
-        wait_for_flushing(disp_refr);
-    }
+    wait_for_buf_act(disp_refr);
     /*If the screen is transparent initialize it when the flushing is ready*/
     if(lv_color_format_has_alpha(disp_refr->color_format)) {
         lv_area_t a = disp_refr->refreshed_area;
@@ -685,9 +885,121 @@ static void refr_area_part(lv_layer_t * layer)
             lv_area_move(&a, -disp_refr->refreshed_area.x1, -disp_refr->refreshed_area.y1);
         }
 
+        lv_draw_layer_rotate_area(layer, &a);
         lv_draw_buf_clear(layer->draw_buf, &a);
     }
 
+    refr_screens(layer);
+
+    draw_buf_flush(disp_refr);
+    LV_PROFILER_END;
+}
+
+/**
+ * Refresh an area in tiled render mode. The area is cut into tiles and each tile is
+ * rendered into its own layer. As the tasks of the tiles don't overlap the draw units
+ * can render the tiles in parallel. The tiles are flushed when they are ready.
+ * @param area_p  pointer to an area to refresh
+ */
+static void refr_area_tiled(const lv_area_t * area_p)
+{
+    LV_PROFILER_BEGIN;
+    lv_layer_t * main_layer = disp_refr->layer_head;
+    main_layer->draw_buf = disp_refr->buf_act;
+    main_layer->buf_area.x1 = 0;
+    main_layer->buf_area.y1 = 0;
+    main_layer->buf_area.x2 = lv_display_get_horizontal_resolution(disp_refr) - 1;
+    main_layer->buf_area.y2 = lv_display_get_vertical_resolution(disp_refr) - 1;
+    layer_reshape_draw_buf(main_layer);
+
+    /* Wait here until the buffer is freed.
+     * Else we would draw into the buffer while it's still being transferred to the display*/
+    wait_for_buf_act(disp_refr);
+
+    /*Align the tiles to a fixed grid so that the same tiles are used in each refresh*/
+    int32_t tile_x1 = area_p->x1 - area_p->x1 % LV_DRAW_TILE_SIZE;
+    int32_t tile_y1 = area_p->y1 - area_p->y1 % LV_DRAW_TILE_SIZE;
+    uint32_t col_cnt = (area_p->x2 - tile_x1) / LV_DRAW_TILE_SIZE + 1;
+    uint32_t row_cnt = (area_p->y2 - tile_y1) / LV_DRAW_TILE_SIZE + 1;
+    uint32_t tile_cnt = col_cnt * row_cnt;
+
+    lv_layer_t * tiles = lv_malloc_zeroed(tile_cnt * sizeof(lv_layer_t));
+    LV_ASSERT_MALLOC(tiles);
+    if(tiles == NULL) {
+        LV_PROFILER_END;
+        return;
+    }
+
+    uint32_t i;
+    for(i = 0; i < tile_cnt; i++) {
+        lv_layer_t * tile = &tiles[i];
+        lv_area_t tile_area;
+        tile_area.x1 = tile_x1 + (int32_t)(i % col_cnt) * LV_DRAW_TILE_SIZE;
+        tile_area.y1 = tile_y1 + (int32_t)(i / col_cnt) * LV_DRAW_TILE_SIZE;
+        tile_area.x2 = tile_area.x1 + LV_DRAW_TILE_SIZE - 1;
+        tile_area.y2 = tile_area.y1 + LV_DRAW_TILE_SIZE - 1;
+        _lv_area_intersect(&tile->_clip_area, &tile_area, area_p);
+
+        tile->draw_buf = main_layer->draw_buf;
+        tile->buf_area = main_layer->buf_area;
+        tile->color_format = main_layer->color_format;
+        tile->rotation = main_layer->rotation;
+        if(disp_refr->layer_init) disp_refr->layer_init(disp_refr, tile);
+
+        /*The tile layers are rendered with the other layers of the display.
+         *The previous tiles might have added layers too so find the tail each time.*/
+        lv_layer_t * tail = main_layer;
+        while(tail->next) tail = tail->next;
+        tail->next = tile;
+
+        /*If the screen is transparent initialize the tile*/
+        if(lv_color_format_has_alpha(disp_refr->color_format)) {
+            lv_area_t a = tile->_clip_area;
+            lv_draw_layer_rotate_area(tile, &a);
+            lv_draw_buf_clear(tile->draw_buf, &a);
+        }
+
+        refr_screens(tile);
+    }
+
+    /*Flush the tiles as they are ready*/
+    uint32_t remaining_cnt = tile_cnt;
+    while(remaining_cnt) {
+        for(i = 0; i < tile_cnt; i++) {
+            lv_layer_t * tile = &tiles[i];
+            if(tile->draw_buf == NULL || tile->draw_task_head) continue;
+
+            /*Remove the tile from the display's layers*/
+            lv_layer_t * prev = main_layer;
+            while(prev->next != tile) prev = prev->next;
+            prev->next = tile->next;
+
+            if(disp_refr->layer_deinit) disp_refr->layer_deinit(disp_refr, tile);
+            lv_draw_layer_deinit(tile);
+            tile->draw_buf = NULL;  /*Mark as flushed. The buffer belongs to the display.*/
+            remaining_cnt--;
+
+            disp_refr->refreshed_area = tile->_clip_area;
+            disp_refr->last_part = remaining_cnt == 0;
+            draw_buf_flush(disp_refr);
+        }
+
+        if(remaining_cnt) {
+            lv_draw_dispatch_wait_for_request();
+            lv_draw_dispatch();
+        }
+    }
+
+    lv_free(tiles);
+    LV_PROFILER_END;
+}
+
+/**
+ * Draw the screens and the display layers on a layer
+ * @param layer  pointer to a layer whose clip area will be refreshed
+ */
+static void refr_screens(lv_layer_t * layer)
+{
     lv_obj_t * top_act_scr = NULL;
     lv_obj_t * top_prev_scr = NULL;
 
@@ -726,9 +1038,6 @@ static void refr_area_part(lv_layer_t * layer)
     /*Also refresh top and sys layer unconditionally*/
     refr_obj_and_children(layer, lv_display_get_layer_top(disp_refr));
     refr_obj_and_children(layer, lv_display_get_layer_sys(disp_refr));
-
-    draw_buf_flush(disp_refr);
-    LV_PROFILER_END;
 }
 
 /**
@@ -900,6 +1209,12 @@ void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
         lv_result_t res = layer_get_area(layer, obj, layer_type, &layer_area_full, &obj_draw_size);
         if(res != LV_RESULT_OK) return;
 
+        /*Blend the cached layer if possible, else render the layer normally*/
+        if(lv_obj_has_flag(obj, LV_OBJ_FLAG_LAYER_CACHE)) {
+            res = refr_obj_from_layer_cache(layer, obj, layer_type, &obj_draw_size, opa);
+            if(res == LV_RESULT_OK) return;
+        }
+
         /*Simple layers can be subdivied into smaller layers*/
         uint32_t max_rgb_row_height = lv_area_get_height(&layer_area_full);
         uint32_t max_argb_row_height = lv_area_get_height(&layer_area_full);
@@ -931,34 +1246,8 @@ void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
                                                           area_need_alpha ? LV_COLOR_FORMAT_ARGB8888 : LV_COLOR_FORMAT_NATIVE, &layer_area_act);
             lv_obj_redraw(new_layer, obj);
 
-            lv_point_t pivot = {
-                .x = lv_obj_get_style_transform_pivot_x(obj, 0),
-                .y = lv_obj_get_style_transform_pivot_y(obj, 0)
-            };
-
-            if(LV_COORD_IS_PCT(pivot.x)) {
-                pivot.x = (LV_COORD_GET_PCT(pivot.x) * lv_area_get_width(&obj->coords)) / 100;
-            }
-            if(LV_COORD_IS_PCT(pivot.y)) {
-                pivot.y = (LV_COORD_GET_PCT(pivot.y) * lv_area_get_height(&obj->coords)) / 100;
-            }
-
             lv_draw_image_dsc_t layer_draw_dsc;
-            lv_draw_image_dsc_init(&layer_draw_dsc);
-            layer_draw_dsc.pivot.x = obj->coords.x1 + pivot.x - new_layer->buf_area.x1;
-            layer_draw_dsc.pivot.y = obj->coords.y1 + pivot.y - new_layer->buf_area.y1;
-
-            layer_draw_dsc.opa = opa;
-            layer_draw_dsc.rotation = lv_obj_get_style_transform_rotation(obj, 0);
-            while(layer_draw_dsc.rotation > 3600) layer_draw_dsc.rotation -= 3600;
-            while(layer_draw_dsc.rotation < 0) layer_draw_dsc.rotation += 3600;
-            layer_draw_dsc.scale_x = lv_obj_get_style_transform_scale_x(obj, 0);
-            layer_draw_dsc.scale_y = lv_obj_get_style_transform_scale_y(obj, 0);
-            layer_draw_dsc.skew_x = lv_obj_get_style_transform_skew_x(obj, 0);
-            layer_draw_dsc.skew_y = lv_obj_get_style_transform_skew_y(obj, 0);
-            layer_draw_dsc.blend_mode = lv_obj_get_style_blend_mode(obj, 0);
-            layer_draw_dsc.antialias = disp_refr->antialiasing;
-            layer_draw_dsc.bitmap_mask_src = lv_obj_get_style_bitmap_mask_src(obj, 0);
+            layer_draw_dsc_init(obj, &layer_draw_dsc, opa, &new_layer->buf_area);
             layer_draw_dsc.image_area = obj_draw_size;
             layer_draw_dsc.src = new_layer;
 
@@ -969,6 +1258,139 @@ void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
     }
 }
 
+/**
+ * Initialize a draw descriptor to blend the layer of an object with its opacity, transformation, etc
+ * @param obj           the object whose layer is blended
+ * @param dsc           the descriptor to initialize
+ * @param opa           the `opa_layered` of the object
+ * @param buf_area      the area of the layer's buffer
+ */
+static void layer_draw_dsc_init(lv_obj_t * obj, lv_draw_image_dsc_t * dsc, lv_opa_t opa, const lv_area_t * buf_area)
+{
+    lv_point_t pivot = {
+        .x = lv_obj_get_style_transform_pivot_x(obj, 0),
+        .y = lv_obj_get_style_transform_pivot_y(obj, 0)
+    };
+
+    if(LV_COORD_IS_PCT(pivot.x)) {
+        pivot.x = (LV_COORD_GET_PCT(pivot.x) * lv_area_get_width(&obj->coords)) / 100;
+    }
+    if(LV_COORD_IS_PCT(pivot.y)) {
+        pivot.y = (LV_COORD_GET_PCT(pivot.y) * lv_area_get_height(&obj->coords)) / 100;
+    }
+
+    lv_draw_image_dsc_init(dsc);
+    dsc->pivot.x = obj->coords.x1 + pivot.x - buf_area->x1;
+    dsc->pivot.y = obj->coords.y1 + pivot.y - buf_area->y1;
+
+    dsc->opa = opa;
+    dsc->rotation = lv_obj_get_style_transform_rotation(obj, 0);
+    while(dsc->rotation > 3600) dsc->rotation -= 3600;
+    while(dsc->rotation < 0) dsc->rotation += 3600;
+    dsc->scale_x = lv_obj_get_style_transform_scale_x(obj, 0);
+    dsc->scale_y = lv_obj_get_style_transform_scale_y(obj, 0);
+    dsc->skew_x = lv_obj_get_style_transform_skew_x(obj, 0);
+    dsc->skew_y = lv_obj_get_style_transform_skew_y(obj, 0);
+    dsc->blend_mode = lv_obj_get_style_blend_mode(obj, 0);
+    dsc->antialias = disp_refr->antialiasing;
+    dsc->bitmap_mask_src = lv_obj_get_style_bitmap_mask_src(obj, 0);
+}
+
+/**
+ * Draw an object with `LV_OBJ_FLAG_LAYER_CACHE` by blending its cached layer.
+ * The layer is rendered again only if the content of the object has changed.
+ * @param layer             the layer to draw to
+ * @param obj               the object to draw
+ * @param layer_type        the type of the object's layer
+ * @param obj_draw_size     the coordinates of the object extended by its ext. draw size
+ * @param opa               the `opa_layered` of the object
+ * @return                  LV_RESULT_OK: drawn from the cache; LV_RESULT_INVALID: the cache couldn't be used
+ */
+static lv_result_t refr_obj_from_layer_cache(lv_layer_t * layer, lv_obj_t * obj, lv_layer_type_t layer_type,
+                                             const lv_area_t * obj_draw_size, lv_opa_t opa)
+{
+    /*Add the same transparent margin as `layer_get_area` to get the same edges when transformed*/
+    lv_area_t cache_area = *obj_draw_size;
+    if(layer_type == LV_LAYER_TYPE_TRANSFORM) lv_area_increase(&cache_area, 5, 5);
+
+    lv_draw_buf_t * cache = layer_cache_update(obj, &cache_area);
+    if(cache == NULL) return LV_RESULT_INVALID;
+
+    lv_draw_image_dsc_t layer_draw_dsc;
+    layer_draw_dsc_init(obj, &layer_draw_dsc, opa, &cache_area);
+    layer_draw_dsc.image_area = *obj_draw_size;
+    layer_draw_dsc.src = cache;
+    lv_draw_image(layer, &layer_draw_dsc, &cache_area);
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Render the whole object into its cached layer if the cache is outdated.
+ * @param obj               the object whose layer is cached
+ * @param cache_area        the area to render, at least the coordinates extended by the ext. draw size
+ * @return                  the draw buffer with the rendered object or NULL if it couldn't be allocated
+ */
+static lv_draw_buf_t * layer_cache_update(lv_obj_t * obj, const lv_area_t * cache_area)
+{
+    /*The object has a layer so `spec_attr` is allocated*/
+    _lv_obj_spec_attr_t * spec_attr = obj->spec_attr;
+    lv_draw_buf_t * cache = spec_attr->layer_cache;
+    int32_t w = lv_area_get_width(cache_area);
+    int32_t h = lv_area_get_height(cache_area);
+
+    if(cache && spec_attr->layer_cache_valid &&
+       (int32_t)cache->header.w == w && (int32_t)cache->header.h == h) {
+        return cache;
+    }
+
+    if(cache) {
+        /*The cache might be used by the image decoder, it will be changed*/
+        lv_image_cache_drop(cache);
+        if(lv_draw_buf_reshape(cache, LV_COLOR_FORMAT_ARGB8888, w, h, 0) == NULL) {
+            lv_draw_buf_destroy(cache);
+            cache = NULL;
+        }
+    }
+
+    if(cache == NULL) {
+        cache = lv_draw_buf_create(w, h, LV_COLOR_FORMAT_ARGB8888, 0);
+        spec_attr->layer_cache = cache;
+        if(cache == NULL) {
+            LV_LOG_WARN("Couldn't allocate the layer cache");
+            return NULL;
+        }
+    }
+
+    lv_draw_buf_clear(cache, NULL);
+
+    /*If the object is invalidated while it's rendered it needs to be rendered again*/
+    spec_attr->layer_cache_valid = 1;
+
+    /*Render the object like a snapshot, independently of the current layer.
+     *The layers created by the children are added after this layer, so dispatch only them.*/
+    lv_layer_t cache_layer;
+    lv_memzero(&cache_layer, sizeof(cache_layer));
+    cache_layer.draw_buf = cache;
+    cache_layer.buf_area = *cache_area;
+    cache_layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+    cache_layer._clip_area = *cache_area;
+
+    lv_layer_t * layer_head_old = disp_refr->layer_head;
+    disp_refr->layer_head = &cache_layer;
+
+    lv_obj_redraw(&cache_layer, obj);
+    while(cache_layer.draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        lv_draw_dispatch();
+    }
+    lv_draw_layer_deinit(&cache_layer);
+
+    disp_refr->layer_head = layer_head_old;
+
+    return cache;
+}
+
 static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h)
 {
     bool has_alpha = lv_color_format_has_alpha(disp->color_format);
@@ -978,6 +1400,12 @@ static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h)
 
     if(max_row > area_h) max_row = area_h;
 
+    /*Rotated by 90 or 270 degrees the rows are the columns of the buffer. Make them fit with their stride too.*/
+    if(disp->render_rotated &&
+       (disp->rotation == LV_DISPLAY_ROTATION_90 || disp->rotation == LV_DISPLAY_ROTATION_270)) {
+        while(max_row > 0 && lv_draw_buf_width_to_stride(max_row, cf) * area_w > disp->buf_act->data_size) max_row--;
+    }
+
     /*Round down the lines of draw_buf if rounding is added*/
     lv_area_t tmp;
     tmp.x1 = 0;
@@ -1021,15 +1449,12 @@ static void draw_buf_flush(lv_display_t * disp)
         lv_draw_dispatch();
     }
 
-    /* In double buffered mode wait until the other buffer is freed
-     * and driver is ready to receive the new buffer.
-     * If we need to wait here it means that the content of one buffer is being sent to display
-     * and other buffer already contains the new rendered image. */
-    if(lv_display_is_double_buffered(disp)) {
-        wait_for_flushing(disp_refr);
-    }
-
-    disp->flushing = 1;
+    /* Wait until the driver is ready to receive the new buffer.
+     * With a single buffer the previous flush needs to be finished (e.g. a tile in tiled mode).
+     * With N buffers at most N-1 flushes can be pending at a time. If we need to wait here
+     * it means that the other buffers are being sent to the display
+     * and this buffer already contains the new rendered image. */
+    wait_for_flush_queue(disp, disp->buf_cnt >= 2 ? disp->buf_cnt - 2 : 0);
 
     if(disp->last_area && disp->last_part) disp->flushing_last = 1;
     else disp->flushing_last = 0;
@@ -1037,16 +1462,30 @@ static void draw_buf_flush(lv_display_t * disp)
     bool flushing_last = disp->flushing_last;
 
     if(disp->flush_cb) {
-        call_flush_cb(disp, &disp->refreshed_area, layer->draw_buf->data);
-    }
-    /*If there are 2 buffers swap them. With direct mode swap only on the last area*/
-    if(lv_display_is_double_buffered(disp) && (disp->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT || flushing_last)) {
-        if(disp->buf_act == disp->buf_1) {
-            disp->buf_act = disp->buf_2;
-        }
-        else {
-            disp->buf_act = disp->buf_1;
+        disp->flush_start_cnt++;
+        disp->buf_flush_id[disp->buf_act_idx] = disp->flush_start_cnt;
+
+        /*In direct, full and tiled mode the previous frame is visible until this frame is shown,
+         *so its buffer can be reused only when this flush is ready*/
+        if(flushing_last && disp->buf_cnt >= 2 && disp->render_mode != LV_DISPLAY_RENDER_MODE_PARTIAL) {
+            disp->buf_flush_id[get_last_buf_idx(disp)] = disp->flush_start_cnt;
         }
+
+        uint32_t pending = get_pending_flush_cnt(disp);
+        disp->flush_monitor.flush_cnt++;
+        if(pending > disp->flush_monitor.pending_max) disp->flush_monitor.pending_max = pending;
+
+        /*A rotated buffer contains the rotated area of the display*/
+        lv_area_t flush_area = disp->refreshed_area;
+        if(layer->rotation != LV_DISPLAY_ROTATION_0) lv_display_rotate_area(disp, &flush_area);
+
+        call_flush_cb(disp, &flush_area, layer->draw_buf->data);
+    }
+    /*If there are more buffers continue in the next one. With direct and tiled mode change only on the last area*/
+    if(lv_display_is_double_buffered(disp) && ((disp->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT &&
+                                                disp->render_mode != LV_DISPLAY_RENDER_MODE_TILED) || flushing_last)) {
+        disp->buf_act_idx = (disp->buf_act_idx + 1) % disp->buf_cnt;
+        disp->buf_act = disp->bufs[disp->buf_act_idx];
     }
 }
 
@@ -1070,23 +1509,398 @@ static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t *
     LV_PROFILER_END;
 }
 
-static void wait_for_flushing(lv_display_t * disp)
+/**
+ * Wait until at most `max_pending` flushes are pending
+ * @param disp          pointer to a display
+ * @param max_pending   the number of flushes which can be still in progress when this function returns
+ */
+static void wait_for_flush_queue(lv_display_t * disp, uint32_t max_pending)
 {
+    if(get_pending_flush_cnt(disp) <= max_pending) return;
+
     LV_PROFILER_BEGIN;
     LV_LOG_TRACE("begin");
 
     lv_display_send_event(disp, LV_EVENT_FLUSH_WAIT_START, NULL);
+    uint32_t t_start = lv_tick_get();
 
     if(disp->flush_wait_cb) {
         disp->flush_wait_cb(disp);
+        /*All the flushes are finished when the callback returns*/
+        disp->flush_waited_cnt = disp->flush_start_cnt;
     }
     else {
-        while(disp->flushing);
+        while(get_pending_flush_cnt(disp) > max_pending);
     }
-    disp->flushing_last = 0;
+
+    if(get_pending_flush_cnt(disp) == 0) disp->flushing_last = 0;
+
+    uint32_t t = lv_tick_elaps(t_start);
+    disp->flush_monitor.wait_cnt++;
+    disp->flush_monitor.wait_time += t;
+    if(t > disp->flush_monitor.wait_time_max) disp->flush_monitor.wait_time_max = t;
 
     lv_display_send_event(disp, LV_EVENT_FLUSH_WAIT_FINISH, NULL);
 
     LV_LOG_TRACE("end");
     LV_PROFILER_END;
 }
+
+/**
+ * Get the number of flushes in progress
+ * @param disp      pointer to a display
+ * @return          the number of flushes started but not finished
+ */
+static uint32_t get_pending_flush_cnt(lv_display_t * disp)
+{
+    /*`flush_ready_cnt` is incremented in `lv_display_flush_ready` which might be called from an interrupt.
+     *A driver with `flush_wait_cb` might call it too, even after the wait, so both counters are considered*/
+    uint32_t ready_pending = disp->flush_start_cnt - disp->flush_ready_cnt;
+    uint32_t waited_pending = disp->flush_start_cnt - disp->flush_waited_cnt;
+    return LV_MIN(ready_pending, waited_pending);
+}
+
+/**
+ * Wait until the active buffer is not used by any pending flushes
+ * @param disp      pointer to a display
+ */
+static void wait_for_buf_act(lv_display_t * disp)
+{
+    /*The flushes started after the last flush using the buffer can be still in progress*/
+    wait_for_flush_queue(disp, disp->flush_start_cnt - disp->buf_flush_id[disp->buf_act_idx]);
+}
+
+/**
+ * Get the index of the buffer rendered before the active one
+ * @param disp      pointer to a display
+ * @return          index of the previous buffer
+ */
+static uint32_t get_last_buf_idx(lv_display_t * disp)
+{
+    return (disp->buf_act_idx + disp->buf_cnt - 1) % disp->buf_cnt;
+}
+
+/**
+ * Get the buffer rendered before the active one. It has the content of the last frame.
+ * @param disp      pointer to a display
+ * @return          pointer to the previous buffer
+ */
+static lv_draw_buf_t * get_last_buf(lv_display_t * disp)
+{
+    return disp->bufs[get_last_buf_idx(disp)];
+}
+
+#if LV_REFR_SCROLL_BLIT
+
+/**
+ * Check if the scrolling of an object can be done by copying the rendered pixels.
+ * It's possible if the object has a single color opaque background and nothing is drawn
+ * with masks, layers or on top of the children.
+ * @param disp      the display of the object
+ * @param obj       pointer to the scrolled object
+ * @return          true: the pixels can be copied
+ */
+static bool scroll_blit_is_supported(lv_display_t * disp, lv_obj_t * obj)
+{
+    /*In the other render modes the last frame is not available in the draw buffer*/
+    if(disp->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT &&
+       disp->render_mode != LV_DISPLAY_RENDER_MODE_TILED) return false;
+    if(lv_display_get_rotation(disp) != LV_DISPLAY_ROTATION_0) return false;
+    if(lv_color_format_get_size(disp->color_format) == 0) return false;
+
+    if(lv_obj_get_screen(obj) != disp->act_scr || disp->prev_scr != NULL) return false;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return false;
+
+    /*The background needs to be the same everywhere behind the children*/
+    if(lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) < LV_OPA_COVER) return false;
+    if(lv_obj_get_style_opa_recursive(obj, LV_PART_MAIN) < LV_OPA_COVER) return false;
+    if(lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN) != LV_GRAD_DIR_NONE) return false;
+    const lv_grad_dsc_t * grad = lv_obj_get_style_bg_grad(obj, LV_PART_MAIN);
+    if(grad && grad->dir != LV_GRAD_DIR_NONE) return false;
+    if(lv_obj_get_style_bg_image_src(obj, LV_PART_MAIN) != NULL) return false;
+    if(lv_obj_get_style_transform_width(obj, LV_PART_MAIN) != 0 ||
+       lv_obj_get_style_transform_height(obj, LV_PART_MAIN) != 0) return false;
+    if(lv_obj_get_style_outline_width(obj, LV_PART_MAIN) != 0 &&
+       lv_obj_get_style_outline_pad(obj, LV_PART_MAIN) < 0) return false;
+
+    /*Floating children are not scrolled*/
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        if(lv_obj_has_flag(lv_obj_get_child(obj, i), LV_OBJ_FLAG_FLOATING)) return false;
+    }
+
+    /*Nothing can be drawn with a layer or mask or on top of the children*/
+    lv_obj_t * parent = obj;
+    while(parent) {
+        if(_lv_obj_get_layer_type(parent) != LV_LAYER_TYPE_NONE) return false;
+        if(obj_has_custom_drawing(parent)) return false;
+        if(parent != obj) {
+            if(lv_obj_get_style_clip_corner(parent, LV_PART_MAIN)) return false;
+            if(lv_obj_get_style_border_post(parent, LV_PART_MAIN) &&
+               lv_obj_get_style_border_width(parent, LV_PART_MAIN) != 0) return false;
+        }
+        parent = lv_obj_get_parent(parent);
+    }
+
+    return true;
+}
+
+/**
+ * Get the area where the pixels of the last frame can be copied to when an object was scrolled
+ * @param obj       pointer to the scrolled object
+ * @param diff      how much the children of `obj` were moved since the last refresh
+ * @param blit_area store the area on the display where the pixels should be copied to
+ * @return          true: the pixels can be copied; false: the object needs to be redrawn
+ */
+static bool scroll_blit_get_area(lv_obj_t * obj, const lv_point_t * diff, lv_area_t * blit_area)
+{
+    if(!lv_display_is_invalidation_enabled(disp_refr)) return false;
+    if(!scroll_blit_is_supported(disp_refr, obj)) return false;
+
+    lv_area_t obj_area = obj->coords;
+    int32_t ext_size = _lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&obj_area, ext_size, ext_size);
+
+    /*Nothing else can change on the object*/
+    uint32_t i;
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(_lv_area_is_on(&disp_refr->inv_areas[i], &obj_area)) return false;
+    }
+
+    /*Nothing can be drawn on the object later*/
+    lv_obj_t * child = obj;
+    lv_obj_t * parent = lv_obj_get_parent(obj);
+    while(parent) {
+        lv_area_t hor_area;
+        lv_area_t ver_area;
+        lv_obj_get_scrollbar_area(parent, &hor_area, &ver_area);
+        if(lv_area_get_size(&hor_area) && _lv_area_is_on(&hor_area, &obj_area)) return false;
+        if(lv_area_get_size(&ver_area) && _lv_area_is_on(&ver_area, &obj_area)) return false;
+
+        uint32_t child_cnt = lv_obj_get_child_count(parent);
+        for(i = lv_obj_get_index(child) + 1; i < child_cnt; i++) {
+            if(obj_tree_is_on_area(lv_obj_get_child(parent, i), &obj_area)) return false;
+        }
+
+        child = parent;
+        parent = lv_obj_get_parent(parent);
+    }
+
+    lv_obj_t * layers[2] = {disp_refr->top_layer, disp_refr->sys_layer};
+    for(i = 0; i < 2; i++) {
+        if(layers[i] == NULL) continue;
+        if(lv_obj_get_style_bg_opa(layers[i], LV_PART_MAIN) > LV_OPA_MIN) return false;
+        uint32_t child_cnt = lv_obj_get_child_count(layers[i]);
+        uint32_t j;
+        for(j = 0; j < child_cnt; j++) {
+            if(obj_tree_is_on_area(lv_obj_get_child(layers[i], j), &obj_area)) return false;
+        }
+    }
+
+    /*Only the inner part of the background has a single color*/
+    int32_t w = lv_obj_get_width(obj);
+    int32_t h = lv_obj_get_height(obj);
+    int32_t radius = LV_MIN(lv_obj_get_style_radius(obj, LV_PART_MAIN), LV_MIN(w, h) / 2);
+    int32_t border_width = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    int32_t inner = LV_MAX(radius, border_width);
+
+    lv_area_t content_area = obj->coords;
+    lv_area_increase(&content_area, -inner, -inner);
+    if(!lv_obj_area_is_visible(obj, &content_area)) return false;
+
+    lv_area_t disp_area;
+    lv_area_set(&disp_area, 0, 0, lv_display_get_horizontal_resolution(disp_refr) - 1,
+                lv_display_get_vertical_resolution(disp_refr) - 1);
+    if(!_lv_area_intersect(&content_area, &content_area, &disp_area)) return false;
+
+    /*The pixels can be copied only where both the source and destination are in the content area*/
+    lv_area_t moved_area = content_area;
+    lv_area_move(&moved_area, diff->x, diff->y);
+    return _lv_area_intersect(blit_area, &content_area, &moved_area);
+}
+
+/**
+ * Check if an object might draw anything apart from the styles of the base object
+ * @param obj       pointer to an object
+ * @return          true: the object has a widget or user specific drawing
+ */
+static bool obj_has_custom_drawing(lv_obj_t * obj)
+{
+    const lv_obj_class_t * class_p = obj->class_p;
+    while(class_p && class_p != &lv_obj_class) {
+        if(class_p->event_cb) return true;
+        class_p = class_p->base_class;
+    }
+
+    uint32_t event_cnt = lv_obj_get_event_count(obj);
+    uint32_t i;
+    for(i = 0; i < event_cnt; i++) {
+        lv_event_dsc_t * dsc = lv_obj_get_event_dsc(obj, i);
+        uint32_t filter = dsc->filter & ~LV_EVENT_PREPROCESS;
+        if(filter == LV_EVENT_ALL) return true;
+        if(filter >= LV_EVENT_DRAW_MAIN_BEGIN && filter <= LV_EVENT_DRAW_TASK_ADDED) return true;
+    }
+
+    return false;
+}
+
+/**
+ * Check if an object or its children are drawn on an area
+ * @param obj       pointer to an object
+ * @param area      the area to check
+ * @return          true: something might be drawn on the area
+ */
+static bool obj_tree_is_on_area(lv_obj_t * obj, const lv_area_t * area)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return false;
+
+    lv_area_t obj_area = obj->coords;
+    int32_t ext_size = _lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&obj_area, ext_size, ext_size);
+    lv_obj_get_transformed_area(obj, &obj_area, LV_OBJ_POINT_TRANSFORM_FLAG_RECURSIVE);
+    if(_lv_area_is_on(&obj_area, area)) return true;
+
+    /*The children are clipped to the object unless its overflow is visible*/
+    if(!lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return false;
+
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        if(obj_tree_is_on_area(lv_obj_get_child(obj, i), area)) return true;
+    }
+
+    return false;
+}
+
+/**
+ * Invalidate the parts of the scrolled object which can't be copied from the last frame
+ * and save the area to copy. If copying is not possible invalidate the whole object.
+ */
+static void scroll_blit_prepare(void)
+{
+    lv_area_set(&disp_refr->scroll_blit_area, 0, 0, -1, -1);
+
+    lv_obj_t * obj = disp_refr->scroll_blit_obj;
+    if(obj == NULL) return;
+    disp_refr->scroll_blit_obj = NULL;
+
+    lv_point_t diff = disp_refr->scroll_blit_diff;
+    lv_area_t blit_area;
+    if(!scroll_blit_get_area(obj, &diff, &blit_area)) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    /*Redraw everything on the object apart from the copied area*/
+    lv_area_t obj_area = obj->coords;
+    int32_t ext_size = _lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&obj_area, ext_size, ext_size);
+
+    lv_area_t parts[4];
+    int8_t part_cnt = _lv_area_diff(parts, &obj_area, &blit_area);
+    int8_t i;
+    for(i = 0; i < part_cnt; i++) {
+        lv_obj_invalidate_area(obj, &parts[i]);
+    }
+
+    /*The scrollbars don't move with the content.
+     *Redraw them where they are now and where their old pixels will be copied.*/
+    lv_area_t hor_area;
+    lv_area_t ver_area;
+    lv_area_t a;
+    lv_obj_get_scrollbar_area(obj, &hor_area, &ver_area);
+    if(lv_area_get_size(&hor_area)) {
+        lv_area_set(&a, blit_area.x1, hor_area.y1, blit_area.x2, hor_area.y2);
+        lv_obj_invalidate_area(obj, &a);
+        lv_area_move(&a, 0, diff.y);
+        lv_obj_invalidate_area(obj, &a);
+    }
+    if(lv_area_get_size(&ver_area)) {
+        lv_area_set(&a, ver_area.x1, blit_area.y1, ver_area.x2, blit_area.y2);
+        lv_obj_invalidate_area(obj, &a);
+        lv_area_move(&a, diff.x, 0);
+        lv_obj_invalidate_area(obj, &a);
+    }
+
+    disp_refr->scroll_blit_area = blit_area;
+}
+
+/**
+ * Copy the pixels of the scrolled object from the last frame to their new place and flush them
+ */
+static void scroll_blit(void)
+{
+    lv_area_t * blit_area = &disp_refr->scroll_blit_area;
+    if(lv_area_get_size(blit_area) == 0) return;
+
+    /*Nothing to copy if the area will be redrawn anyway*/
+    uint32_t i;
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(disp_refr->inv_area_joined[i]) continue;
+        if(_lv_area_is_in(blit_area, &disp_refr->inv_areas[i], 0)) {
+            lv_area_set(blit_area, 0, 0, -1, -1);
+            return;
+        }
+    }
+
+    LV_PROFILER_BEGIN;
+
+    lv_layer_t * layer = disp_refr->layer_head;
+    layer->draw_buf = disp_refr->buf_act;
+    layer->buf_area.x1 = 0;
+    layer->buf_area.y1 = 0;
+    layer->buf_area.x2 = lv_display_get_horizontal_resolution(disp_refr) - 1;
+    layer->buf_area.y2 = lv_display_get_vertical_resolution(disp_refr) - 1;
+    layer_reshape_draw_buf(layer);
+
+    lv_point_t diff = disp_refr->scroll_blit_diff;
+    lv_area_t src_area = *blit_area;
+    lv_area_move(&src_area, -diff.x, -diff.y);
+
+    lv_draw_buf_t * buf = disp_refr->buf_act;
+    wait_for_buf_act(disp_refr);
+    if(lv_display_is_double_buffered(disp_refr)) {
+        /*The previous buffer has the last frame*/
+        lv_draw_buf_copy(buf, blit_area, get_last_buf(disp_refr), &src_area);
+    }
+    else {
+        /*The pixels are moved in the buffer being sent to the display*/
+        /*`lv_draw_buf_copy` can't handle overlapping areas so move the lines here.
+         *If the content moves down start from the bottom to not overwrite the lines to move.*/
+        uint32_t stride = buf->header.stride;
+        uint32_t px_size = lv_color_format_get_size(buf->header.cf);
+        uint32_t line_size = lv_area_get_width(blit_area) * px_size;
+        int32_t h = lv_area_get_height(blit_area);
+        uint8_t * dest = buf->data + blit_area->y1 * stride + blit_area->x1 * px_size;
+        const uint8_t * src = buf->data + src_area.y1 * stride + src_area.x1 * px_size;
+        int32_t y;
+        if(diff.y > 0) {
+            dest += (h - 1) * stride;
+            src += (h - 1) * stride;
+            for(y = 0; y < h; y++) {
+                lv_memmove(dest, src, line_size);
+                dest -= stride;
+                src -= stride;
+            }
+        }
+        else {
+            for(y = 0; y < h; y++) {
+                lv_memmove(dest, src, line_size);
+                dest += stride;
+                src += stride;
+            }
+        }
+    }
+
+    disp_refr->refreshed_area = *blit_area;
+    disp_refr->last_part = 0;
+    draw_buf_flush(disp_refr);
+
+    disp_refr->inv_monitor.blit_area_cnt++;
+    disp_refr->inv_monitor.blit_px_cnt += lv_area_get_size(blit_area);
+
+    LV_PROFILER_END;
+}
+
+#endif /*LV_REFR_SCROLL_BLIT*/
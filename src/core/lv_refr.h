@@ -75,6 +75,17 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj);
  */
 void _lv_inv_area(lv_display_t * disp, const lv_area_t * area_p);
 
+#if LV_REFR_SCROLL_BLIT
+/**
+ * Invalidate a scrolled object. If possible only the newly exposed parts will be redrawn
+ * and the already rendered pixels will be moved to their new place.
+ * @param obj   pointer to an object whose children were moved by `x` and `y`
+ * @param x     the horizontal scroll step
+ * @param y     the vertical scroll step
+ */
+void _lv_refr_invalidate_scroll(lv_obj_t * obj, int32_t x, int32_t y);
+#endif
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
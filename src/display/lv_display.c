@@ -84,9 +84,11 @@ lv_display_t * lv_display_create(int32_t hor_res, int32_t ver_res)
     disp->layer_head->color_format = disp->color_format;
 
     disp->inv_en_cnt = 1;
+    disp->inv_area_limit = LV_DEF_INV_AREA_LIMIT;
+    disp->inv_area_overhead = LV_DEF_INV_AREA_OVERHEAD;
     disp->last_activity_time = lv_tick_get();
 
-    _lv_ll_init(&disp->sync_areas, sizeof(lv_area_t));
+    _lv_ll_init(&disp->sync_areas, sizeof(lv_display_sync_area_t));
 
     lv_display_t * disp_def_tmp = disp_def;
     disp_def                 = disp; /*Temporarily change the default screen to create the default screens on the
@@ -183,10 +185,13 @@ void lv_display_delete(lv_display_t * disp)
     }
 
     _lv_ll_clear(&disp->sync_areas);
+    lv_free(disp->inv_areas);
+    lv_free(disp->inv_area_joined);
     _lv_ll_remove(disp_ll_p, disp);
     if(disp->refr_timer) lv_timer_delete(disp->refr_timer);
 
     if(disp->layer_deinit) disp->layer_deinit(disp, disp->layer_head);
+    lv_draw_layer_deinit(disp->layer_head);
     lv_free(disp->layer_head);
 
     lv_free(disp);
@@ -387,15 +392,41 @@ int32_t lv_display_get_dpi(const lv_display_t * disp)
  *--------------------*/
 
 void lv_display_set_draw_buffers(lv_display_t * disp, lv_draw_buf_t * buf1, lv_draw_buf_t * buf2)
+{
+    lv_draw_buf_t * bufs[2] = {buf1, buf2};
+    lv_display_set_draw_buffer_array(disp, bufs, buf2 ? 2 : (buf1 ? 1 : 0));
+}
+
+void lv_display_set_draw_buffer_array(lv_display_t * disp, lv_draw_buf_t * bufs[], uint32_t buf_cnt)
 {
     if(disp == NULL) disp = lv_display_get_default();
     if(disp == NULL) return;
 
-    disp->buf_1 = buf1;
-    disp->buf_2 = buf2;
+    LV_ASSERT_MSG(buf_cnt <= LV_DISPLAY_DRAW_BUF_MAX, "Too many draw buffers");
+    if(buf_cnt > LV_DISPLAY_DRAW_BUF_MAX) buf_cnt = LV_DISPLAY_DRAW_BUF_MAX;
+
+    uint32_t i;
+    for(i = 0; i < LV_DISPLAY_DRAW_BUF_MAX; i++) {
+        disp->bufs[i] = i < buf_cnt ? bufs[i] : NULL;
+        /*Consider the new buffers as already flushed*/
+        disp->buf_flush_id[i] = disp->flush_start_cnt;
+    }
+
+    disp->buf_cnt = buf_cnt;
+    disp->buf_1 = disp->bufs[0];
+    disp->buf_2 = disp->bufs[1];
+    disp->buf_act_idx = 0;
     disp->buf_act = disp->buf_1;
 }
 
+uint32_t lv_display_get_draw_buffer_count(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return 0;
+
+    return disp->buf_cnt;
+}
+
 void lv_display_set_buffers(lv_display_t * disp, void * buf1, void * buf2, uint32_t buf_size,
                             lv_display_render_mode_t render_mode)
 {
@@ -418,7 +449,8 @@ void lv_display_set_buffers(lv_display_t * disp, void * buf1, void * buf2, uint3
     }
     else {
         LV_ASSERT_FORMAT_MSG(stride * h <= buf_size, "%s mode requires screen sized buffer(s)",
-                             render_mode == LV_DISPLAY_RENDER_MODE_FULL ? "FULL" : "DIRECT");
+                             render_mode == LV_DISPLAY_RENDER_MODE_FULL ? "FULL" :
+                             render_mode == LV_DISPLAY_RENDER_MODE_TILED ? "TILED" : "DIRECT");
     }
 
     lv_draw_buf_init(&disp->_static_buf1, w, h, cf, stride, buf1, buf_size);
@@ -457,8 +489,10 @@ void lv_display_set_color_format(lv_display_t * disp, lv_color_format_t color_fo
 
     disp->color_format = color_format;
     disp->layer_head->color_format = color_format;
-    if(disp->buf_1) disp->buf_1->header.cf = color_format;
-    if(disp->buf_2) disp->buf_2->header.cf = color_format;
+    uint32_t i;
+    for(i = 0; i < disp->buf_cnt; i++) {
+        if(disp->bufs[i]) disp->bufs[i]->header.cf = color_format;
+    }
 
     lv_display_send_event(disp, LV_EVENT_COLOR_FORMAT_CHANGED, NULL);
 }
@@ -489,7 +523,7 @@ bool lv_display_get_antialiasing(lv_display_t * disp)
 
 LV_ATTRIBUTE_FLUSH_READY void lv_display_flush_ready(lv_display_t * disp)
 {
-    disp->flushing = 0;
+    disp->flush_ready_cnt++;
 }
 
 LV_ATTRIBUTE_FLUSH_READY bool lv_display_flush_is_last(lv_display_t * disp)
@@ -499,7 +533,7 @@ LV_ATTRIBUTE_FLUSH_READY bool lv_display_flush_is_last(lv_display_t * disp)
 
 bool lv_display_is_double_buffered(lv_display_t * disp)
 {
-    return disp->buf_2 != NULL;
+    return disp->buf_cnt >= 2;
 }
 
 /*---------------------
@@ -792,6 +826,18 @@ void lv_display_set_rotation(lv_display_t * disp, lv_display_rotation_t rotation
     update_resolution(disp);
 }
 
+void lv_display_set_render_rotated(lv_display_t * disp, bool en)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    if(disp->render_rotated == en) return;
+    disp->render_rotated = en;
+
+    /*The layout of the buffers has changed so everything needs to be redrawn*/
+    lv_obj_invalidate(disp->sys_layer);
+}
+
 lv_display_rotation_t lv_display_get_rotation(lv_display_t * disp)
 {
     if(disp == NULL) disp = lv_display_get_default();
@@ -799,6 +845,13 @@ lv_display_rotation_t lv_display_get_rotation(lv_display_t * disp)
     return disp->rotation;
 }
 
+bool lv_display_get_render_rotated(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return false;
+    return disp->render_rotated;
+}
+
 void lv_display_set_theme(lv_display_t * disp, lv_theme_t * th)
 {
     if(!disp) disp = lv_display_get_default();
@@ -872,6 +925,76 @@ bool lv_display_is_invalidation_enabled(lv_display_t * disp)
     return (disp->inv_en_cnt > 0);
 }
 
+void lv_display_set_inv_area_limit(lv_display_t * disp, uint32_t limit)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return;
+
+    disp->inv_area_limit = LV_MAX(limit, 1);
+}
+
+uint32_t lv_display_get_inv_area_limit(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return 0;
+
+    return disp->inv_area_limit;
+}
+
+void lv_display_set_inv_area_overhead(lv_display_t * disp, uint32_t overhead)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return;
+
+    disp->inv_area_overhead = overhead;
+}
+
+uint32_t lv_display_get_inv_area_overhead(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return 0;
+
+    return disp->inv_area_overhead;
+}
+
+void lv_display_get_inv_monitor(lv_display_t * disp, lv_display_inv_monitor_t * mon)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) {
+        lv_memzero(mon, sizeof(lv_display_inv_monitor_t));
+        return;
+    }
+
+    *mon = disp->inv_monitor;
+}
+
+void lv_display_reset_inv_monitor(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return;
+
+    lv_memzero(&disp->inv_monitor, sizeof(lv_display_inv_monitor_t));
+}
+
+void lv_display_get_flush_monitor(lv_display_t * disp, lv_display_flush_monitor_t * mon)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) {
+        lv_memzero(mon, sizeof(lv_display_flush_monitor_t));
+        return;
+    }
+
+    *mon = disp->flush_monitor;
+}
+
+void lv_display_reset_flush_monitor(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return;
+
+    lv_memzero(&disp->flush_monitor, sizeof(lv_display_flush_monitor_t));
+}
+
 lv_timer_t * lv_display_get_refr_timer(lv_display_t * disp)
 {
     if(!disp) disp = lv_display_get_default();
@@ -987,8 +1110,6 @@ static void update_resolution(lv_display_t * disp)
     lv_area_set_height(&disp->bottom_layer->coords, ver_res);
     lv_obj_send_event(disp->bottom_layer, LV_EVENT_SIZE_CHANGED, &prev_coords);
 
-    lv_memzero(disp->inv_areas, sizeof(disp->inv_areas));
-    lv_memzero(disp->inv_area_joined, sizeof(disp->inv_area_joined));
     disp->inv_p = 0;
     lv_obj_invalidate(disp->sys_layer);
 
@@ -27,6 +27,10 @@ extern "C" {
 #define LV_ATTRIBUTE_FLUSH_READY
 #endif
 
+#ifndef LV_DISPLAY_DRAW_BUF_MAX
+#define LV_DISPLAY_DRAW_BUF_MAX 4 /*Max. number of draw buffers of a display*/
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -57,6 +61,13 @@ typedef enum {
      * With 2 buffers in flush_cb only and address change is required.
      */
     LV_DISPLAY_RENDER_MODE_FULL,
+
+    /**
+     * The buffer(s) has to be screen sized and LVGL will render into the correct location of the buffer as in DIRECT mode.
+     * The invalidated areas are cut into `LV_DRAW_TILE_SIZE` sized tiles which can be rendered in parallel
+     * by the draw units. Each tile is flushed as soon as it's ready.
+     */
+    LV_DISPLAY_RENDER_MODE_TILED,
 } lv_display_render_mode_t;
 
 typedef enum {
@@ -81,6 +92,31 @@ typedef enum {
 typedef void (*lv_display_flush_cb_t)(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 typedef void (*lv_display_flush_wait_cb_t)(lv_display_t * disp);
 
+/**
+ * Statistics about the invalidated areas of a display
+ */
+typedef struct {
+    uint32_t inv_area_cnt;      /**< Number of areas stored by the invalidations*/
+    uint32_t inv_area_max;      /**< The most areas stored at once*/
+    uint32_t overflow_cnt;      /**< Number of areas merged into a stored area because the limit was reached*/
+    uint32_t joined_cnt;        /**< Number of areas joined into other areas before rendering*/
+    uint32_t refr_area_cnt;     /**< Number of rendered areas*/
+    uint32_t refr_px_cnt;       /**< Sum of the size of the rendered areas*/
+    uint32_t blit_area_cnt;     /**< Number of areas copied from the last frame instead of rendering (scrolling)*/
+    uint32_t blit_px_cnt;       /**< Sum of the size of the copied areas*/
+} lv_display_inv_monitor_t;
+
+/**
+ * Statistics about flushing the draw buffers of a display
+ */
+typedef struct {
+    uint32_t flush_cnt;         /**< Number of `flush_cb` calls*/
+    uint32_t pending_max;       /**< The most flushes in progress at once*/
+    uint32_t wait_cnt;          /**< Number of times rendering waited for a buffer to be flushed*/
+    uint32_t wait_time;         /**< Sum of the waiting times [ms]*/
+    uint32_t wait_time_max;     /**< The longest wait [ms]*/
+} lv_display_flush_monitor_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -158,6 +194,17 @@ void lv_display_set_offset(lv_display_t * disp, int32_t x, int32_t y);
  */
 void lv_display_set_rotation(lv_display_t * disp, lv_display_rotation_t rotation);
 
+/**
+ * Render directly in the orientation of the display's hardware instead of rotating the rendered areas later.
+ * If enabled and the display is rotated, the draw buffers are laid out in the native (not rotated) orientation
+ * and `flush_cb` receives the area already rotated (as `lv_display_rotate_area()` would do it),
+ * so the driver doesn't need to rotate the pixels and doesn't need an extra buffer for it.
+ * Only the software renderer supports it.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @param en        true: render rotated; false: render as seen by the user and let the driver rotate (default)
+ */
+void lv_display_set_render_rotated(lv_display_t * disp, bool en);
+
 /**
  * Set the DPI (dot per inch) of the display.
  * dpi = sqrt(hor_res^2 + ver_res^2) / diagonal"
@@ -215,6 +262,13 @@ int32_t lv_display_get_offset_y(const lv_display_t * disp);
  */
 lv_display_rotation_t lv_display_get_rotation(lv_display_t * disp);
 
+/**
+ * Get if the display renders directly in the orientation of the display's hardware.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          true: rendering rotated; false: not rendering rotated
+ */
+bool lv_display_get_render_rotated(lv_display_t * disp);
+
 /**
  * Get the DPI of the display
  * @param disp      pointer to a display (NULL to use the default display)
@@ -232,7 +286,7 @@ int32_t lv_display_get_dpi(const lv_display_t * disp);
  * @param buf1              first buffer
  * @param buf2              second buffer (can be `NULL`)
  * @param buf_size          buffer size in byte
- * @param render_mode       LV_DISPLAY_RENDER_MODE_PARTIAL/DIRECT/FULL
+ * @param render_mode       LV_DISPLAY_RENDER_MODE_PARTIAL/DIRECT/FULL/TILED
  */
 void lv_display_set_buffers(lv_display_t * disp, void * buf1, void * buf2, uint32_t buf_size,
                             lv_display_render_mode_t render_mode);
@@ -247,10 +301,28 @@ void lv_display_set_buffers(lv_display_t * disp, void * buf1, void * buf2, uint3
  */
 void lv_display_set_draw_buffers(lv_display_t * disp, lv_draw_buf_t * buf1, lv_draw_buf_t * buf2);
 
+/**
+ * Set any number of draw buffers for a display (up to `LV_DISPLAY_DRAW_BUF_MAX`).
+ * The buffers are rendered in turn. With more than 2 buffers `flush_cb` can be called
+ * while the earlier flushes are still in progress, that is up to `buf_cnt - 1` flushes can be queued.
+ * `lv_display_flush_ready()` needs to be called for each flush in the same order as `flush_cb` was called.
+ * @param disp              pointer to a display
+ * @param bufs              array of draw buffers. Only the pointers are saved so the array can be a local variable.
+ * @param buf_cnt           number of buffers in `bufs`
+ */
+void lv_display_set_draw_buffer_array(lv_display_t * disp, lv_draw_buf_t * bufs[], uint32_t buf_cnt);
+
+/**
+ * Get the number of draw buffers of a display
+ * @param disp              pointer to a display (NULL to use the default display)
+ * @return                  the number of draw buffers
+ */
+uint32_t lv_display_get_draw_buffer_count(lv_display_t * disp);
+
 /**
  * Set display render mode
  * @param disp              pointer to a display
- * @param render_mode       LV_DISPLAY_RENDER_MODE_PARTIAL/DIRECT/FULL
+ * @param render_mode       LV_DISPLAY_RENDER_MODE_PARTIAL/DIRECT/FULL/TILED
  */
 void lv_display_set_render_mode(lv_display_t * disp, lv_display_render_mode_t render_mode);
 
@@ -264,7 +336,8 @@ void lv_display_set_flush_cb(lv_display_t * disp, lv_display_flush_cb_t flush_cb
 /**
  * Set a callback to be used while LVGL is waiting flushing to be finished.
  * It can do any complex logic to wait, including semaphores, mutexes, polling flags, etc.
- * If not set the `disp->flushing` flag is used which can be cleared with `lv_display_flush_ready()`
+ * When it returns all the flushes in progress are considered to be finished.
+ * If not set LVGL waits until `lv_display_flush_ready()` is called.
  * @param disp      pointer to a display
  * @param wait_cb   a callback to call while LVGL is waiting for flush ready.
  *                  If NULL `lv_display_flush_ready()` can be used to signal that flushing is ready.
@@ -308,7 +381,8 @@ bool lv_display_get_antialiasing(lv_display_t * disp);
 //! @cond Doxygen_Suppress
 
 /**
- * Call from the display driver when the flushing is finished
+ * Call from the display driver when the flushing is finished.
+ * If multiple flushes are in progress the oldest one is marked as finished.
  * @param disp      pointer to display whose `flush_cb` was called
  */
 LV_ATTRIBUTE_FLUSH_READY void lv_display_flush_ready(lv_display_t * disp);
@@ -324,6 +398,11 @@ LV_ATTRIBUTE_FLUSH_READY bool lv_display_flush_is_last(lv_display_t * disp);
 
 //! @endcond
 
+/**
+ * Check if the display has at least two draw buffers
+ * @param disp      pointer to display
+ * @return          true: rendering can continue in an other buffer while flushing
+ */
 bool lv_display_is_double_buffered(lv_display_t * disp);
 
 /*---------------------
@@ -516,6 +595,64 @@ void lv_display_enable_invalidation(lv_display_t * disp, bool en);
  */
 bool lv_display_is_invalidation_enabled(lv_display_t * disp);
 
+/**
+ * Set the max. number of invalidated areas stored until the next refresh.
+ * The buffer of the areas grows dynamically up to this limit.
+ * If it's reached, the new areas are merged into the stored area which grows the least.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @param limit     max. number of areas (at least 1). The default is `LV_DEF_INV_AREA_LIMIT`
+ */
+void lv_display_set_inv_area_limit(lv_display_t * disp, uint32_t limit);
+
+/**
+ * Get the max. number of invalidated areas stored until the next refresh.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          max. number of areas
+ */
+uint32_t lv_display_get_inv_area_limit(lv_display_t * disp);
+
+/**
+ * Set the cost of refreshing an area apart from drawing its pixels (e.g. walking the widgets, flushing).
+ * Before rendering two invalidated areas are joined if the size of the joined area
+ * is smaller than the size of the two areas plus this overhead.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @param overhead  the cost in pixels. The default is `LV_DEF_INV_AREA_OVERHEAD`
+ */
+void lv_display_set_inv_area_overhead(lv_display_t * disp, uint32_t overhead);
+
+/**
+ * Get the cost of refreshing an area apart from drawing its pixels.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          the cost in pixels
+ */
+uint32_t lv_display_get_inv_area_overhead(lv_display_t * disp);
+
+/**
+ * Get the statistics about the invalidated and refreshed areas of a display.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @param mon       store the statistics here
+ */
+void lv_display_get_inv_monitor(lv_display_t * disp, lv_display_inv_monitor_t * mon);
+
+/**
+ * Reset the statistics about the invalidated and refreshed areas of a display.
+ * @param disp      pointer to a display (NULL to use the default display)
+ */
+void lv_display_reset_inv_monitor(lv_display_t * disp);
+
+/**
+ * Get the statistics about flushing the draw buffers of a display.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @param mon       store the statistics here
+ */
+void lv_display_get_flush_monitor(lv_display_t * disp, lv_display_flush_monitor_t * mon);
+
+/**
+ * Reset the statistics about flushing the draw buffers of a display.
+ * @param disp      pointer to a display (NULL to use the default display)
+ */
+void lv_display_reset_flush_monitor(lv_display_t * disp);
+
 /**
  * Get a pointer to the screen refresher timer to
  * modify its parameters with `lv_timer_...` functions.
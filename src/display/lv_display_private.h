@@ -22,13 +22,19 @@ extern "C" {
  *      DEFINES
  *********************/
 #ifndef LV_INV_BUF_SIZE
-#define LV_INV_BUF_SIZE 32 /*Buffer size for invalid areas*/
+#define LV_INV_BUF_SIZE 32 /*Initial buffer size for invalid areas. It grows up to `inv_area_limit` if needed*/
 #endif
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/** An area rendered in a frame which needs to be copied to the other draw buffers (DIRECT and TILED mode)*/
+typedef struct {
+    lv_area_t area;
+    uint32_t buf_mask;      /**< 1 bit for each draw buffer which doesn't have the new content yet*/
+} lv_display_sync_area_t;
+
 struct _lv_display_t {
 
     /*---------------------
@@ -61,8 +67,13 @@ struct _lv_display_t {
     lv_draw_buf_t * buf_1;
     lv_draw_buf_t * buf_2;
 
+    /** All the draw buffers. `buf_1` and `buf_2` are the first two of them.*/
+    lv_draw_buf_t * bufs[LV_DISPLAY_DRAW_BUF_MAX];
+    uint32_t buf_cnt;
+
     /** Internal, used by the library*/
     lv_draw_buf_t * buf_act;
+    uint32_t buf_act_idx;           /**< Index of `buf_act` in `bufs`*/
 
     /** MANDATORY: Write the internal buffer (draw_buf) to the display. 'lv_display_flush_ready()' has to be
      * called when finished*/
@@ -71,11 +82,21 @@ struct _lv_display_t {
     /**
      * Used to wait while flushing is ready.
      * It can do any complex logic to wait, including semaphores, mutexes, polling flags, etc.
-     * If not set `flushing` flag is used which can be cleared with `lv_display_flush_ready()`*/
+     * If not set LVGL waits until `lv_display_flush_ready()` is called*/
     lv_display_flush_wait_cb_t flush_wait_cb;
 
-    /*1: flushing is in progress. (It can't be a bit field because when it's cleared from IRQ Read-Modify-Write issue might occur)*/
-    volatile int flushing;
+    /*Number of started (`flush_cb` calls) and finished (`lv_display_flush_ready()` calls) flushes.
+     *Their difference is the number of flushes in progress. `flush_ready_cnt` is written only in
+     *`lv_display_flush_ready()` to allow calling it from an IRQ (no Read-Modify-Write issue).*/
+    volatile uint32_t flush_start_cnt;
+    volatile uint32_t flush_ready_cnt;
+
+    /*`flush_start_cnt` when `flush_wait_cb` last returned, i.e. all these flushes are finished*/
+    uint32_t flush_waited_cnt;
+
+    /*`flush_start_cnt` after the last flush of each buffer. The buffer is free if `flush_ready_cnt` has reached it.*/
+    uint32_t buf_flush_id[LV_DISPLAY_DRAW_BUF_MAX];
+    lv_display_flush_monitor_t flush_monitor;
 
     /*1: It was the last chunk to flush. (It can't be a bit field because when it's cleared from IRQ Read-Modify-Write issue might occur)*/
     volatile int flushing_last;
@@ -91,14 +112,25 @@ struct _lv_display_t {
     lv_color_format_t   color_format;
 
     /** Invalidated (marked to redraw) areas*/
-    lv_area_t inv_areas[LV_INV_BUF_SIZE];
-    uint8_t inv_area_joined[LV_INV_BUF_SIZE];
+    lv_area_t * inv_areas;
+    uint8_t * inv_area_joined;
     uint32_t inv_p;
+    uint32_t inv_area_capacity;     /**< Number of areas `inv_areas` and `inv_area_joined` can store*/
+    uint32_t inv_area_limit;        /**< Max. number of areas before merging. @see lv_display_set_inv_area_limit*/
+    uint32_t inv_area_overhead;     /**< Cost of an area in pixels. @see lv_display_set_inv_area_overhead*/
+    lv_display_inv_monitor_t inv_monitor;
     int32_t inv_en_cnt;
 
-    /** Double buffer sync areas (redrawn during last refresh) */
+    /** Areas redrawn in the last refreshes which are not copied to all draw buffers yet (`lv_display_sync_area_t`)*/
     lv_ll_t sync_areas;
 
+#if LV_REFR_SCROLL_BLIT
+    /** Scrolling to do by copying the rendered pixels*/
+    lv_obj_t * scroll_blit_obj;     /**< The object scrolled since the last refresh*/
+    lv_point_t scroll_blit_diff;    /**< The sum of its scroll steps*/
+    lv_area_t scroll_blit_area;     /**< The area to copy from the last frame instead of rendering it*/
+#endif
+
     lv_draw_buf_t _static_buf1; /*Used when user pass in a raw buffer as display draw buffer*/
     lv_draw_buf_t _static_buf2;
     /*---------------------
@@ -136,6 +168,7 @@ struct _lv_display_t {
 
     uint32_t sw_rotate : 1; /**< 1: use software rotation (slower)*/
     uint32_t rotation  : 2; /**< Element of  @lv_display_rotation_t*/
+    uint32_t render_rotated : 1; /**< 1: render directly in the orientation of the display's hardware*/
 
     /**< The theme assigned to the screen*/
     lv_theme_t * theme;
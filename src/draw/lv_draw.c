@@ -18,14 +18,63 @@
  *********************/
 #define _draw_info LV_GLOBAL_DEFAULT()->draw_info
 
+/*The task index divides the layer into at most this many columns and rows*/
+#define TASK_INDEX_GRID_MAX     16
+
+/*The minimal width and height of a grid cell in pixels*/
+#define TASK_INDEX_CELL_MIN     32
+
+/*Alignment of the allocations in the arena of the layers*/
+#define ARENA_ALIGN             8
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    lv_draw_task_t ** tasks;
+    uint32_t cnt;
+    uint32_t capacity;
+} task_index_cell_t;
+
+/**
+ * A coarse grid over the layer. Each cell stores the draw tasks touching it.
+ * This way only the tasks around a given area need to be checked
+ * to find the overlapping ones instead of all the tasks of the layer.
+ */
+struct _lv_draw_task_index_t {
+    lv_area_t area;         /**< The area covered by the grid. Tasks outside are clamped to the border cells*/
+    int32_t cell_w;
+    int32_t cell_h;
+    int32_t col_cnt;
+    int32_t row_cnt;
+    uint32_t seq_cnt;       /**< The sequence number of the last added task*/
+    task_index_cell_t cells[1];
+};
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check);
+static lv_draw_task_index_t * task_index_create(const lv_area_t * area);
+static void task_index_delete(lv_layer_t * layer);
+static void task_index_start(lv_layer_t * layer);
+static void task_index_insert(lv_layer_t * layer, lv_draw_task_t * t);
+static void task_index_remove(lv_draw_task_index_t * index, lv_draw_task_t * t);
+static bool task_index_is_independent(lv_draw_task_index_t * index, lv_draw_task_t * t_check);
+static uint32_t task_index_get_dependent_count(lv_draw_task_index_t * index, lv_draw_task_t * t_check);
+static void arena_reset(lv_layer_t * layer, bool keep_buf);
+static lv_draw_buf_t * layer_buf_get(uint32_t w, uint32_t h, lv_color_format_t cf);
+static void layer_buf_release(lv_draw_buf_t * buf);
+#if LV_DRAW_LAYER_POOL_SIZE
+    static lv_draw_buf_t * layer_pool_remove(uint32_t idx);
+    static uint32_t layer_pool_get_bucket_size(uint32_t size);
+#endif
+#if LV_DRAW_CULL_OCCLUDED_TASKS
+    static bool get_cover_area(const lv_draw_task_t * t, lv_area_t * cover_area);
+    static void cull_occluded_tasks(lv_layer_t * layer, lv_draw_task_t * t_cover);
+    static void cull_task(lv_draw_task_t * t, const lv_area_t * cover_area);
+#endif
 
 static inline uint32_t get_layer_size_kb(uint32_t size_byte)
 {
@@ -60,6 +109,8 @@ void lv_draw_deinit(void)
     lv_thread_sync_delete(&_draw_info.sync);
 #endif
 
+    lv_draw_layer_pool_flush();
+
     lv_draw_unit_t * u = _draw_info.unit_head;
     while(u) {
         lv_draw_unit_t * cur_unit = u;
@@ -84,22 +135,37 @@ void * lv_draw_create_unit(size_t size)
 lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords)
 {
     LV_PROFILER_BEGIN;
-    lv_draw_task_t * new_task = lv_malloc_zeroed(sizeof(lv_draw_task_t));
+    lv_draw_task_t * new_task = lv_draw_layer_malloc(layer, sizeof(lv_draw_task_t));
+    LV_ASSERT_MALLOC(new_task);
+    lv_memzero(new_task, sizeof(lv_draw_task_t));
 
     new_task->area = *coords;
     new_task->_real_area = *coords;
     new_task->clip_area = layer->_clip_area;
     new_task->state = LV_DRAW_TASK_STATE_QUEUED;
 
-    /*Find the tail*/
+#if LV_USE_DRAW_MONITOR
+    lv_area_t visible_area;
+    _draw_info.task_monitor.task_cnt++;
+    if(_lv_area_intersect(&visible_area, coords, &layer->_clip_area)) {
+        _draw_info.task_monitor.task_px_cnt += lv_area_get_size(&visible_area);
+    }
+#endif
+
     if(layer->draw_task_head == NULL) {
+        /*Start indexing the new batch of draw tasks.
+         *It's done only here to be sure that the index contains all the tasks of the layer*/
+        task_index_start(layer);
         layer->draw_task_head = new_task;
     }
     else {
-        lv_draw_task_t * tail = layer->draw_task_head;
-        while(tail->next) tail = tail->next;
+        layer->draw_task_tail->next = new_task;
+    }
+    layer->draw_task_tail = new_task;
 
-        tail->next = new_task;
+    if(layer->_task_index) {
+        layer->_task_index->seq_cnt++;
+        new_task->_index_seq = layer->_task_index->seq_cnt;
     }
 
     LV_PROFILER_END;
@@ -126,6 +192,16 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
             info->task_running = false;
         }
 
+        /*Add the task to the index only here as its real area might be set after `lv_draw_add_task`
+         *or modified in the event*/
+        if(layer->_task_index && t->_index_seq) {
+            task_index_insert(layer, t);
+        }
+
+#if LV_DRAW_CULL_OCCLUDED_TASKS
+        cull_occluded_tasks(layer, t);
+#endif
+
         /*Let the draw units set their preference score*/
         t->preference_score = 100;
         t->preferred_draw_unit_id = 0;
@@ -135,9 +211,24 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
             u = u->next;
         }
 
+        /*With culling the tasks are dispatched only when the layer is finished,
+         *else the draw units would render the tasks before knowing if they are covered.
+         *Just make the waiting for dispatch requests return.*/
+#if LV_DRAW_CULL_OCCLUDED_TASKS
+        lv_draw_dispatch_request();
+#else
         lv_draw_dispatch();
+#endif
     }
     else {
+        if(layer->_task_index && t->_index_seq) {
+            task_index_insert(layer, t);
+        }
+
+#if LV_DRAW_CULL_OCCLUDED_TASKS
+        cull_occluded_tasks(layer, t);
+#endif
+
         /*Let the draw units set their preference score*/
         t->preference_score = 100;
         t->preferred_draw_unit_id = 0;
@@ -173,14 +264,19 @@ void lv_draw_dispatch(void)
 bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
 {
     LV_PROFILER_BEGIN;
-    /*Remove the finished tasks first*/
+    /*Remove the finished tasks first. Only the already checked tasks can be finished by a draw unit.
+     *The tasks after them are finished only if they were culled. Remove these too if they are found.*/
     lv_draw_task_t * t_prev = NULL;
     lv_draw_task_t * t = layer->draw_task_head;
-    while(t) {
+    bool checked = layer->_dispatch_pos != NULL;
+    while(t && (checked || t->state == LV_DRAW_TASK_STATE_READY)) {
+        if(t == layer->_dispatch_pos) checked = false;
         lv_draw_task_t * t_next = t->next;
         if(t->state == LV_DRAW_TASK_STATE_READY) {
             if(t_prev) t_prev->next = t->next;      /*Remove by it by assigning the next task to the previous*/
             else layer->draw_task_head = t_next;    /*If it was the head, set the next as head*/
+            if(layer->draw_task_tail == t) layer->draw_task_tail = t_prev;
+            if(layer->_dispatch_pos == t) layer->_dispatch_pos = t_prev;
 
             /*If it was layer drawing free the layer too*/
             if(t->type == LV_DRAW_TASK_TYPE_LAYER) {
@@ -194,7 +290,7 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
 
                     _draw_info.used_memory_for_layers_kb -= get_layer_size_kb(layer_size_byte);
                     LV_LOG_INFO("Layer memory used: %" LV_PRIu32 " kB\n", _draw_info.used_memory_for_layers_kb);
-                    lv_draw_buf_destroy(layer_drawn->draw_buf);
+                    layer_buf_release(layer_drawn->draw_buf);
                     layer_drawn->draw_buf = NULL;
                 }
 
@@ -210,17 +306,20 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
                     }
 
                     if(disp->layer_deinit) disp->layer_deinit(disp, layer_drawn);
+                    lv_draw_layer_deinit(layer_drawn);
                     lv_free(layer_drawn);
                 }
             }
             lv_draw_label_dsc_t * draw_label_dsc = lv_draw_task_get_label_dsc(t);
             if(draw_label_dsc && draw_label_dsc->text_local) {
-                lv_free((void *)draw_label_dsc->text);
+                lv_draw_layer_free(layer, (void *)draw_label_dsc->text);
                 draw_label_dsc->text = NULL;
             }
 
-            lv_free(t->draw_dsc);
-            lv_free(t);
+            if(layer->_task_index && t->_index_seq) task_index_remove(layer->_task_index, t);
+
+            lv_draw_layer_free(layer, t->draw_dsc);
+            lv_draw_layer_free(layer, t);
         }
         else {
             t_prev = t;
@@ -228,6 +327,14 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
         t = t_next;
     }
 
+    /*All tasks are finished, the index and the memory of the tasks are not required anymore.
+     *Keep the index and the arena's buffer for the layers of a display as new tasks will be added to them soon.
+     *These are freed by `lv_draw_layer_deinit()` when the layer is deleted.*/
+    if(layer->draw_task_head == NULL) {
+        if(layer->_task_index && disp == NULL) task_index_delete(layer);
+        arena_reset(layer, disp != NULL);
+    }
+
     bool render_running = false;
 
     /*This layer is ready, enable blending its buffer*/
@@ -297,8 +404,13 @@ lv_draw_task_t * lv_draw_get_next_available_task(lv_layer_t * layer, lv_draw_tas
         }
     }
 
+    /*Mark the tasks as checked from the saved position. The finished tasks are searched only up to here.*/
+    bool checked = t_prev == NULL && layer->_dispatch_pos != NULL;
     lv_draw_task_t * t = t_prev ? t_prev->next : layer->draw_task_head;
     while(t) {
+        if(t_prev == NULL && !checked) layer->_dispatch_pos = t;
+        else if(t == layer->_dispatch_pos) checked = false;
+
         /*Find a queued and independent task*/
         if(t->state == LV_DRAW_TASK_STATE_QUEUED &&
            (t->preferred_draw_unit_id == LV_DRAW_UNIT_ID_ANY || t->preferred_draw_unit_id == draw_unit_id) &&
@@ -321,6 +433,14 @@ uint32_t lv_draw_get_dependent_count(lv_draw_task_t * t_check)
     LV_PROFILER_BEGIN;
     uint32_t cnt = 0;
 
+    lv_draw_dsc_base_t * base_dsc = t_check->draw_dsc;
+    lv_layer_t * layer = base_dsc ? base_dsc->layer : NULL;
+    if(layer && layer->_task_index && t_check->_index_seq) {
+        cnt = task_index_get_dependent_count(layer->_task_index, t_check);
+        LV_PROFILER_END;
+        return cnt;
+    }
+
     lv_draw_task_t * t = t_check->next;
     while(t) {
         if((t->state == LV_DRAW_TASK_STATE_QUEUED || t->state == LV_DRAW_TASK_STATE_WAITING) &&
@@ -370,7 +490,7 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer)
     int32_t h = lv_area_get_height(&layer->buf_area);
     uint32_t layer_size_byte = h * lv_draw_buf_width_to_stride(w, layer->color_format);
 
-    layer->draw_buf = lv_draw_buf_create(w, h, layer->color_format, 0);
+    layer->draw_buf = layer_buf_get(w, h, layer->color_format);
 
     if(layer->draw_buf == NULL) {
         LV_LOG_WARN("Allocating layer buffer failed. Try later");
@@ -387,11 +507,136 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer)
     return layer->draw_buf->data;
 }
 
+void * lv_draw_layer_malloc(lv_layer_t * layer, size_t size)
+{
+    lv_draw_layer_arena_t * arena = &layer->_arena;
+    lv_draw_arena_monitor_t * mon = &_draw_info.arena_monitor;
+
+    size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+    arena->required += size;
+    if(arena->required > mon->max_required) mon->max_required = arena->required;
+
+#if LV_DRAW_LAYER_ARENA_SIZE
+    if(arena->buf == NULL) {
+        arena->buf = lv_malloc(LV_DRAW_LAYER_ARENA_SIZE);
+        arena->used = 0;
+    }
+
+    if(arena->buf && arena->used + size <= LV_DRAW_LAYER_ARENA_SIZE) {
+        void * p = arena->buf + arena->used;
+        arena->used += size;
+        if(arena->used > mon->max_used) mon->max_used = arena->used;
+        return p;
+    }
+
+    mon->fallback_cnt++;
+#endif
+
+    return lv_malloc(size);
+}
+
+void lv_draw_layer_free(lv_layer_t * layer, void * data)
+{
+#if LV_DRAW_LAYER_ARENA_SIZE
+    lv_draw_layer_arena_t * arena = &layer->_arena;
+    uint8_t * p = data;
+    /*Memory in the arena is released in one step when the arena is reset*/
+    if(arena->buf && p >= arena->buf && p < arena->buf + LV_DRAW_LAYER_ARENA_SIZE) return;
+#else
+    LV_UNUSED(layer);
+#endif
+
+    lv_free(data);
+}
+
+void lv_draw_layer_deinit(lv_layer_t * layer)
+{
+    if(layer->_task_index) task_index_delete(layer);
+    arena_reset(layer, false);
+}
+
+void lv_draw_arena_monitor(lv_draw_arena_monitor_t * mon_p)
+{
+    *mon_p = _draw_info.arena_monitor;
+    mon_p->size = LV_DRAW_LAYER_ARENA_SIZE;
+}
+
+void lv_draw_arena_monitor_reset(void)
+{
+    lv_memzero(&_draw_info.arena_monitor, sizeof(lv_draw_arena_monitor_t));
+}
+
+void lv_draw_cull_monitor(lv_draw_cull_monitor_t * mon_p)
+{
+    *mon_p = _draw_info.cull_monitor;
+}
+
+void lv_draw_cull_monitor_reset(void)
+{
+    lv_memzero(&_draw_info.cull_monitor, sizeof(lv_draw_cull_monitor_t));
+}
+
+#if LV_USE_DRAW_MONITOR
+void lv_draw_task_monitor(lv_draw_task_monitor_t * mon_p)
+{
+    *mon_p = _draw_info.task_monitor;
+}
+
+void lv_draw_task_monitor_reset(void)
+{
+    lv_memzero(&_draw_info.task_monitor, sizeof(lv_draw_task_monitor_t));
+}
+#endif
+
+void lv_draw_layer_pool_flush(void)
+{
+#if LV_DRAW_LAYER_POOL_SIZE
+    while(_draw_info.layer_pool_cnt) {
+        lv_draw_buf_destroy(layer_pool_remove(0));
+    }
+#endif
+}
+
+void lv_draw_layer_pool_monitor(lv_draw_layer_pool_monitor_t * mon_p)
+{
+    *mon_p = _draw_info.layer_pool_monitor;
+    mon_p->size = LV_DRAW_LAYER_POOL_SIZE;
+}
+
+void lv_draw_layer_pool_monitor_reset(void)
+{
+    lv_draw_layer_pool_monitor_t * mon = &_draw_info.layer_pool_monitor;
+    mon->hit_cnt = 0;
+    mon->miss_cnt = 0;
+    mon->evict_cnt = 0;
+}
+
 void * lv_draw_layer_go_to_xy(lv_layer_t * layer, int32_t x, int32_t y)
 {
     return lv_draw_buf_goto_xy(layer->draw_buf, x, y);
 }
 
+void lv_draw_layer_rotate_area(const lv_layer_t * layer, lv_area_t * area)
+{
+    int32_t w = lv_area_get_width(&layer->buf_area);
+    int32_t h = lv_area_get_height(&layer->buf_area);
+    lv_area_t a = *area;
+
+    switch(layer->rotation) {
+        case LV_DISPLAY_ROTATION_90:
+            lv_area_set(area, a.y1, w - a.x2 - 1, a.y2, w - a.x1 - 1);
+            break;
+        case LV_DISPLAY_ROTATION_180:
+            lv_area_set(area, w - a.x2 - 1, h - a.y2 - 1, w - a.x1 - 1, h - a.y1 - 1);
+            break;
+        case LV_DISPLAY_ROTATION_270:
+            lv_area_set(area, h - a.y2 - 1, a.x1, h - a.y1 - 1, a.x2);
+            break;
+        default:
+            break;
+    }
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -405,6 +650,13 @@ void * lv_draw_layer_go_to_xy(lv_layer_t * layer, int32_t x, int32_t y)
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check)
 {
     LV_PROFILER_BEGIN;
+
+    if(layer->_task_index && t_check->_index_seq) {
+        bool res = task_index_is_independent(layer->_task_index, t_check);
+        LV_PROFILER_END;
+        return res;
+    }
+
     lv_draw_task_t * t = layer->draw_task_head;
 
     /*If t_check is outside of the older tasks then it's independent*/
@@ -422,3 +674,491 @@ static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check)
 
     return true;
 }
+
+/**
+ * Release all the memory allocated in the arena of a layer.
+ * @param layer         pointer to a layer
+ * @param keep_buf      true: keep the buffer of the arena for later use; false: free it
+ */
+static void arena_reset(lv_layer_t * layer, bool keep_buf)
+{
+    lv_draw_layer_arena_t * arena = &layer->_arena;
+    arena->used = 0;
+    arena->required = 0;
+    if(!keep_buf) {
+        lv_free(arena->buf);
+        arena->buf = NULL;
+    }
+}
+
+/**
+ * Create a task index for a layer
+ * @param area      the area of the layer
+ * @return          the new index or NULL if there is not enough memory
+ */
+static lv_draw_task_index_t * task_index_create(const lv_area_t * area)
+{
+    int32_t w = lv_area_get_width(area);
+    int32_t h = lv_area_get_height(area);
+    if(w <= 0 || h <= 0) return NULL;
+
+    int32_t cell_w = LV_MAX((w + TASK_INDEX_GRID_MAX - 1) / TASK_INDEX_GRID_MAX, TASK_INDEX_CELL_MIN);
+    int32_t cell_h = LV_MAX((h + TASK_INDEX_GRID_MAX - 1) / TASK_INDEX_GRID_MAX, TASK_INDEX_CELL_MIN);
+    int32_t col_cnt = (w + cell_w - 1) / cell_w;
+    int32_t row_cnt = (h + cell_h - 1) / cell_h;
+
+    size_t size = sizeof(lv_draw_task_index_t) + (col_cnt * row_cnt - 1) * sizeof(task_index_cell_t);
+    lv_draw_task_index_t * index = lv_malloc_zeroed(size);
+    if(index == NULL) {
+        LV_LOG_WARN("Couldn't allocate the draw task index. Falling back to linear search.");
+        return NULL;
+    }
+
+    index->area = *area;
+    index->cell_w = cell_w;
+    index->cell_h = cell_h;
+    index->col_cnt = col_cnt;
+    index->row_cnt = row_cnt;
+
+    return index;
+}
+
+static void task_index_delete(lv_layer_t * layer)
+{
+    lv_draw_task_index_t * index = layer->_task_index;
+    int32_t i;
+    for(i = 0; i < index->col_cnt * index->row_cnt; i++) {
+        lv_free(index->cells[i].tasks);
+    }
+
+    lv_free(index);
+    layer->_task_index = NULL;
+}
+
+/**
+ * Prepare the index of a layer for a new batch of draw tasks.
+ * The index of the previous batch is reused if the layer's size hasn't changed.
+ * @param layer     the layer whose first draw task is being added
+ */
+static void task_index_start(lv_layer_t * layer)
+{
+    lv_draw_task_index_t * index = layer->_task_index;
+    if(index && lv_area_get_width(&index->area) == lv_area_get_width(&layer->buf_area) &&
+       lv_area_get_height(&index->area) == lv_area_get_height(&layer->buf_area)) {
+        /*Only the position might be different, e.g. with the next part of the screen in partial mode*/
+        index->area = layer->buf_area;
+        index->seq_cnt = 0;
+        int32_t i;
+        for(i = 0; i < index->col_cnt * index->row_cnt; i++) {
+            index->cells[i].cnt = 0;
+        }
+        return;
+    }
+
+    if(index) task_index_delete(layer);
+    layer->_task_index = task_index_create(&layer->buf_area);
+}
+
+/**
+ * Get the area of a task which is considered in the index.
+ * `area` is used to count the dependent tasks and `_real_area` to check the independence
+ * so the union of the two is stored.
+ */
+static inline void task_index_get_task_area(const lv_draw_task_t * t, lv_area_t * area_out)
+{
+    area_out->x1 = LV_MIN(t->area.x1, t->_real_area.x1);
+    area_out->y1 = LV_MIN(t->area.y1, t->_real_area.y1);
+    area_out->x2 = LV_MAX(t->area.x2, t->_real_area.x2);
+    area_out->y2 = LV_MAX(t->area.y2, t->_real_area.y2);
+}
+
+/**
+ * Convert an area to a range of cells. Coordinates outside of the index are clamped to the border cells,
+ * so any two overlapping areas always share at least one cell.
+ */
+static void task_index_get_cells(const lv_draw_task_index_t * index, const lv_area_t * area, lv_area_t * cells_out)
+{
+    int32_t x1 = LV_CLAMP(0, area->x1 - index->area.x1, index->col_cnt * index->cell_w - 1);
+    int32_t y1 = LV_CLAMP(0, area->y1 - index->area.y1, index->row_cnt * index->cell_h - 1);
+    int32_t x2 = LV_CLAMP(0, area->x2 - index->area.x1, index->col_cnt * index->cell_w - 1);
+    int32_t y2 = LV_CLAMP(0, area->y2 - index->area.y1, index->row_cnt * index->cell_h - 1);
+
+    cells_out->x1 = x1 / index->cell_w;
+    cells_out->y1 = y1 / index->cell_h;
+    cells_out->x2 = x2 / index->cell_w;
+    cells_out->y2 = y2 / index->cell_h;
+}
+
+/**
+ * Add a task to the cells it touches.
+ * If a cell can't be enlarged the index is deleted and the linear search is used for the rest of the batch,
+ * as an index missing a task would give wrong results.
+ * @param layer     the layer of the task, it must have an index
+ * @param t         the task to add
+ */
+static void task_index_insert(lv_layer_t * layer, lv_draw_task_t * t)
+{
+    lv_draw_task_index_t * index = layer->_task_index;
+    lv_area_t task_area;
+    lv_area_t cells;
+    task_index_get_task_area(t, &task_area);
+    task_index_get_cells(index, &task_area, &cells);
+
+    int32_t x;
+    int32_t y;
+    for(y = cells.y1; y <= cells.y2; y++) {
+        for(x = cells.x1; x <= cells.x2; x++) {
+            task_index_cell_t * cell = &index->cells[y * index->col_cnt + x];
+            if(cell->cnt == cell->capacity) {
+                uint32_t new_capacity = cell->capacity ? cell->capacity * 2 : 8;
+                lv_draw_task_t ** new_tasks = lv_realloc(cell->tasks, new_capacity * sizeof(lv_draw_task_t *));
+                if(new_tasks == NULL) {
+                    LV_LOG_WARN("Couldn't enlarge the draw task index. Falling back to linear search.");
+                    task_index_delete(layer);
+                    return;
+                }
+                cell->tasks = new_tasks;
+                cell->capacity = new_capacity;
+            }
+
+            cell->tasks[cell->cnt] = t;
+            cell->cnt++;
+        }
+    }
+}
+
+static void task_index_remove(lv_draw_task_index_t * index, lv_draw_task_t * t)
+{
+    lv_area_t task_area;
+    lv_area_t cells;
+    task_index_get_task_area(t, &task_area);
+    task_index_get_cells(index, &task_area, &cells);
+
+    int32_t x;
+    int32_t y;
+    for(y = cells.y1; y <= cells.y2; y++) {
+        for(x = cells.x1; x <= cells.x2; x++) {
+            task_index_cell_t * cell = &index->cells[y * index->col_cnt + x];
+            /*The tasks are finished roughly in the order of adding so search from the beginning*/
+            uint32_t i;
+            for(i = 0; i < cell->cnt; i++) {
+                if(cell->tasks[i] == t) {
+                    lv_memmove(&cell->tasks[i], &cell->tasks[i + 1], (cell->cnt - i - 1) * sizeof(lv_draw_task_t *));
+                    cell->cnt--;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Same as `is_independent()` but checks only the tasks in the cells touched by `t_check`
+ */
+static bool task_index_is_independent(lv_draw_task_index_t * index, lv_draw_task_t * t_check)
+{
+    lv_area_t cells;
+    task_index_get_cells(index, &t_check->_real_area, &cells);
+
+    int32_t x;
+    int32_t y;
+    for(y = cells.y1; y <= cells.y2; y++) {
+        for(x = cells.x1; x <= cells.x2; x++) {
+            task_index_cell_t * cell = &index->cells[y * index->col_cnt + x];
+            uint32_t i;
+            for(i = 0; i < cell->cnt; i++) {
+                lv_draw_task_t * t = cell->tasks[i];
+                /*Only the older tasks matter*/
+                if(t->_index_seq >= t_check->_index_seq) continue;
+                if(t->state == LV_DRAW_TASK_STATE_READY) continue;
+
+                lv_area_t a;
+                if(_lv_area_intersect(&a, &t->_real_area, &t_check->_real_area)) return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Same as `lv_draw_get_dependent_count()` but checks only the tasks in the cells touched by `t_check`
+ */
+static uint32_t task_index_get_dependent_count(lv_draw_task_index_t * index, lv_draw_task_t * t_check)
+{
+    lv_area_t cells;
+    task_index_get_cells(index, &t_check->area, &cells);
+
+    uint32_t cnt = 0;
+    int32_t x;
+    int32_t y;
+    for(y = cells.y1; y <= cells.y2; y++) {
+        for(x = cells.x1; x <= cells.x2; x++) {
+            task_index_cell_t * cell = &index->cells[y * index->col_cnt + x];
+            uint32_t i;
+            for(i = 0; i < cell->cnt; i++) {
+                lv_draw_task_t * t = cell->tasks[i];
+                /*Only the newer tasks matter*/
+                if(t->_index_seq <= t_check->_index_seq) continue;
+                if(t->state != LV_DRAW_TASK_STATE_QUEUED && t->state != LV_DRAW_TASK_STATE_WAITING) continue;
+                if(!_lv_area_is_on(&t_check->area, &t->area)) continue;
+
+                /*A task can be in multiple cells. Count it only in the first cell shared with `t_check`*/
+                lv_area_t task_area;
+                lv_area_t task_cells;
+                task_index_get_task_area(t, &task_area);
+                task_index_get_cells(index, &task_area, &task_cells);
+                if(x != LV_MAX(cells.x1, task_cells.x1) || y != LV_MAX(cells.y1, task_cells.y1)) continue;
+
+                cnt++;
+            }
+        }
+    }
+
+    return cnt;
+}
+
+#if LV_DRAW_CULL_OCCLUDED_TASKS
+
+/**
+ * Get the area which is fully covered by a draw task
+ * @param t             the draw task to check
+ * @param cover_area    store the covered area here
+ * @return              true: `t` covers `cover_area` with opaque pixels; false: `t` doesn't cover any area
+ */
+static bool get_cover_area(const lv_draw_task_t * t, lv_area_t * cover_area)
+{
+    if(t->type == LV_DRAW_TASK_TYPE_FILL) {
+        const lv_draw_fill_dsc_t * dsc = t->draw_dsc;
+        if(dsc->opa < LV_OPA_COVER) return false;
+        if(dsc->grad.dir != LV_GRAD_DIR_NONE) {
+            uint32_t i;
+            for(i = 0; i < dsc->grad.stops_count; i++) {
+                if(dsc->grad.stops[i].opa < LV_OPA_COVER) return false;
+            }
+        }
+
+        /*With radius only the middle rows are fully covered*/
+        int32_t short_side = LV_MIN(lv_area_get_width(&t->area), lv_area_get_height(&t->area));
+        int32_t r = LV_MIN(dsc->radius, short_side >> 1);
+        *cover_area = t->area;
+        cover_area->y1 += r;
+        cover_area->y2 -= r;
+    }
+    else if(t->type == LV_DRAW_TASK_TYPE_IMAGE) {
+        const lv_draw_image_dsc_t * dsc = t->draw_dsc;
+        if(dsc->opa < LV_OPA_COVER) return false;
+        if(dsc->blend_mode != LV_BLEND_MODE_NORMAL) return false;
+        if(dsc->rotation != 0 || dsc->scale_x != LV_SCALE_NONE || dsc->scale_y != LV_SCALE_NONE) return false;
+        if(dsc->skew_x != 0 || dsc->skew_y != 0) return false;
+        if(dsc->bitmap_mask_src || dsc->tile) return false;
+        if(dsc->header.w != lv_area_get_width(&t->area) || dsc->header.h != lv_area_get_height(&t->area)) return false;
+
+        switch(dsc->header.cf) {
+            case LV_COLOR_FORMAT_L8:
+            case LV_COLOR_FORMAT_RGB565:
+            case LV_COLOR_FORMAT_RGB888:
+            case LV_COLOR_FORMAT_XRGB8888:
+                break;
+            default:
+                return false;
+        }
+
+        *cover_area = t->area;
+    }
+    else {
+        return false;
+    }
+
+    return _lv_area_intersect(cover_area, cover_area, &t->clip_area);
+}
+
+/**
+ * Drop or clip the older, not yet rendered draw tasks of a layer which are covered by a draw task
+ * @param layer         the layer of the tasks
+ * @param t_cover       the lastly added draw task
+ */
+static void cull_occluded_tasks(lv_layer_t * layer, lv_draw_task_t * t_cover)
+{
+    lv_area_t cover_area;
+    if(!get_cover_area(t_cover, &cover_area)) return;
+
+    LV_PROFILER_BEGIN;
+
+    lv_draw_task_index_t * index = layer->_task_index;
+    if(index && t_cover->_index_seq) {
+        lv_area_t cells;
+        task_index_get_cells(index, &cover_area, &cells);
+
+        int32_t x;
+        int32_t y;
+        for(y = cells.y1; y <= cells.y2; y++) {
+            for(x = cells.x1; x <= cells.x2; x++) {
+                task_index_cell_t * cell = &index->cells[y * index->col_cnt + x];
+                uint32_t i;
+                for(i = 0; i < cell->cnt; i++) {
+                    lv_draw_task_t * t = cell->tasks[i];
+                    if(t->_index_seq < t_cover->_index_seq) cull_task(t, &cover_area);
+                }
+            }
+        }
+    }
+    else {
+        lv_draw_task_t * t = layer->draw_task_head;
+        while(t && t != t_cover) {
+            cull_task(t, &cover_area);
+            t = t->next;
+        }
+    }
+
+    LV_PROFILER_END;
+}
+
+/**
+ * Drop a draw task if it's fully covered, or clip it if the covered part is a full-width or full-height band
+ * on one of its sides.
+ * @param t             an older draw task
+ * @param cover_area    the area covered by a newer draw task
+ */
+static void cull_task(lv_draw_task_t * t, const lv_area_t * cover_area)
+{
+    /*Only the tasks not taken by a draw unit can be changed*/
+    if(t->state != LV_DRAW_TASK_STATE_QUEUED) return;
+
+    lv_area_t draw_area;
+    if(!_lv_area_intersect(&draw_area, &t->_real_area, &t->clip_area)) return;
+    if(!_lv_area_is_on(&draw_area, cover_area)) return;
+
+    lv_draw_cull_monitor_t * mon = &_draw_info.cull_monitor;
+
+    if(_lv_area_is_in(&draw_area, cover_area, 0)) {
+        /*It will be simply removed as a finished task*/
+        t->state = LV_DRAW_TASK_STATE_READY;
+        mon->culled_task_cnt++;
+        mon->culled_px_cnt += lv_area_get_size(&draw_area);
+        return;
+    }
+
+    lv_area_t clip_area = t->clip_area;
+    if(cover_area->x1 <= draw_area.x1 && cover_area->x2 >= draw_area.x2) {
+        if(cover_area->y1 <= draw_area.y1) clip_area.y1 = cover_area->y2 + 1;
+        else if(cover_area->y2 >= draw_area.y2) clip_area.y2 = cover_area->y1 - 1;
+        else return;
+    }
+    else if(cover_area->y1 <= draw_area.y1 && cover_area->y2 >= draw_area.y2) {
+        if(cover_area->x1 <= draw_area.x1) clip_area.x1 = cover_area->x2 + 1;
+        else if(cover_area->x2 >= draw_area.x2) clip_area.x2 = cover_area->x1 - 1;
+        else return;
+    }
+    else {
+        return;
+    }
+
+    lv_area_t new_draw_area;
+    _lv_area_intersect(&new_draw_area, &draw_area, &clip_area);
+    t->clip_area = clip_area;
+    mon->clipped_task_cnt++;
+    mon->culled_px_cnt += lv_area_get_size(&draw_area) - lv_area_get_size(&new_draw_area);
+}
+
+#endif /*LV_DRAW_CULL_OCCLUDED_TASKS*/
+
+static lv_draw_buf_t * layer_buf_get(uint32_t w, uint32_t h, lv_color_format_t cf)
+{
+#if LV_DRAW_LAYER_POOL_SIZE
+    lv_draw_layer_pool_monitor_t * mon = &_draw_info.layer_pool_monitor;
+    uint32_t stride = lv_draw_buf_width_to_stride(w, cf);
+    uint32_t size = _lv_draw_buf_calculate_size(w, h, cf, stride);
+
+    /*Find the smallest idle buffer with the same color format which is large enough,
+     *but don't waste a much larger buffer on a small layer*/
+    int32_t best = -1;
+    uint32_t i;
+    for(i = 0; i < _draw_info.layer_pool_cnt; i++) {
+        lv_draw_buf_t * buf = _draw_info.layer_pool[i];
+        if(buf->header.cf != cf) continue;
+        if(buf->data_size < size || buf->data_size / 2 > size) continue;
+        if(best < 0 || buf->data_size < _draw_info.layer_pool[best]->data_size) best = i;
+    }
+
+    if(best >= 0) {
+        lv_draw_buf_t * buf = layer_pool_remove(best);
+        lv_draw_buf_t * reshaped = lv_draw_buf_reshape(buf, cf, w, h, stride);
+        if(reshaped) {
+            mon->hit_cnt++;
+            return reshaped;
+        }
+
+        /*Shouldn't happen as the size was checked, but don't lose the buffer*/
+        lv_draw_buf_destroy(buf);
+    }
+
+    mon->miss_cnt++;
+
+    /*Allocate a little more to let the buffer be reused for slightly larger layers too*/
+    uint32_t h_alloc = layer_pool_get_bucket_size(stride * h) / stride;
+    lv_draw_buf_t * buf = lv_draw_buf_create(w, h_alloc, cf, stride);
+    if(buf == NULL) {
+        /*The idle buffers might hold the memory, free them and try with the exact size*/
+        lv_draw_layer_pool_flush();
+        buf = lv_draw_buf_create(w, h, cf, stride);
+        if(buf == NULL) return NULL;
+    }
+
+    return lv_draw_buf_reshape(buf, cf, w, h, stride);
+#else
+    return lv_draw_buf_create(w, h, cf, 0);
+#endif
+}
+
+static void layer_buf_release(lv_draw_buf_t * buf)
+{
+#if LV_DRAW_LAYER_POOL_SIZE
+    lv_draw_layer_pool_monitor_t * mon = &_draw_info.layer_pool_monitor;
+    if(buf->data_size > LV_DRAW_LAYER_POOL_SIZE) {
+        mon->evict_cnt++;
+        lv_draw_buf_destroy(buf);
+        return;
+    }
+
+    /*Free the oldest buffers to make room*/
+    while(_draw_info.layer_pool_cnt == LV_DRAW_LAYER_POOL_SLOT_CNT ||
+          mon->idle_size + buf->data_size > LV_DRAW_LAYER_POOL_SIZE) {
+        mon->evict_cnt++;
+        lv_draw_buf_destroy(layer_pool_remove(0));
+    }
+
+    _draw_info.layer_pool[_draw_info.layer_pool_cnt] = buf;
+    _draw_info.layer_pool_cnt++;
+    mon->idle_size += buf->data_size;
+
+    /*The idle buffers still use the memory*/
+    _draw_info.used_memory_for_layers_kb += get_layer_size_kb(buf->data_size);
+#else
+    lv_draw_buf_destroy(buf);
+#endif
+}
+
+#if LV_DRAW_LAYER_POOL_SIZE
+static lv_draw_buf_t * layer_pool_remove(uint32_t idx)
+{
+    lv_draw_buf_t * buf = _draw_info.layer_pool[idx];
+    _draw_info.layer_pool_cnt--;
+    lv_memmove(&_draw_info.layer_pool[idx], &_draw_info.layer_pool[idx + 1],
+               (_draw_info.layer_pool_cnt - idx) * sizeof(lv_draw_buf_t *));
+    _draw_info.layer_pool_monitor.idle_size -= buf->data_size;
+    _draw_info.used_memory_for_layers_kb -= get_layer_size_kb(buf->data_size);
+    return buf;
+}
+
+/**
+ * Round up the size to a quarter of its highest power of 2,
+ * so similar sized layers share the same buffer size with at most 25% extra memory.
+ */
+static uint32_t layer_pool_get_bucket_size(uint32_t size)
+{
+    uint32_t step = 1;
+    while(step * 8 <= size) step <<= 1;
+    return (size + step - 1) & ~(step - 1);
+}
+#endif
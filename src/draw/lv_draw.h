@@ -28,10 +28,15 @@ extern "C" {
  *********************/
 #define LV_DRAW_UNIT_ID_ANY  0
 
+/*The maximal number of idle buffers in the layer buffer pool*/
+#define LV_DRAW_LAYER_POOL_SLOT_CNT  16
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+typedef struct _lv_draw_task_index_t lv_draw_task_index_t;
+
 typedef enum {
     LV_DRAW_TASK_TYPE_FILL,
     LV_DRAW_TASK_TYPE_BORDER,
@@ -96,6 +101,11 @@ struct _lv_draw_task_t {
      */
     uint8_t preference_score;
 
+    /**
+     * Sequence number of the task in its layer, assigned in `lv_draw_add_task`.
+     * Used internally by the layer's spatial task index. 0: the task is not indexed.
+     */
+    uint32_t _index_seq;
 };
 
 typedef struct {
@@ -144,6 +154,38 @@ struct _lv_draw_unit_t {
     int32_t (*delete_cb)(lv_draw_unit_t * draw_unit);
 };
 
+typedef struct {
+    uint8_t * buf;          /**< `LV_DRAW_LAYER_ARENA_SIZE` bytes, allocated on the first use*/
+    uint32_t used;          /**< Number of bytes used in `buf`*/
+    uint32_t required;      /**< Number of bytes requested since the last reset, including the heap fallbacks*/
+} lv_draw_layer_arena_t;
+
+typedef struct {
+    uint32_t size;          /**< The size of the arena of a layer (`LV_DRAW_LAYER_ARENA_SIZE`)*/
+    uint32_t max_used;      /**< The most bytes used in an arena*/
+    uint32_t max_required;  /**< The most bytes required by the draw tasks of a layer. The ideal arena size.*/
+    uint32_t fallback_cnt;  /**< Number of allocations served by the heap as the arena was full*/
+} lv_draw_arena_monitor_t;
+
+typedef struct {
+    uint32_t culled_task_cnt;   /**< Number of draw tasks dropped as later opaque tasks cover them*/
+    uint32_t clipped_task_cnt;  /**< Number of draw tasks whose clip area was reduced as later opaque tasks cover a part*/
+    uint32_t culled_px_cnt;     /**< Number of pixels not rendered due to the above*/
+} lv_draw_cull_monitor_t;
+
+typedef struct {
+    uint32_t task_cnt;          /**< Number of draw tasks added to the layers*/
+    uint32_t task_px_cnt;       /**< Number of pixels of the added draw tasks' areas clipped to their clip area*/
+} lv_draw_task_monitor_t;
+
+typedef struct {
+    uint32_t size;          /**< The maximal size of the idle buffers in the pool (`LV_DRAW_LAYER_POOL_SIZE`)*/
+    uint32_t idle_size;     /**< The size of the idle buffers currently in the pool*/
+    uint32_t hit_cnt;       /**< Number of layer buffers reused from the pool*/
+    uint32_t miss_cnt;      /**< Number of layer buffers allocated as no suitable buffer was in the pool*/
+    uint32_t evict_cnt;     /**< Number of buffers freed to keep the pool in its size*/
+} lv_draw_layer_pool_monitor_t;
+
 struct _lv_layer_t  {
 
     /** Target draw buffer of the layer*/
@@ -155,6 +197,13 @@ struct _lv_layer_t  {
     /** The color format of the layer. LV_COLOR_FORMAT_...  */
     lv_color_format_t color_format;
 
+    /**
+     * An `lv_display_rotation_t`. If not 0 `draw_buf` is stored rotated this way, i.e. in the orientation of the
+     * display's hardware, however `buf_area` and the draw tasks still use the not rotated coordinates.
+     * Only the software renderer supports it. See `lv_display_set_render_rotated()`.
+     */
+    uint8_t rotation;
+
     /**
      * NEVER USE IT DRAW UNITS. USED INTERNALLY DURING DRAW TASK CREATION.
      * The current clip area with absolute coordinates, always the same or smaller than `buf_area`
@@ -168,6 +217,25 @@ struct _lv_layer_t  {
     /** Linked list of draw tasks */
     lv_draw_task_t * draw_task_head;
 
+    /** The last draw task of the list to add new tasks in O(1)*/
+    lv_draw_task_t * draw_task_tail;
+
+    /**
+     * The last draw task checked by `lv_draw_get_next_available_task()`. The tasks after it are not checked yet
+     * so they can't be finished, and only the tasks up to it need to be searched for finished tasks.
+     */
+    lv_draw_task_t * _dispatch_pos;
+
+    /**
+     * Grid based spatial index of the draw tasks to quickly find overlapping tasks.
+     * Created with the first draw task. It's kept for the next draw tasks of a display's layer
+     * and deleted when all draw tasks are finished on other layers or by `lv_draw_layer_deinit()`.
+     */
+    lv_draw_task_index_t * _task_index;
+
+    /** Memory for the draw tasks and their descriptors. Reset when all draw tasks are finished.*/
+    lv_draw_layer_arena_t _arena;
+
     lv_layer_t * parent;
     lv_layer_t * next;
     bool all_tasks_added;
@@ -186,14 +254,23 @@ typedef struct {
 
 typedef struct {
     lv_draw_unit_t * unit_head;
-    uint32_t used_memory_for_layers_kb;
+    uint32_t used_memory_for_layers_kb;    /**< Including the idle buffers of the layer pool*/
 #if LV_USE_OS
     lv_thread_sync_t sync;
 #else
     int dispatch_req;
 #endif
-    lv_mutex_t circle_cache_mutex;
     bool task_running;
+    lv_draw_arena_monitor_t arena_monitor;
+    lv_draw_cull_monitor_t cull_monitor;
+#if LV_USE_DRAW_MONITOR
+    lv_draw_task_monitor_t task_monitor;
+#endif
+#if LV_DRAW_LAYER_POOL_SIZE
+    lv_draw_buf_t * layer_pool[LV_DRAW_LAYER_POOL_SLOT_CNT];   /**< Idle layer buffers, the oldest first*/
+    uint32_t layer_pool_cnt;
+#endif
+    lv_draw_layer_pool_monitor_t layer_pool_monitor;
 } lv_draw_global_info_t;
 
 /**********************
@@ -263,7 +340,8 @@ void lv_draw_dispatch_request(void);
 /**
  * Find and available draw task
  * @param layer             the draw ctx to search in
- * @param t_prev            continue searching from this task
+ * @param t_prev            continue searching from this task. If NULL the already checked tasks are searched first,
+ *                          then the new tasks from the last checked one.
  * @param draw_unit_id      check the task where `preferred_draw_unit_id` equals this value or `LV_DRAW_UNIT_ID_ANY`
  * @return                  tan available draw task or NULL if there is no any
  */
@@ -295,6 +373,87 @@ lv_layer_t * lv_draw_layer_create(lv_layer_t * parent_layer, lv_color_format_t c
  */
 void * lv_draw_layer_alloc_buf(lv_layer_t * layer);
 
+/**
+ * Allocate memory which is needed until all draw tasks of a layer are finished.
+ * Used to allocate the draw tasks and their descriptors.
+ * The memory is allocated from the arena of the layer, or from the heap if the arena is full or disabled.
+ * @param layer             pointer to a layer
+ * @param size              the size to allocate in bytes
+ * @return                  pointer to the allocated memory or NULL on failure
+ */
+void * lv_draw_layer_malloc(lv_layer_t * layer, size_t size);
+
+/**
+ * Free memory allocated by `lv_draw_layer_malloc`.
+ * Memory in the arena is released only when all draw tasks of the layer are finished.
+ * @param layer             pointer to the layer used in `lv_draw_layer_malloc`
+ * @param data              pointer to the memory to free
+ */
+void lv_draw_layer_free(lv_layer_t * layer, void * data);
+
+/**
+ * Free all the resources of a layer used for draw task management.
+ * Used internally when a layer is deleted.
+ * @param layer             pointer to a layer
+ */
+void lv_draw_layer_deinit(lv_layer_t * layer);
+
+/**
+ * Get statistics about the usage of the layers' memory arena.
+ * Useful to find the optimal `LV_DRAW_LAYER_ARENA_SIZE`.
+ * @param mon_p             pointer to a `lv_draw_arena_monitor_t` variable to fill
+ */
+void lv_draw_arena_monitor(lv_draw_arena_monitor_t * mon_p);
+
+/**
+ * Reset the statistics of `lv_draw_arena_monitor()`
+ */
+void lv_draw_arena_monitor_reset(void);
+
+/**
+ * Get the statistics of culling the draw tasks covered by later opaque draw tasks.
+ * The counters are cumulative. Used only if `LV_DRAW_CULL_OCCLUDED_TASKS` is enabled.
+ * @param mon_p             pointer to a `lv_draw_cull_monitor_t` variable to fill
+ */
+void lv_draw_cull_monitor(lv_draw_cull_monitor_t * mon_p);
+
+/**
+ * Reset the statistics of `lv_draw_cull_monitor()`
+ */
+void lv_draw_cull_monitor_reset(void);
+
+#if LV_USE_DRAW_MONITOR
+/**
+ * Get the number and size of the draw tasks added since the last reset.
+ * Useful to see how complex the rendered screens are, e.g. in benchmarks.
+ * @param mon_p             pointer to a `lv_draw_task_monitor_t` variable to fill
+ */
+void lv_draw_task_monitor(lv_draw_task_monitor_t * mon_p);
+
+/**
+ * Reset the counters of `lv_draw_task_monitor()`
+ */
+void lv_draw_task_monitor_reset(void);
+#endif
+
+/**
+ * Free the idle buffers kept in the layer buffer pool.
+ * Can be called to release memory, the pool is refilled as new layers are drawn.
+ */
+void lv_draw_layer_pool_flush(void);
+
+/**
+ * Get the statistics of the layer buffer pool.
+ * Useful to find the optimal `LV_DRAW_LAYER_POOL_SIZE`.
+ * @param mon_p             pointer to a `lv_draw_layer_pool_monitor_t` variable to fill
+ */
+void lv_draw_layer_pool_monitor(lv_draw_layer_pool_monitor_t * mon_p);
+
+/**
+ * Reset the counters of `lv_draw_layer_pool_monitor()`
+ */
+void lv_draw_layer_pool_monitor_reset(void);
+
 /**
  * Got to a pixel at X and Y coordinate on a layer
  * @param layer             pointer to a layer
@@ -304,6 +463,13 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer);
  */
 void * lv_draw_layer_go_to_xy(lv_layer_t * layer, int32_t x, int32_t y);
 
+/**
+ * Convert an area relative to `buf_area` to the area it covers in the (rotated) draw buffer of a layer
+ * @param layer             pointer to a layer
+ * @param area              pointer to an area relative to `buf_area`. The result is written back here.
+ */
+void lv_draw_layer_rotate_area(const lv_layer_t * layer, lv_area_t * area);
+
 /**********************
  *  GLOBAL VARIABLES
  **********************/
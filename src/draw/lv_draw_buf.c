@@ -31,7 +31,6 @@ static void * draw_buf_malloc(const lv_draw_buf_handlers_t * handler, size_t siz
                               lv_color_format_t color_format);
 static void draw_buf_free(const lv_draw_buf_handlers_t * handler, void * buf);
 static uint32_t width_to_stride(uint32_t w, lv_color_format_t color_format);
-static uint32_t _calculate_draw_buf_size(uint32_t w, uint32_t h, lv_color_format_t cf, uint32_t stride);
 
 /**********************
  *  STATIC VARIABLES
@@ -51,6 +50,24 @@ void _lv_draw_buf_init_handlers(void)
     lv_draw_buf_init_with_default_handlers(&font_draw_buf_handlers);
 }
 
+uint32_t _lv_draw_buf_calculate_size(uint32_t w, uint32_t h, lv_color_format_t cf, uint32_t stride)
+{
+    uint32_t size;
+
+    if(stride == 0) stride = lv_draw_buf_width_to_stride(w, cf);
+
+    size = stride * h;
+    if(cf == LV_COLOR_FORMAT_RGB565A8) {
+        size += (stride / 2) * h; /*A8 mask*/
+    }
+    else if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
+        /*@todo we have to include palette right before image data*/
+        size += LV_COLOR_INDEXED_PALETTE_SIZE(cf) * 4;
+    }
+
+    return size;
+}
+
 void lv_draw_buf_init_with_default_handlers(lv_draw_buf_handlers_t * handlers)
 {
     lv_draw_buf_init_handlers(handlers, buf_malloc, buf_free, buf_align, NULL, width_to_stride);
@@ -248,7 +265,7 @@ lv_draw_buf_t * lv_draw_buf_create_user(const lv_draw_buf_handlers_t * handlers,
     if(draw_buf == NULL) return NULL;
     if(stride == 0) stride = lv_draw_buf_width_to_stride(w, cf);
 
-    uint32_t size = _calculate_draw_buf_size(w, h, cf, stride);
+    uint32_t size = _lv_draw_buf_calculate_size(w, h, cf, stride);
 
     void * buf = draw_buf_malloc(handlers, size, cf);
     /*Do not assert here as LVGL or the app might just want to try creating a draw_buf*/
@@ -297,7 +314,7 @@ lv_draw_buf_t * lv_draw_buf_reshape(lv_draw_buf_t * draw_buf, lv_color_format_t
     if(cf == LV_COLOR_FORMAT_UNKNOWN) cf = draw_buf->header.cf;
     if(stride == 0) stride = lv_draw_buf_width_to_stride(w, cf);
 
-    uint32_t size = _calculate_draw_buf_size(w, h, cf, stride);
+    uint32_t size = _lv_draw_buf_calculate_size(w, h, cf, stride);
 
     if(size > draw_buf->data_size) {
         LV_LOG_TRACE("Draw buf too small for new shape");
@@ -373,7 +390,7 @@ lv_result_t lv_draw_buf_adjust_stride(lv_draw_buf_t * src, uint32_t stride)
     }
 
     /*Check if buffer has enough space. */
-    uint32_t new_size = _calculate_draw_buf_size(w, h, header->cf, stride);
+    uint32_t new_size = _lv_draw_buf_calculate_size(w, h, header->cf, stride);
     if(new_size > src->data_size) {
         return LV_RESULT_INVALID;
     }
@@ -548,24 +565,3 @@ static void draw_buf_free(const lv_draw_buf_handlers_t * handlers, void * buf)
     if(handlers->buf_free_cb)
         handlers->buf_free_cb(buf);
 }
-
-/**
- * For given width, height, color format, and stride, calculate the size needed for a new draw buffer.
- */
-static uint32_t _calculate_draw_buf_size(uint32_t w, uint32_t h, lv_color_format_t cf, uint32_t stride)
-{
-    uint32_t size;
-
-    if(stride == 0) stride = lv_draw_buf_width_to_stride(w, cf);
-
-    size = stride * h;
-    if(cf == LV_COLOR_FORMAT_RGB565A8) {
-        size += (stride / 2) * h; /*A8 mask*/
-    }
-    else if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
-        /*@todo we have to include palette right before image data*/
-        size += LV_COLOR_INDEXED_PALETTE_SIZE(cf) * 4;
-    }
-
-    return size;
-}
@@ -97,6 +97,17 @@ typedef struct {
  */
 void _lv_draw_buf_init_handlers(void);
 
+/**
+ * Called internally to get the size of the data of a draw buffer, including the A8 mask of RGB565A8
+ * and the palette of indexed formats
+ * @param w         the width in pixels
+ * @param h         the height in pixels
+ * @param cf        the color format
+ * @param stride    the stride in bytes or 0 to calculate it from the width
+ * @return          the size in bytes
+ */
+uint32_t _lv_draw_buf_calculate_size(uint32_t w, uint32_t h, lv_color_format_t cf, uint32_t stride);
+
 /**
  * Initialize the draw buffer with the default handlers.
  *
@@ -88,14 +88,18 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_layer_t * layer, const lv_draw_label
     LV_PROFILER_BEGIN;
     lv_draw_task_t * t = lv_draw_add_task(layer, coords);
 
-    t->draw_dsc = lv_malloc(sizeof(*dsc));
+    t->draw_dsc = lv_draw_layer_malloc(layer, sizeof(*dsc));
     lv_memcpy(t->draw_dsc, dsc, sizeof(*dsc));
     t->type = LV_DRAW_TASK_TYPE_LABEL;
 
     /*The text is stored in a local variable so malloc memory for it*/
     if(dsc->text_local) {
         lv_draw_label_dsc_t * new_dsc = t->draw_dsc;
-        new_dsc->text = lv_strdup(dsc->text);
+        size_t text_size = lv_strlen(dsc->text) + 1;
+        char * text = lv_draw_layer_malloc(layer, text_size);
+        LV_ASSERT_MALLOC(text);
+        lv_memcpy(text, dsc->text, text_size);
+        new_dsc->text = text;
     }
 
     lv_draw_finalize_task_creation(layer, t);
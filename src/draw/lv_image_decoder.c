@@ -17,6 +17,7 @@
  *      DEFINES
  *********************/
 #define img_decoder_ll_p &(LV_GLOBAL_DEFAULT()->img_decoder_ll)
+#define img_decoder_lock_p &(LV_GLOBAL_DEFAULT()->img_decoder_lock)
 #define img_cache_p (LV_GLOBAL_DEFAULT()->img_cache)
 #define img_header_cache_p (LV_GLOBAL_DEFAULT()->img_header_cache)
 
@@ -38,6 +39,9 @@ static uint32_t img_width_to_stride(lv_image_header_t * header);
  */
 static lv_image_decoder_t * image_decoder_get_info(const void * src, lv_image_header_t * header);
 
+static lv_result_t image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src,
+                                      const lv_image_decoder_args_t * args);
+
 static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc);
 
 /**********************
@@ -58,6 +62,7 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc);
 void _lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_count)
 {
     _lv_ll_init(img_decoder_ll_p, sizeof(lv_image_decoder_t));
+    lv_mutex_init(img_decoder_lock_p);
 
     /*Initialize the cache*/
     lv_image_cache_init(image_cache_size);
@@ -73,6 +78,7 @@ void _lv_image_decoder_deinit(void)
     lv_cache_destroy(img_header_cache_p, NULL);
 
     _lv_ll_clear(img_decoder_ll_p);
+    lv_mutex_delete(img_decoder_lock_p);
 }
 
 lv_result_t lv_image_decoder_get_info(const void * src, lv_image_header_t * header)
@@ -85,41 +91,11 @@ lv_result_t lv_image_decoder_get_info(const void * src, lv_image_header_t * head
 
 lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src, const lv_image_decoder_args_t * args)
 {
-    lv_memzero(dsc, sizeof(lv_image_decoder_dsc_t));
-
-    if(src == NULL) return LV_RESULT_INVALID;
-    dsc->src = src;
-    dsc->src_type = lv_image_src_get_type(src);
-
-    if(lv_image_cache_is_enabled()) {
-        dsc->cache = img_cache_p;
-        /*Try cache first, unless we are told to ignore cache.*/
-        if(!(args && args->no_cache)) {
-            /*
-            * Check the cache first
-            * If the image is found in the cache, just return it.*/
-            if(try_cache(dsc) == LV_RESULT_OK) return LV_RESULT_OK;
-        }
-    }
-
-    /*Find the decoder that can open the image source, and get the header info in the same time.*/
-    dsc->decoder = image_decoder_get_info(src, &dsc->header);
-    if(dsc->decoder == NULL) return LV_RESULT_INVALID;
-
-    /*Make a copy of args*/
-    dsc->args = args ? *args : (lv_image_decoder_args_t) {
-        .stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1,
-        .premultiply = false,
-        .no_cache = false,
-        .use_indexed = false,
-    };
-
-    /*
-     * We assume that if a decoder can get the info, it can open the image.
-     * If decoder open failed, free the source and return error.
-     * If decoder open succeed, add the image to cache if enabled.
-     * */
-    lv_result_t res = dsc->decoder->open_cb(dsc->decoder, dsc);
+    /*The draw units can open the same image in parallel. Open one image at a time
+     *so that the others find it in the cache instead of decoding and adding it again.*/
+    lv_mutex_lock(img_decoder_lock_p);
+    lv_result_t res = image_decoder_open(dsc, src, args);
+    lv_mutex_unlock(img_decoder_lock_p);
 
     return res;
 }
@@ -355,6 +331,48 @@ static uint32_t img_width_to_stride(lv_image_header_t * header)
     }
 }
 
+static lv_result_t image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src,
+                                      const lv_image_decoder_args_t * args)
+{
+    lv_memzero(dsc, sizeof(lv_image_decoder_dsc_t));
+
+    if(src == NULL) return LV_RESULT_INVALID;
+    dsc->src = src;
+    dsc->src_type = lv_image_src_get_type(src);
+
+    if(lv_image_cache_is_enabled()) {
+        dsc->cache = img_cache_p;
+        /*Try cache first, unless we are told to ignore cache.*/
+        if(!(args && args->no_cache)) {
+            /*
+            * Check the cache first
+            * If the image is found in the cache, just return it.*/
+            if(try_cache(dsc) == LV_RESULT_OK) return LV_RESULT_OK;
+        }
+    }
+
+    /*Find the decoder that can open the image source, and get the header info in the same time.*/
+    dsc->decoder = image_decoder_get_info(src, &dsc->header);
+    if(dsc->decoder == NULL) return LV_RESULT_INVALID;
+
+    /*Make a copy of args*/
+    dsc->args = args ? *args : (lv_image_decoder_args_t) {
+        .stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1,
+        .premultiply = false,
+        .no_cache = false,
+        .use_indexed = false,
+    };
+
+    /*
+     * We assume that if a decoder can get the info, it can open the image.
+     * If decoder open failed, free the source and return error.
+     * If decoder open succeed, add the image to cache if enabled.
+     * */
+    lv_result_t res = dsc->decoder->open_cb(dsc->decoder, dsc);
+
+    return res;
+}
+
 static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc)
 {
     lv_cache_t * cache = dsc->cache;
@@ -277,6 +277,7 @@ static bool draw_to_texture(lv_draw_sdl_unit_t * u, cache_data_t * data)
             lv_draw_dispatch_wait_for_request();
         }
     }
+    lv_draw_layer_deinit(&dest_layer);
 
     SDL_Rect rect;
     rect.x = dest_layer.buf_area.x1;
@@ -18,6 +18,8 @@
 /*********************
  *      DEFINES
  *********************/
+/*Masks and images are rotated in parts of about this many pixels to blend them to a rotated layer*/
+#define ROTATE_PART_PX_CNT  4096
 
 /**********************
  *      TYPEDEFS
@@ -26,6 +28,13 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void blend_fill(lv_color_format_t cf, _lv_draw_sw_blend_fill_dsc_t * dsc);
+static void blend_image(lv_color_format_t cf, _lv_draw_sw_blend_image_dsc_t * dsc);
+static void blend_rotated(lv_draw_unit_t * draw_unit, const lv_area_t * blend_area,
+                          _lv_draw_sw_blend_fill_dsc_t * fill_dsc, _lv_draw_sw_blend_image_dsc_t * image_dsc);
+static void rotate_part(const void * src, void * dest, int32_t w, int32_t h, int32_t src_stride, int32_t dest_stride,
+                        lv_display_rotation_t rotation, lv_color_format_t cf);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -59,40 +68,32 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
         fill_dsc.opa = blend_dsc->opa;
         fill_dsc.color = blend_dsc->color;
 
+#if LV_USE_DRAW_MONITOR
+        /*Units other than SW (e.g. PXP) can call it too, but only the SW units are counted*/
+        lv_draw_sw_blend_monitor_t * mon = _lv_draw_sw_get_blend_monitor(draw_unit);
+        if(mon) {
+            mon->fill_px_cnt += fill_dsc.dest_w * fill_dsc.dest_h;
+            mon->call_cnt++;
+        }
+#endif
+
         if(blend_dsc->mask_buf == NULL) fill_dsc.mask_buf = NULL;
         else if(blend_dsc->mask_res == LV_DRAW_SW_MASK_RES_FULL_COVER) fill_dsc.mask_buf = NULL;
         else fill_dsc.mask_buf = blend_dsc->mask_buf;
 
-        fill_dsc.dest_buf = lv_draw_layer_go_to_xy(layer, blend_area.x1 - layer->buf_area.x1,
-                                                   blend_area.y1 - layer->buf_area.y1);
-
         if(fill_dsc.mask_buf) {
             fill_dsc.mask_stride = blend_dsc->mask_stride == 0  ? lv_area_get_width(blend_dsc->mask_area) : blend_dsc->mask_stride;
             fill_dsc.mask_buf += fill_dsc.mask_stride * (blend_area.y1 - blend_dsc->mask_area->y1) +
                                  (blend_area.x1 - blend_dsc->mask_area->x1);
         }
 
-        switch(layer->color_format) {
-            case LV_COLOR_FORMAT_RGB565:
-                lv_draw_sw_blend_color_to_rgb565(&fill_dsc);
-                break;
-            case LV_COLOR_FORMAT_ARGB8888:
-                lv_draw_sw_blend_color_to_argb8888(&fill_dsc);
-                break;
-            case LV_COLOR_FORMAT_RGB888:
-                lv_draw_sw_blend_color_to_rgb888(&fill_dsc, 3);
-                break;
-            case LV_COLOR_FORMAT_XRGB8888:
-                lv_draw_sw_blend_color_to_rgb888(&fill_dsc, 4);
-                break;
-            case LV_COLOR_FORMAT_L8:
-                lv_draw_sw_blend_color_to_l8(&fill_dsc);
-                break;
-            case LV_COLOR_FORMAT_AL88:
-                lv_draw_sw_blend_color_to_al88(&fill_dsc);
-                break;
-            default:
-                break;
+        if(layer->rotation != LV_DISPLAY_ROTATION_0) {
+            blend_rotated(draw_unit, &blend_area, &fill_dsc, NULL);
+        }
+        else {
+            fill_dsc.dest_buf = lv_draw_layer_go_to_xy(layer, blend_area.x1 - layer->buf_area.x1,
+                                                       blend_area.y1 - layer->buf_area.y1);
+            blend_fill(layer->color_format, &fill_dsc);
         }
     }
     else {
@@ -111,6 +112,14 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
         image_dsc.dest_h = lv_area_get_height(&blend_area);
         image_dsc.dest_stride = layer_stride_byte;
 
+#if LV_USE_DRAW_MONITOR
+        lv_draw_sw_blend_monitor_t * mon = _lv_draw_sw_get_blend_monitor(draw_unit);
+        if(mon) {
+            mon->image_px_cnt += image_dsc.dest_w * image_dsc.dest_h;
+            mon->call_cnt++;
+        }
+#endif
+
         image_dsc.opa = blend_dsc->opa;
         image_dsc.blend_mode = blend_dsc->blend_mode;
         image_dsc.src_stride = blend_dsc->src_stride;
@@ -133,31 +142,13 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
                                   (blend_area.x1 - blend_dsc->mask_area->x1);
         }
 
-        image_dsc.dest_buf = lv_draw_layer_go_to_xy(layer, blend_area.x1 - layer->buf_area.x1,
-                                                    blend_area.y1 - layer->buf_area.y1);
-
-        switch(layer->color_format) {
-            case LV_COLOR_FORMAT_RGB565:
-            case LV_COLOR_FORMAT_RGB565A8:
-                lv_draw_sw_blend_image_to_rgb565(&image_dsc);
-                break;
-            case LV_COLOR_FORMAT_ARGB8888:
-                lv_draw_sw_blend_image_to_argb8888(&image_dsc);
-                break;
-            case LV_COLOR_FORMAT_RGB888:
-                lv_draw_sw_blend_image_to_rgb888(&image_dsc, 3);
-                break;
-            case LV_COLOR_FORMAT_XRGB8888:
-                lv_draw_sw_blend_image_to_rgb888(&image_dsc, 4);
-                break;
-            case LV_COLOR_FORMAT_L8:
-                lv_draw_sw_blend_image_to_l8(&image_dsc);
-                break;
-            case LV_COLOR_FORMAT_AL88:
-                lv_draw_sw_blend_image_to_al88(&image_dsc);
-                break;
-            default:
-                break;
+        if(layer->rotation != LV_DISPLAY_ROTATION_0) {
+            blend_rotated(draw_unit, &blend_area, NULL, &image_dsc);
+        }
+        else {
+            image_dsc.dest_buf = lv_draw_layer_go_to_xy(layer, blend_area.x1 - layer->buf_area.x1,
+                                                        blend_area.y1 - layer->buf_area.y1);
+            blend_image(layer->color_format, &image_dsc);
         }
     }
     LV_PROFILER_END;
@@ -167,4 +158,167 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
  *   STATIC FUNCTIONS
  **********************/
 
+static void blend_fill(lv_color_format_t cf, _lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    switch(cf) {
+        case LV_COLOR_FORMAT_RGB565:
+            lv_draw_sw_blend_color_to_rgb565(dsc);
+            break;
+        case LV_COLOR_FORMAT_ARGB8888:
+            lv_draw_sw_blend_color_to_argb8888(dsc);
+            break;
+        case LV_COLOR_FORMAT_RGB888:
+            lv_draw_sw_blend_color_to_rgb888(dsc, 3);
+            break;
+        case LV_COLOR_FORMAT_XRGB8888:
+            lv_draw_sw_blend_color_to_rgb888(dsc, 4);
+            break;
+        case LV_COLOR_FORMAT_L8:
+            lv_draw_sw_blend_color_to_l8(dsc);
+            break;
+        case LV_COLOR_FORMAT_AL88:
+            lv_draw_sw_blend_color_to_al88(dsc);
+            break;
+        default:
+            break;
+    }
+}
+
+static void blend_image(lv_color_format_t cf, _lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    switch(cf) {
+        case LV_COLOR_FORMAT_RGB565:
+        case LV_COLOR_FORMAT_RGB565A8:
+            lv_draw_sw_blend_image_to_rgb565(dsc);
+            break;
+        case LV_COLOR_FORMAT_ARGB8888:
+            lv_draw_sw_blend_image_to_argb8888(dsc);
+            break;
+        case LV_COLOR_FORMAT_RGB888:
+            lv_draw_sw_blend_image_to_rgb888(dsc, 3);
+            break;
+        case LV_COLOR_FORMAT_XRGB8888:
+            lv_draw_sw_blend_image_to_rgb888(dsc, 4);
+            break;
+        case LV_COLOR_FORMAT_L8:
+            lv_draw_sw_blend_image_to_l8(dsc);
+            break;
+        case LV_COLOR_FORMAT_AL88:
+            lv_draw_sw_blend_image_to_al88(dsc);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * Blend to a layer whose buffer is stored rotated.
+ * The rotated area is written directly in the buffer by the normal blend functions.
+ * Only the mask and the image (if any) needs to be rotated, part by part, to a temporary buffer.
+ * With 90 and 270 degree rotation the columns of the area become the rows of the buffer,
+ * so take parts of columns to write long rows.
+ * @param draw_unit     pointer to a draw unit
+ * @param blend_area    the area to blend with absolute (not rotated) coordinates
+ * @param fill_dsc      a descriptor prepared for `blend_area` to fill a color or NULL if `image_dsc` is used
+ * @param image_dsc     a descriptor prepared for `blend_area` to blend an image or NULL if `fill_dsc` is used
+ */
+static void blend_rotated(lv_draw_unit_t * draw_unit, const lv_area_t * blend_area,
+                          _lv_draw_sw_blend_fill_dsc_t * fill_dsc, _lv_draw_sw_blend_image_dsc_t * image_dsc)
+{
+    lv_layer_t * layer = draw_unit->target_layer;
+    lv_display_rotation_t rotation = layer->rotation;
+    int32_t w = lv_area_get_width(blend_area);
+    int32_t h = lv_area_get_height(blend_area);
+
+    const lv_opa_t * mask_buf = fill_dsc ? fill_dsc->mask_buf : image_dsc->mask_buf;
+    int32_t mask_stride = 0;
+    if(mask_buf) mask_stride = fill_dsc ? fill_dsc->mask_stride : image_dsc->mask_stride;
+    const uint8_t * src_buf = image_dsc ? image_dsc->src_buf : NULL;
+    int32_t src_stride = image_dsc ? image_dsc->src_stride : 0;
+    uint32_t src_px_size = image_dsc ? lv_color_format_get_size(image_dsc->src_color_format) : 0;
+
+    /*Only filling a color needs no temporary buffer, so it's done in one step*/
+    bool by_columns = rotation != LV_DISPLAY_ROTATION_180;
+    int32_t part_cnt = by_columns ? w : h;
+    int32_t part_len = by_columns ? h : w;
+    int32_t step = part_cnt;
+    if(mask_buf || src_buf) step = LV_CLAMP(1, ROTATE_PART_PX_CNT / part_len, part_cnt);
+
+    lv_opa_t * mask_rotated = NULL;
+    uint8_t * src_rotated = NULL;
+    if(mask_buf) mask_rotated = lv_draw_sw_scratch_alloc(draw_unit, step * part_len);
+    if(src_buf) src_rotated = lv_draw_sw_scratch_alloc(draw_unit, step * part_len * src_px_size);
+    if((mask_buf && mask_rotated == NULL) || (src_buf && src_rotated == NULL)) {
+        LV_LOG_WARN("Couldn't allocate the buffer to rotate the mask or image");
+        lv_draw_sw_scratch_free(draw_unit, src_rotated);
+        lv_draw_sw_scratch_free(draw_unit, mask_rotated);
+        return;
+    }
+
+    int32_t i;
+    for(i = 0; i < part_cnt; i += step) {
+        /*The part relative to the blend area and its place in the buffer*/
+        lv_area_t part;
+        if(by_columns) lv_area_set(&part, i, 0, LV_MIN(i + step, part_cnt) - 1, h - 1);
+        else lv_area_set(&part, 0, i, w - 1, LV_MIN(i + step, part_cnt) - 1);
+
+        lv_area_t buf_part = part;
+        lv_area_move(&buf_part, blend_area->x1 - layer->buf_area.x1, blend_area->y1 - layer->buf_area.y1);
+        lv_draw_layer_rotate_area(layer, &buf_part);
+
+        int32_t part_w = lv_area_get_width(&part);
+        int32_t part_h = lv_area_get_height(&part);
+        int32_t dest_w = lv_area_get_width(&buf_part);
+        void * dest_buf = lv_draw_layer_go_to_xy(layer, buf_part.x1, buf_part.y1);
+
+        if(mask_buf) {
+            rotate_part(mask_buf + part.y1 * mask_stride + part.x1, mask_rotated, part_w, part_h, mask_stride, dest_w,
+                        rotation, LV_COLOR_FORMAT_A8);
+        }
+
+        if(fill_dsc) {
+            fill_dsc->dest_buf = dest_buf;
+            fill_dsc->dest_w = dest_w;
+            fill_dsc->dest_h = lv_area_get_height(&buf_part);
+            fill_dsc->dest_stride = layer->draw_buf->header.stride;
+            fill_dsc->mask_buf = mask_rotated;
+            fill_dsc->mask_stride = dest_w;
+            blend_fill(layer->color_format, fill_dsc);
+        }
+        else {
+            rotate_part(src_buf + part.y1 * src_stride + part.x1 * src_px_size, src_rotated, part_w, part_h, src_stride,
+                        dest_w * src_px_size, rotation, image_dsc->src_color_format);
+
+            image_dsc->dest_buf = dest_buf;
+            image_dsc->dest_w = dest_w;
+            image_dsc->dest_h = lv_area_get_height(&buf_part);
+            image_dsc->dest_stride = layer->draw_buf->header.stride;
+            image_dsc->mask_buf = mask_rotated;
+            image_dsc->mask_stride = dest_w;
+            image_dsc->src_buf = src_rotated;
+            image_dsc->src_stride = dest_w * src_px_size;
+            blend_image(layer->color_format, image_dsc);
+        }
+    }
+
+    /*In reverse order as they might be heap allocations too*/
+    lv_draw_sw_scratch_free(draw_unit, src_rotated);
+    lv_draw_sw_scratch_free(draw_unit, mask_rotated);
+}
+
+/**
+ * Rotate a part of a mask or image like the draw buffer of a rotated layer.
+ * See `lv_draw_sw_rotate()` for the parameters.
+ */
+static void rotate_part(const void * src, void * dest, int32_t w, int32_t h, int32_t src_stride, int32_t dest_stride,
+                        lv_display_rotation_t rotation, lv_color_format_t cf)
+{
+    /*`lv_draw_sw_rotate` turns 24 bit pixels to the other direction by 90 and 270 degrees*/
+    if(lv_color_format_get_bpp(cf) == 24 && rotation != LV_DISPLAY_ROTATION_180) {
+        rotation = rotation == LV_DISPLAY_ROTATION_90 ? LV_DISPLAY_ROTATION_270 : LV_DISPLAY_ROTATION_90;
+    }
+
+    lv_draw_sw_rotate(src, dest, w, h, src_stride, dest_stride, rotation, cf);
+}
+
 #endif
@@ -0,0 +1,512 @@
+/**
+ * @file lv_draw_sw_blend_mode.c
+ *
+ * Blending images with additive, subtractive and multiply blend modes.
+ * The source pixels are converted to ARGB8888 (with opacity and mask applied on the alpha channel)
+ * in small chunks and the chunks are blended by row kernels which are specific to the blend mode
+ * and to the color format of the destination.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_mode.h"
+#if LV_USE_DRAW_SW
+
+#include "lv_draw_sw_blend.h"
+#include "../../../misc/lv_math.h"
+#include "../../../misc/lv_color.h"
+#include "../../../misc/lv_log.h"
+#include "../../../stdlib/lv_string.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_NEON
+    #include "neon/lv_blend_neon.h"
+#elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_HELIUM
+    #include "helium/lv_blend_helium.h"
+#elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+    #include "x86/lv_blend_x86.h"
+#elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
+    #include LV_DRAW_SW_ASM_CUSTOM_INCLUDE
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Number of source pixels converted to ARGB8888 in one step*/
+#define CHUNK_SIZE  64
+
+/*The row kernel hooks get an ARGB8888 source where the alpha channel is the final mix ratio*/
+#ifndef LV_DRAW_SW_BLEND_MODE_ROW_TO_RGB565
+    #define LV_DRAW_SW_BLEND_MODE_ROW_TO_RGB565(...)                LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_BLEND_MODE_ROW_TO_RGB888
+    #define LV_DRAW_SW_BLEND_MODE_ROW_TO_RGB888(...)                LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_BLEND_MODE_ROW_TO_ARGB8888
+    #define LV_DRAW_SW_BLEND_MODE_ROW_TO_ARGB8888(...)              LV_RESULT_INVALID
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static bool is_supported(const _lv_draw_sw_blend_image_dsc_t * dsc);
+
+static const lv_color32_t * /* LV_ATTRIBUTE_FAST_MEM */ get_src_chunk(const _lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                      const uint8_t * src, const lv_opa_t * mask,
+                                                                      int32_t len, bool exact_opa, lv_color32_t * buf);
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ row_to_rgb565(uint16_t * dest, const lv_color32_t * src, int32_t len,
+                                                      lv_blend_mode_t mode);
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ row_to_rgb888(uint8_t * dest, const lv_color32_t * src, int32_t len,
+                                                      lv_blend_mode_t mode, uint32_t dest_px_size);
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ row_to_argb8888(lv_color32_t * dest, const lv_color32_t * src, int32_t len,
+                                                        lv_blend_mode_t mode);
+
+static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ additive_rgb565(uint16_t dest, lv_color32_t src);
+
+static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ subtractive_rgb565(uint16_t dest, lv_color32_t src);
+
+static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ multiply_rgb565(uint16_t dest, lv_color32_t src);
+
+static inline lv_color32_t /* LV_ATTRIBUTE_FAST_MEM */ additive_32(lv_color32_t dest, lv_color32_t src);
+
+static inline lv_color32_t /* LV_ATTRIBUTE_FAST_MEM */ subtractive_32(lv_color32_t dest, lv_color32_t src);
+
+static inline lv_color32_t /* LV_ATTRIBUTE_FAST_MEM */ multiply_32(lv_color32_t dest, lv_color32_t src);
+
+static inline void /* LV_ATTRIBUTE_FAST_MEM */ lv_color_24_24_mix(lv_color32_t src, uint8_t * dest, uint8_t mix);
+
+static inline lv_color32_t /* LV_ATTRIBUTE_FAST_MEM */ lv_color_32_32_mix(lv_color32_t fg, lv_color32_t bg);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_mode_image_to_rgb565(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(!is_supported(dsc)) return;
+
+    lv_color32_t buf[CHUNK_SIZE];
+    uint32_t src_px_size = lv_color_format_get_size(dsc->src_color_format);
+    bool skip_white = dsc->src_color_format == LV_COLOR_FORMAT_RGB565 && dsc->blend_mode == LV_BLEND_MODE_MULTIPLY;
+    uint8_t * dest_row = dsc->dest_buf;
+    const uint8_t * src_row = dsc->src_buf;
+    const lv_opa_t * mask_row = dsc->mask_buf;
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        for(x = 0; x < dsc->dest_w; x += CHUNK_SIZE) {
+            int32_t len = LV_MIN(dsc->dest_w - x, CHUNK_SIZE);
+            const lv_color32_t * src = get_src_chunk(dsc, src_row + x * src_px_size, mask_row ? mask_row + x : NULL,
+                                                     len, false, buf);
+            /*Multiplying with white is identity, but the 5/6 bit math would darken it*/
+            if(skip_white) {
+                const uint16_t * src_u16 = (const uint16_t *)src_row + x;
+                int32_t i;
+                for(i = 0; i < len; i++) {
+                    if(src_u16[i] == 0xffff) buf[i].alpha = LV_OPA_TRANSP;
+                }
+            }
+            uint16_t * dest = (uint16_t *)dest_row + x;
+            if(LV_RESULT_INVALID == LV_DRAW_SW_BLEND_MODE_ROW_TO_RGB565(dest, src, len, dsc->blend_mode)) {
+                row_to_rgb565(dest, src, len, dsc->blend_mode);
+            }
+        }
+        dest_row += dsc->dest_stride;
+        src_row += dsc->src_stride;
+        if(mask_row) mask_row += dsc->mask_stride;
+    }
+}
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_mode_image_to_rgb888(_lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                 uint32_t dest_px_size)
+{
+    if(!is_supported(dsc)) return;
+
+    lv_color32_t buf[CHUNK_SIZE];
+    uint32_t src_px_size = lv_color_format_get_size(dsc->src_color_format);
+    uint8_t * dest_row = dsc->dest_buf;
+    const uint8_t * src_row = dsc->src_buf;
+    const lv_opa_t * mask_row = dsc->mask_buf;
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        for(x = 0; x < dsc->dest_w; x += CHUNK_SIZE) {
+            int32_t len = LV_MIN(dsc->dest_w - x, CHUNK_SIZE);
+            const lv_color32_t * src = get_src_chunk(dsc, src_row + x * src_px_size, mask_row ? mask_row + x : NULL,
+                                                     len, true, buf);
+            uint8_t * dest = dest_row + x * dest_px_size;
+            if(LV_RESULT_INVALID == LV_DRAW_SW_BLEND_MODE_ROW_TO_RGB888(dest, src, len, dsc->blend_mode, dest_px_size)) {
+                row_to_rgb888(dest, src, len, dsc->blend_mode, dest_px_size);
+            }
+        }
+        dest_row += dsc->dest_stride;
+        src_row += dsc->src_stride;
+        if(mask_row) mask_row += dsc->mask_stride;
+    }
+}
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_mode_image_to_argb8888(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(!is_supported(dsc)) return;
+
+    lv_color32_t buf[CHUNK_SIZE];
+    uint32_t src_px_size = lv_color_format_get_size(dsc->src_color_format);
+    uint8_t * dest_row = dsc->dest_buf;
+    const uint8_t * src_row = dsc->src_buf;
+    const lv_opa_t * mask_row = dsc->mask_buf;
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        for(x = 0; x < dsc->dest_w; x += CHUNK_SIZE) {
+            int32_t len = LV_MIN(dsc->dest_w - x, CHUNK_SIZE);
+            const lv_color32_t * src = get_src_chunk(dsc, src_row + x * src_px_size, mask_row ? mask_row + x : NULL,
+                                                     len, true, buf);
+            lv_color32_t * dest = (lv_color32_t *)dest_row + x;
+            if(LV_RESULT_INVALID == LV_DRAW_SW_BLEND_MODE_ROW_TO_ARGB8888(dest, src, len, dsc->blend_mode)) {
+                row_to_argb8888(dest, src, len, dsc->blend_mode);
+            }
+        }
+        dest_row += dsc->dest_stride;
+        src_row += dsc->src_stride;
+        if(mask_row) mask_row += dsc->mask_stride;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool is_supported(const _lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    switch(dsc->blend_mode) {
+        case LV_BLEND_MODE_ADDITIVE:
+        case LV_BLEND_MODE_SUBTRACTIVE:
+        case LV_BLEND_MODE_MULTIPLY:
+            break;
+        default:
+            LV_LOG_WARN("Not supported blend mode: %d", dsc->blend_mode);
+            return false;
+    }
+
+    switch(dsc->src_color_format) {
+        case LV_COLOR_FORMAT_RGB565:
+        case LV_COLOR_FORMAT_RGB888:
+        case LV_COLOR_FORMAT_XRGB8888:
+        case LV_COLOR_FORMAT_ARGB8888:
+        case LV_COLOR_FORMAT_L8:
+        case LV_COLOR_FORMAT_AL88:
+            return true;
+        default:
+            LV_LOG_WARN("Not supported source color format");
+            return false;
+    }
+}
+
+/**
+ * Get `len` source pixels as ARGB8888 where the alpha channel is the mix ratio
+ * calculated from the alpha of the pixel, the overall opacity and the mask.
+ * @param dsc       the blend descriptor
+ * @param src       pointer to the first source pixel
+ * @param mask      pointer to the first mask value or NULL if there is no mask
+ * @param len       number of pixels, at most `CHUNK_SIZE`
+ * @param exact_opa true: always scale with `opa` and `mask` even if they are `LV_OPA_MAX`
+ *                  (as the 24 and 32 bit destinations always did), false: skip the scaling if they are opaque
+ * @param buf       buffer to convert the pixels to
+ * @return          `buf` or `src` if it can be used without conversion
+ */
+static const lv_color32_t * LV_ATTRIBUTE_FAST_MEM get_src_chunk(const _lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                const uint8_t * src, const lv_opa_t * mask,
+                                                                int32_t len, bool exact_opa, lv_color32_t * buf)
+{
+    lv_opa_t opa = dsc->opa;
+    bool has_alpha = false;
+    int32_t x;
+
+    switch(dsc->src_color_format) {
+        case LV_COLOR_FORMAT_ARGB8888:
+            if(mask == NULL && opa >= LV_OPA_MAX && !exact_opa) return (const lv_color32_t *)src;
+            lv_memcpy(buf, src, len * sizeof(lv_color32_t));
+            has_alpha = true;
+            break;
+        case LV_COLOR_FORMAT_XRGB8888:
+        case LV_COLOR_FORMAT_RGB888: {
+                uint32_t px_size = dsc->src_color_format == LV_COLOR_FORMAT_RGB888 ? 3 : 4;
+                for(x = 0; x < len; x++) {
+                    buf[x].blue = src[0];
+                    buf[x].green = src[1];
+                    buf[x].red = src[2];
+                    src += px_size;
+                }
+                break;
+            }
+        case LV_COLOR_FORMAT_RGB565: {
+                const lv_color16_t * src_c16 = (const lv_color16_t *)src;
+                for(x = 0; x < len; x++) {
+                    buf[x].red = (src_c16[x].red * 2106) >> 8;  /*To make it rounded*/
+                    buf[x].green = (src_c16[x].green * 1037) >> 8;
+                    buf[x].blue = (src_c16[x].blue * 2106) >> 8;
+                }
+                break;
+            }
+        case LV_COLOR_FORMAT_L8:
+            for(x = 0; x < len; x++) {
+                buf[x].red = src[x];
+                buf[x].green = src[x];
+                buf[x].blue = src[x];
+            }
+            break;
+        case LV_COLOR_FORMAT_AL88: {
+                const lv_color16a_t * src_al88 = (const lv_color16a_t *)src;
+                for(x = 0; x < len; x++) {
+                    buf[x].red = src_al88[x].lumi;
+                    buf[x].green = src_al88[x].lumi;
+                    buf[x].blue = src_al88[x].lumi;
+                    buf[x].alpha = src_al88[x].alpha;
+                }
+                has_alpha = true;
+                break;
+            }
+        default:
+            break;
+    }
+
+    /*Calculate the mix ratios the same way as the normal blending does*/
+    if(exact_opa) {
+        if(has_alpha) {
+            if(mask == NULL) for(x = 0; x < len; x++) buf[x].alpha = LV_OPA_MIX2(buf[x].alpha, opa);
+            else for(x = 0; x < len; x++) buf[x].alpha = LV_OPA_MIX3(buf[x].alpha, mask[x], opa);
+        }
+        else {
+            if(mask == NULL) for(x = 0; x < len; x++) buf[x].alpha = opa;
+            else for(x = 0; x < len; x++) buf[x].alpha = LV_OPA_MIX2(mask[x], opa);
+        }
+    }
+    else if(has_alpha) {
+        if(mask == NULL) {
+            if(opa < LV_OPA_MAX) {
+                for(x = 0; x < len; x++) buf[x].alpha = LV_OPA_MIX2(buf[x].alpha, opa);
+            }
+        }
+        else if(opa >= LV_OPA_MAX) {
+            for(x = 0; x < len; x++) buf[x].alpha = LV_OPA_MIX2(buf[x].alpha, mask[x]);
+        }
+        else {
+            for(x = 0; x < len; x++) buf[x].alpha = LV_OPA_MIX3(buf[x].alpha, mask[x], opa);
+        }
+    }
+    else {
+        if(mask == NULL) {
+            for(x = 0; x < len; x++) buf[x].alpha = opa;
+        }
+        else if(opa >= LV_OPA_MAX) {
+            for(x = 0; x < len; x++) buf[x].alpha = mask[x];
+        }
+        else {
+            for(x = 0; x < len; x++) buf[x].alpha = LV_OPA_MIX2(mask[x], opa);
+        }
+    }
+
+    return buf;
+}
+
+static void LV_ATTRIBUTE_FAST_MEM row_to_rgb565(uint16_t * dest, const lv_color32_t * src, int32_t len,
+                                                lv_blend_mode_t mode)
+{
+    /*Select the blend mode once and keep the inner loops free of branches*/
+    int32_t x;
+    switch(mode) {
+        case LV_BLEND_MODE_ADDITIVE:
+            for(x = 0; x < len; x++) {
+                dest[x] = lv_color_16_16_mix(additive_rgb565(dest[x], src[x]), dest[x], src[x].alpha);
+            }
+            break;
+        case LV_BLEND_MODE_SUBTRACTIVE:
+            for(x = 0; x < len; x++) {
+                dest[x] = lv_color_16_16_mix(subtractive_rgb565(dest[x], src[x]), dest[x], src[x].alpha);
+            }
+            break;
+        case LV_BLEND_MODE_MULTIPLY:
+            for(x = 0; x < len; x++) {
+                dest[x] = lv_color_16_16_mix(multiply_rgb565(dest[x], src[x]), dest[x], src[x].alpha);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM row_to_rgb888(uint8_t * dest, const lv_color32_t * src, int32_t len,
+                                                lv_blend_mode_t mode, uint32_t dest_px_size)
+{
+    int32_t x;
+    lv_color32_t dest_px;
+    switch(mode) {
+        case LV_BLEND_MODE_ADDITIVE:
+            for(x = 0; x < len; x++, dest += dest_px_size) {
+                dest_px.blue = dest[0];
+                dest_px.green = dest[1];
+                dest_px.red = dest[2];
+                lv_color_24_24_mix(additive_32(dest_px, src[x]), dest, src[x].alpha);
+            }
+            break;
+        case LV_BLEND_MODE_SUBTRACTIVE:
+            for(x = 0; x < len; x++, dest += dest_px_size) {
+                dest_px.blue = dest[0];
+                dest_px.green = dest[1];
+                dest_px.red = dest[2];
+                lv_color_24_24_mix(subtractive_32(dest_px, src[x]), dest, src[x].alpha);
+            }
+            break;
+        case LV_BLEND_MODE_MULTIPLY:
+            for(x = 0; x < len; x++, dest += dest_px_size) {
+                dest_px.blue = dest[0];
+                dest_px.green = dest[1];
+                dest_px.red = dest[2];
+                lv_color_24_24_mix(multiply_32(dest_px, src[x]), dest, src[x].alpha);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM row_to_argb8888(lv_color32_t * dest, const lv_color32_t * src, int32_t len,
+                                                  lv_blend_mode_t mode)
+{
+    int32_t x;
+    switch(mode) {
+        case LV_BLEND_MODE_ADDITIVE:
+            for(x = 0; x < len; x++) {
+                dest[x] = lv_color_32_32_mix(additive_32(dest[x], src[x]), dest[x]);
+            }
+            break;
+        case LV_BLEND_MODE_SUBTRACTIVE:
+            for(x = 0; x < len; x++) {
+                dest[x] = lv_color_32_32_mix(subtractive_32(dest[x], src[x]), dest[x]);
+            }
+            break;
+        case LV_BLEND_MODE_MULTIPLY:
+            for(x = 0; x < len; x++) {
+                dest[x] = lv_color_32_32_mix(multiply_32(dest[x], src[x]), dest[x]);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM additive_rgb565(uint16_t dest, lv_color32_t src)
+{
+    uint32_t r = LV_MIN((dest >> 11) + (src.red >> 3), 31);
+    uint32_t g = LV_MIN(((dest >> 5) & 0x3F) + (src.green >> 2), 63);
+    uint32_t b = LV_MIN((dest & 0x1F) + (src.blue >> 3), 31);
+    return (uint16_t)((r << 11) + (g << 5) + b);
+}
+
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM subtractive_rgb565(uint16_t dest, lv_color32_t src)
+{
+    int32_t r = LV_MAX((int32_t)(dest >> 11) - (src.red >> 3), 0);
+    int32_t g = LV_MAX((int32_t)((dest >> 5) & 0x3F) - (src.green >> 2), 0);
+    int32_t b = LV_MAX((int32_t)(dest & 0x1F) - (src.blue >> 3), 0);
+    return (uint16_t)((r << 11) + (g << 5) + b);
+}
+
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM multiply_rgb565(uint16_t dest, lv_color32_t src)
+{
+    uint32_t r = ((dest >> 11) * (src.red >> 3)) >> 5;
+    uint32_t g = (((dest >> 5) & 0x3F) * (src.green >> 2)) >> 6;
+    uint32_t b = ((dest & 0x1F) * (src.blue >> 3)) >> 5;
+    return (uint16_t)((r << 11) + (g << 5) + b);
+}
+
+/*The 32 bit operations return the result with the alpha of `src`*/
+
+static inline lv_color32_t LV_ATTRIBUTE_FAST_MEM additive_32(lv_color32_t dest, lv_color32_t src)
+{
+    src.red = LV_MIN(dest.red + src.red, 255);
+    src.green = LV_MIN(dest.green + src.green, 255);
+    src.blue = LV_MIN(dest.blue + src.blue, 255);
+    return src;
+}
+
+static inline lv_color32_t LV_ATTRIBUTE_FAST_MEM subtractive_32(lv_color32_t dest, lv_color32_t src)
+{
+    src.red = LV_MAX(dest.red - src.red, 0);
+    src.green = LV_MAX(dest.green - src.green, 0);
+    src.blue = LV_MAX(dest.blue - src.blue, 0);
+    return src;
+}
+
+static inline lv_color32_t LV_ATTRIBUTE_FAST_MEM multiply_32(lv_color32_t dest, lv_color32_t src)
+{
+    src.red = (dest.red * src.red) >> 8;
+    src.green = (dest.green * src.green) >> 8;
+    src.blue = (dest.blue * src.blue) >> 8;
+    return src;
+}
+
+static inline void LV_ATTRIBUTE_FAST_MEM lv_color_24_24_mix(lv_color32_t src, uint8_t * dest, uint8_t mix)
+{
+    if(mix == 0) return;
+
+    if(mix >= LV_OPA_MAX) {
+        dest[0] = src.blue;
+        dest[1] = src.green;
+        dest[2] = src.red;
+    }
+    else {
+        lv_opa_t mix_inv = 255 - mix;
+        dest[0] = (uint32_t)((uint32_t)src.blue * mix + dest[0] * mix_inv) >> 8;
+        dest[1] = (uint32_t)((uint32_t)src.green * mix + dest[1] * mix_inv) >> 8;
+        dest[2] = (uint32_t)((uint32_t)src.red * mix + dest[2] * mix_inv) >> 8;
+    }
+}
+
+static inline lv_color32_t LV_ATTRIBUTE_FAST_MEM lv_color_32_32_mix(lv_color32_t fg, lv_color32_t bg)
+{
+    /*Pick the foreground if it's fully opaque or the Background is fully transparent*/
+    if(fg.alpha >= LV_OPA_MAX || bg.alpha <= LV_OPA_MIN) {
+        return fg;
+    }
+    /*Transparent foreground: use the Background*/
+    else if(fg.alpha <= LV_OPA_MIN) {
+        return bg;
+    }
+    /*Opaque background: use simple mix*/
+    else if(bg.alpha == 255) {
+        return lv_color_mix32(fg, bg);
+    }
+    /*Both colors have alpha*/
+    else {
+        /*https://en.wikipedia.org/wiki/Alpha_compositing#Analytical_derivation_of_the_over_operator*/
+        lv_opa_t res_alpha = 255 - LV_OPA_MIX2(255 - fg.alpha, 255 - bg.alpha);
+        fg.alpha = (uint32_t)((uint32_t)fg.alpha * 255) / res_alpha;
+        lv_color32_t res = lv_color_mix32(fg, bg);
+        res.alpha = res_alpha;
+        return res;
+    }
+}
+
+#endif /*LV_USE_DRAW_SW*/
@@ -0,0 +1,61 @@
+/**
+ * @file lv_draw_sw_blend_mode.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_BLEND_MODE_H
+#define LV_DRAW_SW_BLEND_MODE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_draw_sw.h"
+#if LV_USE_DRAW_SW
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Blend an image to an RGB565 buffer with `LV_BLEND_MODE_ADDITIVE/SUBTRACTIVE/MULTIPLY`
+ * @param dsc       pointer to an initialized blend descriptor
+ */
+void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_mode_image_to_rgb565(_lv_draw_sw_blend_image_dsc_t * dsc);
+
+/**
+ * Blend an image to an RGB888 or XRGB8888 buffer with `LV_BLEND_MODE_ADDITIVE/SUBTRACTIVE/MULTIPLY`
+ * @param dsc           pointer to an initialized blend descriptor
+ * @param dest_px_size  3 for RGB888, 4 for XRGB8888
+ */
+void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_mode_image_to_rgb888(_lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                       uint32_t dest_px_size);
+
+/**
+ * Blend an image to an ARGB8888 buffer with `LV_BLEND_MODE_ADDITIVE/SUBTRACTIVE/MULTIPLY`
+ * @param dsc       pointer to an initialized blend descriptor
+ */
+void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_mode_image_to_argb8888(_lv_draw_sw_blend_image_dsc_t * dsc);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_DRAW_SW*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_BLEND_MODE_H*/
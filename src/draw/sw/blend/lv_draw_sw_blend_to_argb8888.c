@@ -10,6 +10,7 @@
 #if LV_USE_DRAW_SW
 
 #include "lv_draw_sw_blend.h"
+#include "lv_draw_sw_blend_mode.h"
 #include "../../../misc/lv_math.h"
 #include "../../../display/lv_display.h"
 #include "../../../core/lv_refr.h"
@@ -20,6 +21,8 @@
     #include "neon/lv_blend_neon.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_HELIUM
     #include "helium/lv_blend_helium.h"
+#elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+    #include "x86/lv_blend_x86.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
     #include LV_DRAW_SW_ASM_CUSTOM_INCLUDE
 #endif
@@ -65,8 +68,6 @@ static inline lv_color32_t /* LV_ATTRIBUTE_FAST_MEM */ lv_color_32_32_mix(lv_col
 
 static void lv_color_mix_with_alpha_cache_init(lv_color_mix_alpha_cache_t * cache);
 
-static inline void /* LV_ATTRIBUTE_FAST_MEM */ blend_non_normal_pixel(lv_color32_t * dest, lv_color32_t src,
-                                                                      lv_blend_mode_t mode, lv_color_mix_alpha_cache_t * cache);
 static inline void * /* LV_ATTRIBUTE_FAST_MEM */ drawbuf_next_row(const void * buf, uint32_t stride);
 
 /**********************
@@ -289,6 +290,12 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_argb8888(_lv_draw_sw_blend_
 
 void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_argb8888(_lv_draw_sw_blend_image_dsc_t * dsc)
 {
+    /*Additive, subtractive and multiply have their own row kernels*/
+    if(dsc->blend_mode != LV_BLEND_MODE_NORMAL) {
+        lv_draw_sw_blend_mode_image_to_argb8888(dsc);
+        return;
+    }
+
     switch(dsc->src_color_format) {
         case LV_COLOR_FORMAT_RGB565:
             rgb565_image_blend(dsc);
@@ -334,78 +341,58 @@ static void LV_ATTRIBUTE_FAST_MEM al88_image_blend(_lv_draw_sw_blend_image_dsc_t
     int32_t src_x;
     int32_t y;
 
-    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
-        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_ARGB8888(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
-                        /*
-                                                dest_buf_c32[dest_x].alpha = src_buf_al88[src_x].alpha;
-                                                dest_buf_c32[dest_x].red = src_buf_al88[src_x].lumi;
-                                                dest_buf_c32[dest_x].green = src_buf_al88[src_x].lumi;
-                                                dest_buf_c32[dest_x].blue = src_buf_al88[src_x].lumi;
-                                                */
-                        lv_color_8_32_mix(src_buf_al88[src_x].lumi, &dest_buf_c32[dest_x], src_buf_al88[src_x].alpha);
-                    }
-                    dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-                    src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
-                }
-            }
-        }
-        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
-                        lv_color_8_32_mix(src_buf_al88[src_x].lumi, &dest_buf_c32[dest_x], LV_OPA_MIX2(src_buf_al88[src_x].alpha, opa));
-                    }
-                    dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-                    src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
+    if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_ARGB8888(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                    /*
+                                            dest_buf_c32[dest_x].alpha = src_buf_al88[src_x].alpha;
+                                            dest_buf_c32[dest_x].red = src_buf_al88[src_x].lumi;
+                                            dest_buf_c32[dest_x].green = src_buf_al88[src_x].lumi;
+                                            dest_buf_c32[dest_x].blue = src_buf_al88[src_x].lumi;
+                                            */
+                    lv_color_8_32_mix(src_buf_al88[src_x].lumi, &dest_buf_c32[dest_x], src_buf_al88[src_x].alpha);
                 }
+                dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+                src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
             }
         }
-        else if(mask_buf && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
-                        lv_color_8_32_mix(src_buf_al88[src_x].lumi, &dest_buf_c32[dest_x], LV_OPA_MIX2(src_buf_al88[src_x].alpha,
-                                                                                                       mask_buf[src_x]));
-                    }
-                    dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-                    src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                    lv_color_8_32_mix(src_buf_al88[src_x].lumi, &dest_buf_c32[dest_x], LV_OPA_MIX2(src_buf_al88[src_x].alpha, opa));
                 }
+                dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+                src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
             }
         }
-        else if(mask_buf && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
-                        lv_color_8_32_mix(src_buf_al88[src_x].lumi, &dest_buf_c32[dest_x], LV_OPA_MIX3(src_buf_al88[src_x].alpha,
-                                                                                                       mask_buf[src_x], opa));
-                    }
-                    dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-                    src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                    lv_color_8_32_mix(src_buf_al88[src_x].lumi, &dest_buf_c32[dest_x], LV_OPA_MIX2(src_buf_al88[src_x].alpha,
+                                                                                                   mask_buf[src_x]));
                 }
+                dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+                src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
+                mask_buf += mask_stride;
             }
         }
     }
-    else {
-        lv_color32_t src_argb;
-        lv_color_mix_alpha_cache_t cache;
-        lv_color_mix_with_alpha_cache_init(&cache);
-        for(y = 0; y < h; y++) {
-            for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
-                src_argb.red = src_buf_al88[src_x].lumi;
-                src_argb.green = src_buf_al88[src_x].lumi;
-                src_argb.blue = src_buf_al88[src_x].lumi;
-                if(mask_buf == NULL) src_argb.alpha = LV_OPA_MIX2(src_buf_al88[src_x].alpha, opa);
-                else src_argb.alpha = LV_OPA_MIX3(src_buf_al88[src_x].alpha, mask_buf[dest_x], opa);
-                blend_non_normal_pixel(&dest_buf_c32[dest_x], src_argb, dsc->blend_mode, &cache);
+    else if(mask_buf && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                    lv_color_8_32_mix(src_buf_al88[src_x].lumi, &dest_buf_c32[dest_x], LV_OPA_MIX3(src_buf_al88[src_x].alpha,
+                                                                                                   mask_buf[src_x], opa));
+                }
+                dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+                src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
+                mask_buf += mask_stride;
             }
-            if(mask_buf) mask_buf += mask_stride;
-            dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-            src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
         }
     }
 }
@@ -426,73 +413,53 @@ static void LV_ATTRIBUTE_FAST_MEM l8_image_blend(_lv_draw_sw_blend_image_dsc_t *
     int32_t src_x;
     int32_t y;
 
-    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
-        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_ARGB8888(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
-                        dest_buf_c32[dest_x].alpha = src_buf_l8[src_x];
-                        dest_buf_c32[dest_x].red = src_buf_l8[src_x];
-                        dest_buf_c32[dest_x].green = src_buf_l8[src_x];
-                        dest_buf_c32[dest_x].blue = src_buf_l8[src_x];
-                    }
-                    dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-                    src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
-                }
-            }
-        }
-        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
-                        lv_color_8_32_mix(src_buf_l8[src_x], &dest_buf_c32[dest_x], opa);
-                    }
-                    dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-                    src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
+    if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_ARGB8888(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                    dest_buf_c32[dest_x].alpha = src_buf_l8[src_x];
+                    dest_buf_c32[dest_x].red = src_buf_l8[src_x];
+                    dest_buf_c32[dest_x].green = src_buf_l8[src_x];
+                    dest_buf_c32[dest_x].blue = src_buf_l8[src_x];
                 }
+                dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+                src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
             }
         }
-        else if(mask_buf && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
-                        lv_color_8_32_mix(src_buf_l8[src_x], &dest_buf_c32[dest_x], mask_buf[src_x]);
-                    }
-                    dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-                    src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                    lv_color_8_32_mix(src_buf_l8[src_x], &dest_buf_c32[dest_x], opa);
                 }
+                dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+                src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
             }
         }
-        else if(mask_buf && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
-                        lv_color_8_32_mix(src_buf_l8[src_x], &dest_buf_c32[dest_x], LV_OPA_MIX2(mask_buf[src_x], opa));
-                    }
-                    dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-                    src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                    lv_color_8_32_mix(src_buf_l8[src_x], &dest_buf_c32[dest_x], mask_buf[src_x]);
                 }
+                dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+                src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
+                mask_buf += mask_stride;
             }
         }
     }
-    else {
-        lv_color32_t src_argb;
-        lv_color_mix_alpha_cache_t cache;
-        lv_color_mix_with_alpha_cache_init(&cache);
-        for(y = 0; y < h; y++) {
-            for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
-                src_argb.red = src_buf_l8[src_x];
-                src_argb.green = src_buf_l8[src_x];
-                src_argb.blue = src_buf_l8[src_x];
-                if(mask_buf == NULL) src_argb.alpha = opa;
-                else src_argb.alpha = LV_OPA_MIX2(mask_buf[dest_x], opa);
-                blend_non_normal_pixel(&dest_buf_c32[dest_x], src_argb, dsc->blend_mode, &cache);
+    else if(mask_buf && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                    lv_color_8_32_mix(src_buf_l8[src_x], &dest_buf_c32[dest_x], LV_OPA_MIX2(mask_buf[src_x], opa));
+                }
+                dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+                src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
+                mask_buf += mask_stride;
             }
-            if(mask_buf) mask_buf += mask_stride;
-            dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-            src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
         }
     }
 }
@@ -518,76 +485,58 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(_lv_draw_sw_blend_image_dsc
 
     LV_UNUSED(color_argb);
 
-    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
-        if(mask_buf == NULL) {
-            lv_result_t accelerated;
-            if(opa >= LV_OPA_MAX) {
-                accelerated = LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888(dsc);
-            }
-            else {
-                accelerated = LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc);
-            }
-            if(LV_RESULT_INVALID == accelerated) {
-                color_argb.alpha = opa;
-                for(y = 0; y < h; y++) {
-                    for(x = 0; x < w; x++) {
-                        color_argb.red = (src_buf_c16[x].red * 2106) >> 8;  /*To make it rounded*/
-                        color_argb.green = (src_buf_c16[x].green * 1037) >> 8;
-                        color_argb.blue = (src_buf_c16[x].blue * 2106) >> 8;
-                        dest_buf_c32[x] = lv_color_32_32_mix(color_argb, dest_buf_c32[x], &cache);
-                    }
-                    dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-                    src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
-                }
-            }
+    if(mask_buf == NULL) {
+        lv_result_t accelerated;
+        if(opa >= LV_OPA_MAX) {
+            accelerated = LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888(dsc);
         }
-        else if(mask_buf && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(x = 0; x < w; x++) {
-                        color_argb.alpha = mask_buf[x];
-                        color_argb.red = (src_buf_c16[x].red * 2106) >> 8;  /*To make it rounded*/
-                        color_argb.green = (src_buf_c16[x].green * 1037) >> 8;
-                        color_argb.blue = (src_buf_c16[x].blue * 2106) >> 8;
-                        dest_buf_c32[x] = lv_color_32_32_mix(color_argb, dest_buf_c32[x], &cache);
-                    }
-                    dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-                    src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
-                    mask_buf += mask_stride;
+        else {
+            accelerated = LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc);
+        }
+        if(LV_RESULT_INVALID == accelerated) {
+            color_argb.alpha = opa;
+            for(y = 0; y < h; y++) {
+                for(x = 0; x < w; x++) {
+                    color_argb.red = (src_buf_c16[x].red * 2106) >> 8;  /*To make it rounded*/
+                    color_argb.green = (src_buf_c16[x].green * 1037) >> 8;
+                    color_argb.blue = (src_buf_c16[x].blue * 2106) >> 8;
+                    dest_buf_c32[x] = lv_color_32_32_mix(color_argb, dest_buf_c32[x], &cache);
                 }
+                dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+                src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
             }
         }
-        else {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(x = 0; x < w; x++) {
-                        color_argb.alpha = LV_OPA_MIX2(mask_buf[x], opa);
-                        color_argb.red = (src_buf_c16[x].red * 2106) >> 8;  /*To make it rounded*/
-                        color_argb.green = (src_buf_c16[x].green * 1037) >> 8;
-                        color_argb.blue = (src_buf_c16[x].blue * 2106) >> 8;
-                        dest_buf_c32[x] = lv_color_32_32_mix(color_argb, dest_buf_c32[x], &cache);
-                    }
-                    dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-                    src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(x = 0; x < w; x++) {
+                    color_argb.alpha = mask_buf[x];
+                    color_argb.red = (src_buf_c16[x].red * 2106) >> 8;  /*To make it rounded*/
+                    color_argb.green = (src_buf_c16[x].green * 1037) >> 8;
+                    color_argb.blue = (src_buf_c16[x].blue * 2106) >> 8;
+                    dest_buf_c32[x] = lv_color_32_32_mix(color_argb, dest_buf_c32[x], &cache);
                 }
+                dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+                src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
+                mask_buf += mask_stride;
             }
         }
     }
     else {
-        lv_color32_t src_argb;
-        for(y = 0; y < h; y++) {
-            for(x = 0; x < w; x++) {
-                src_argb.red = (src_buf_c16[x].red * 2106) >> 8;
-                src_argb.green = (src_buf_c16[x].green * 1037) >> 8;
-                src_argb.blue = (src_buf_c16[x].blue * 2106) >> 8;
-                if(mask_buf == NULL) src_argb.alpha = opa;
-                else src_argb.alpha = LV_OPA_MIX2(mask_buf[x], opa);
-                blend_non_normal_pixel(&dest_buf_c32[x], src_argb, dsc->blend_mode, &cache);
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(x = 0; x < w; x++) {
+                    color_argb.alpha = LV_OPA_MIX2(mask_buf[x], opa);
+                    color_argb.red = (src_buf_c16[x].red * 2106) >> 8;  /*To make it rounded*/
+                    color_argb.green = (src_buf_c16[x].green * 1037) >> 8;
+                    color_argb.blue = (src_buf_c16[x].blue * 2106) >> 8;
+                    dest_buf_c32[x] = lv_color_32_32_mix(color_argb, dest_buf_c32[x], &cache);
+                }
+                dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+                src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
+                mask_buf += mask_stride;
             }
-            if(mask_buf) mask_buf += mask_stride;
-            dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-            src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
         }
     }
 }
@@ -615,97 +564,78 @@ static void LV_ATTRIBUTE_FAST_MEM rgb888_image_blend(_lv_draw_sw_blend_image_dsc
 
     LV_UNUSED(color_argb);
 
-    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
-        /*Special case*/
-        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888(dsc, src_px_size)) {
-                if(src_px_size == 4) {
-                    uint32_t line_in_bytes = w * 4;
-                    for(y = 0; y < h; y++) {
-                        lv_memcpy(dest_buf_c32, src_buf, line_in_bytes);
-                        dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-                        src_buf = drawbuf_next_row(src_buf, src_stride);
-                    }
-                }
-                else if(src_px_size == 3) {
-                    for(y = 0; y < h; y++) {
-                        for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 3) {
-                            dest_buf_c32[dest_x].red = src_buf[src_x + 2];
-                            dest_buf_c32[dest_x].green = src_buf[src_x + 1];
-                            dest_buf_c32[dest_x].blue = src_buf[src_x + 0];
-                            dest_buf_c32[dest_x].alpha = 0xff;
-                        }
-                        dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-                        src_buf = drawbuf_next_row(src_buf, src_stride);
-                    }
-                }
-            }
-
-        }
-        if(mask_buf == NULL && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc, src_px_size)) {
-                color_argb.alpha = opa;
+    /*Special case*/
+    if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888(dsc, src_px_size)) {
+            if(src_px_size == 4) {
+                uint32_t line_in_bytes = w * 4;
                 for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
-                        color_argb.red = src_buf[src_x + 2];
-                        color_argb.green = src_buf[src_x + 1];
-                        color_argb.blue = src_buf[src_x + 0];
-                        dest_buf_c32[dest_x] = lv_color_32_32_mix(color_argb, dest_buf_c32[dest_x], &cache);
-                    }
+                    lv_memcpy(dest_buf_c32, src_buf, line_in_bytes);
                     dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
                     src_buf = drawbuf_next_row(src_buf, src_stride);
                 }
             }
-
-        }
-        if(mask_buf && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc, src_px_size)) {
+            else if(src_px_size == 3) {
                 for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
-                        color_argb.alpha = mask_buf[dest_x];
-                        color_argb.red = src_buf[src_x + 2];
-                        color_argb.green = src_buf[src_x + 1];
-                        color_argb.blue = src_buf[src_x + 0];
-                        dest_buf_c32[dest_x] = lv_color_32_32_mix(color_argb, dest_buf_c32[dest_x], &cache);
+                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 3) {
+                        dest_buf_c32[dest_x].red = src_buf[src_x + 2];
+                        dest_buf_c32[dest_x].green = src_buf[src_x + 1];
+                        dest_buf_c32[dest_x].blue = src_buf[src_x + 0];
+                        dest_buf_c32[dest_x].alpha = 0xff;
                     }
                     dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
                     src_buf = drawbuf_next_row(src_buf, src_stride);
-                    mask_buf += mask_stride;
                 }
             }
         }
-        if(mask_buf && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc, src_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
-                        color_argb.alpha = (opa * mask_buf[dest_x]) >> 8;
-                        color_argb.red = src_buf[src_x + 2];
-                        color_argb.green = src_buf[src_x + 1];
-                        color_argb.blue = src_buf[src_x + 0];
-                        dest_buf_c32[dest_x] = lv_color_32_32_mix(color_argb, dest_buf_c32[dest_x], &cache);
-                    }
-                    dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-                    src_buf = drawbuf_next_row(src_buf, src_stride);
-                    mask_buf += mask_stride;
+
+    }
+    if(mask_buf == NULL && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc, src_px_size)) {
+            color_argb.alpha = opa;
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
+                    color_argb.red = src_buf[src_x + 2];
+                    color_argb.green = src_buf[src_x + 1];
+                    color_argb.blue = src_buf[src_x + 0];
+                    dest_buf_c32[dest_x] = lv_color_32_32_mix(color_argb, dest_buf_c32[dest_x], &cache);
                 }
+                dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+                src_buf = drawbuf_next_row(src_buf, src_stride);
             }
         }
+
     }
-    else {
-        lv_color32_t src_argb;
-        for(y = 0; y < h; y++) {
-            for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
-                src_argb.red = src_buf[src_x + 2];
-                src_argb.green = src_buf[src_x + 1];
-                src_argb.blue = src_buf[src_x + 0];
-                if(mask_buf == NULL) src_argb.alpha = opa;
-                else src_argb.alpha = LV_OPA_MIX2(mask_buf[dest_x], opa);
-
-                blend_non_normal_pixel(&dest_buf_c32[dest_x], src_argb, dsc->blend_mode, &cache);
+    if(mask_buf && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc, src_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
+                    color_argb.alpha = mask_buf[dest_x];
+                    color_argb.red = src_buf[src_x + 2];
+                    color_argb.green = src_buf[src_x + 1];
+                    color_argb.blue = src_buf[src_x + 0];
+                    dest_buf_c32[dest_x] = lv_color_32_32_mix(color_argb, dest_buf_c32[dest_x], &cache);
+                }
+                dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+                src_buf = drawbuf_next_row(src_buf, src_stride);
+                mask_buf += mask_stride;
+            }
+        }
+    }
+    if(mask_buf && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc, src_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
+                    color_argb.alpha = (opa * mask_buf[dest_x]) >> 8;
+                    color_argb.red = src_buf[src_x + 2];
+                    color_argb.green = src_buf[src_x + 1];
+                    color_argb.blue = src_buf[src_x + 0];
+                    dest_buf_c32[dest_x] = lv_color_32_32_mix(color_argb, dest_buf_c32[dest_x], &cache);
+                }
+                dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+                src_buf = drawbuf_next_row(src_buf, src_stride);
+                mask_buf += mask_stride;
             }
-            if(mask_buf) mask_buf += mask_stride;
-            dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-            src_buf = drawbuf_next_row(src_buf, src_stride);
         }
     }
 }
@@ -729,71 +659,56 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(_lv_draw_sw_blend_image_d
     int32_t x;
     int32_t y;
 
-    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
-        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(x = 0; x < w; x++) {
-                        dest_buf_c32[x] = lv_color_32_32_mix(src_buf_c32[x], dest_buf_c32[x], &cache);
-                    }
-                    dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-                    src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
-                }
-            }
-        }
-        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(x = 0; x < w; x++) {
-                        color_argb = src_buf_c32[x];
-                        color_argb.alpha = LV_OPA_MIX2(color_argb.alpha, opa);
-                        dest_buf_c32[x] = lv_color_32_32_mix(color_argb, dest_buf_c32[x], &cache);
-                    }
-                    dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-                    src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+    if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(x = 0; x < w; x++) {
+                    dest_buf_c32[x] = lv_color_32_32_mix(src_buf_c32[x], dest_buf_c32[x], &cache);
                 }
+                dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+                src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
             }
         }
-        else if(mask_buf && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(x = 0; x < w; x++) {
-                        color_argb = src_buf_c32[x];
-                        color_argb.alpha = LV_OPA_MIX2(color_argb.alpha, mask_buf[x]);
-                        dest_buf_c32[x] = lv_color_32_32_mix(color_argb, dest_buf_c32[x], &cache);
-                    }
-                    dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-                    src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(x = 0; x < w; x++) {
+                    color_argb = src_buf_c32[x];
+                    color_argb.alpha = LV_OPA_MIX2(color_argb.alpha, opa);
+                    dest_buf_c32[x] = lv_color_32_32_mix(color_argb, dest_buf_c32[x], &cache);
                 }
+                dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+                src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
             }
         }
-        else if(mask_buf && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(x = 0; x < w; x++) {
-                        color_argb = src_buf_c32[x];
-                        color_argb.alpha = LV_OPA_MIX3(color_argb.alpha, opa, mask_buf[x]);
-                        dest_buf_c32[x] = lv_color_32_32_mix(color_argb, dest_buf_c32[x], &cache);
-                    }
-                    dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-                    src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(x = 0; x < w; x++) {
+                    color_argb = src_buf_c32[x];
+                    color_argb.alpha = LV_OPA_MIX2(color_argb.alpha, mask_buf[x]);
+                    dest_buf_c32[x] = lv_color_32_32_mix(color_argb, dest_buf_c32[x], &cache);
                 }
+                dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+                src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+                mask_buf += mask_stride;
             }
         }
     }
-    else {
-        for(y = 0; y < h; y++) {
-            for(x = 0; x < w; x++) {
-                color_argb = src_buf_c32[x];
-                if(mask_buf == NULL) color_argb.alpha = LV_OPA_MIX2(color_argb.alpha, opa);
-                else color_argb.alpha = LV_OPA_MIX3(color_argb.alpha, mask_buf[x], opa);
-                blend_non_normal_pixel(&dest_buf_c32[x], color_argb, dsc->blend_mode, &cache);
+    else if(mask_buf && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(x = 0; x < w; x++) {
+                    color_argb = src_buf_c32[x];
+                    color_argb.alpha = LV_OPA_MIX3(color_argb.alpha, opa, mask_buf[x]);
+                    dest_buf_c32[x] = lv_color_32_32_mix(color_argb, dest_buf_c32[x], &cache);
+                }
+                dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+                src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+                mask_buf += mask_stride;
             }
-            if(mask_buf) mask_buf += mask_stride;
-            dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
-            src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
         }
     }
 }
@@ -866,34 +781,6 @@ void lv_color_mix_with_alpha_cache_init(lv_color_mix_alpha_cache_t * cache)
     cache->ratio_saved = 255;
 }
 
-static inline void LV_ATTRIBUTE_FAST_MEM blend_non_normal_pixel(lv_color32_t * dest, lv_color32_t src,
-                                                                lv_blend_mode_t mode, lv_color_mix_alpha_cache_t * cache)
-{
-    lv_color32_t res;
-    switch(mode) {
-        case LV_BLEND_MODE_ADDITIVE:
-            res.red = LV_MIN(dest->red + src.red, 255);
-            res.green = LV_MIN(dest->green + src.green, 255);
-            res.blue = LV_MIN(dest->blue + src.blue, 255);
-            break;
-        case LV_BLEND_MODE_SUBTRACTIVE:
-            res.red = LV_MAX(dest->red - src.red, 0);
-            res.green = LV_MAX(dest->green - src.green, 0);
-            res.blue = LV_MAX(dest->blue - src.blue, 0);
-            break;
-        case LV_BLEND_MODE_MULTIPLY:
-            res.red = (dest->red * src.red) >> 8;
-            res.green = (dest->green * src.green) >> 8;
-            res.blue = (dest->blue * src.blue) >> 8;
-            break;
-        default:
-            LV_LOG_WARN("Not supported blend mode: %d", mode);
-            return;
-    }
-    res.alpha = src.alpha;
-    *dest = lv_color_32_32_mix(res, *dest, cache);
-}
-
 static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride)
 {
     return (void *)((uint8_t *)buf + stride);
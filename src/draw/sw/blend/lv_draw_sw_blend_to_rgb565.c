@@ -10,6 +10,7 @@
 #if LV_USE_DRAW_SW
 
 #include "lv_draw_sw_blend.h"
+#include "lv_draw_sw_blend_mode.h"
 #include "../../../misc/lv_math.h"
 #include "../../../display/lv_display.h"
 #include "../../../core/lv_refr.h"
@@ -20,6 +21,8 @@
     #include "neon/lv_blend_neon.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_HELIUM
     #include "helium/lv_blend_helium.h"
+#elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+    #include "x86/lv_blend_x86.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
     #include LV_DRAW_SW_ASM_CUSTOM_INCLUDE
 #endif
@@ -331,6 +334,12 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_rgb565(_lv_draw_sw_blend_fi
 
 void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_rgb565(_lv_draw_sw_blend_image_dsc_t * dsc)
 {
+    /*Additive, subtractive and multiply have their own row kernels*/
+    if(dsc->blend_mode != LV_BLEND_MODE_NORMAL) {
+        lv_draw_sw_blend_mode_image_to_rgb565(dsc);
+        return;
+    }
+
     switch(dsc->src_color_format) {
         case LV_COLOR_FORMAT_RGB565:
             rgb565_image_blend(dsc);
@@ -376,100 +385,53 @@ static void LV_ATTRIBUTE_FAST_MEM al88_image_blend(_lv_draw_sw_blend_image_dsc_t
     int32_t src_x;
     int32_t y;
 
-    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
-        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
-                        dest_buf_u16[dest_x] = lv_color_8_16_mix(src_buf_al88[src_x].lumi, dest_buf_u16[dest_x], src_buf_al88[src_x].alpha);
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
-                }
-            }
-        }
-        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
-                        dest_buf_u16[dest_x] = lv_color_8_16_mix(src_buf_al88[src_x].lumi, dest_buf_u16[dest_x],
-                                                                 LV_OPA_MIX2(src_buf_al88[src_x].alpha, opa));
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
+    if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
+                    dest_buf_u16[dest_x] = lv_color_8_16_mix(src_buf_al88[src_x].lumi, dest_buf_u16[dest_x], src_buf_al88[src_x].alpha);
                 }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
             }
         }
-        else if(mask_buf && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
-                        dest_buf_u16[dest_x] = lv_color_8_16_mix(src_buf_al88[src_x].lumi, dest_buf_u16[dest_x],
-                                                                 LV_OPA_MIX2(src_buf_al88[src_x].alpha, mask_buf[dest_x]));
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
+                    dest_buf_u16[dest_x] = lv_color_8_16_mix(src_buf_al88[src_x].lumi, dest_buf_u16[dest_x],
+                                                             LV_OPA_MIX2(src_buf_al88[src_x].alpha, opa));
                 }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
             }
         }
-        else if(mask_buf && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
-                        dest_buf_u16[dest_x] = lv_color_8_16_mix(src_buf_al88[src_x].lumi, dest_buf_u16[dest_x],
-                                                                 LV_OPA_MIX3(src_buf_al88[src_x].alpha, mask_buf[dest_x], opa));
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
+                    dest_buf_u16[dest_x] = lv_color_8_16_mix(src_buf_al88[src_x].lumi, dest_buf_u16[dest_x],
+                                                             LV_OPA_MIX2(src_buf_al88[src_x].alpha, mask_buf[dest_x]));
                 }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
+                mask_buf += mask_stride;
             }
         }
     }
-    else {
-        uint16_t res = 0;
-        for(y = 0; y < h; y++) {
-            lv_color16_t * dest_buf_c16 = (lv_color16_t *)dest_buf_u16;
-            for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
-                uint8_t rb = src_buf_al88[src_x].lumi >> 3;
-                uint8_t g = src_buf_al88[src_x].lumi >> 2;
-                switch(dsc->blend_mode) {
-                    case LV_BLEND_MODE_ADDITIVE:
-                        res = (LV_MIN(dest_buf_c16[dest_x].red + rb, 31)) << 11;
-                        res += (LV_MIN(dest_buf_c16[dest_x].green + g, 63)) << 5;
-                        res += LV_MIN(dest_buf_c16[dest_x].blue + rb, 31);
-                        break;
-                    case LV_BLEND_MODE_SUBTRACTIVE:
-                        res = (LV_MAX(dest_buf_c16[dest_x].red - rb, 0)) << 11;
-                        res += (LV_MAX(dest_buf_c16[dest_x].green - g, 0)) << 5;
-                        res += LV_MAX(dest_buf_c16[dest_x].blue - rb, 0);
-                        break;
-                    case LV_BLEND_MODE_MULTIPLY:
-                        res = ((dest_buf_c16[dest_x].red * rb) >> 5) << 11;
-                        res += ((dest_buf_c16[dest_x].green * g) >> 6) << 5;
-                        res += (dest_buf_c16[dest_x].blue * rb) >> 5;
-                        break;
-                    default:
-                        LV_LOG_WARN("Not supported blend mode: %d", dsc->blend_mode);
-                        return;
-                }
-                if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-                    dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], src_buf_al88[src_x].alpha);
-                }
-                else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-                    dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], LV_OPA_MIX2(opa, src_buf_al88[src_x].alpha));
-                }
-                else {
-                    if(opa >= LV_OPA_MAX) dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], mask_buf[dest_x]);
-                    else dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], LV_OPA_MIX3(mask_buf[dest_x], opa,
-                                                                                                              src_buf_al88[src_x].alpha));
+    else if(mask_buf && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
+                    dest_buf_u16[dest_x] = lv_color_8_16_mix(src_buf_al88[src_x].lumi, dest_buf_u16[dest_x],
+                                                             LV_OPA_MIX3(src_buf_al88[src_x].alpha, mask_buf[dest_x], opa));
                 }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
+                mask_buf += mask_stride;
             }
-
-            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-            src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
-            if(mask_buf) mask_buf += mask_stride;
         }
     }
 }
@@ -490,97 +452,50 @@ static void LV_ATTRIBUTE_FAST_MEM l8_image_blend(_lv_draw_sw_blend_image_dsc_t *
     int32_t src_x;
     int32_t y;
 
-    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
-        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
-                        dest_buf_u16[dest_x] = l8_to_rgb565(src_buf_l8[src_x]);
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_l8 += src_stride;
-                }
-            }
-        }
-        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
-                        dest_buf_u16[dest_x] = lv_color_8_16_mix(src_buf_l8[src_x], dest_buf_u16[dest_x], opa);
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_l8 += src_stride;
+    if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
+                    dest_buf_u16[dest_x] = l8_to_rgb565(src_buf_l8[src_x]);
                 }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_l8 += src_stride;
             }
         }
-        else if(mask_buf && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
-                        dest_buf_u16[dest_x] = lv_color_8_16_mix(src_buf_l8[src_x], dest_buf_u16[dest_x], mask_buf[dest_x]);
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_l8 += src_stride;
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
+                    dest_buf_u16[dest_x] = lv_color_8_16_mix(src_buf_l8[src_x], dest_buf_u16[dest_x], opa);
                 }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_l8 += src_stride;
             }
         }
-        else if(mask_buf && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
-                        dest_buf_u16[dest_x] = lv_color_8_16_mix(src_buf_l8[src_x], dest_buf_u16[dest_x], LV_OPA_MIX2(mask_buf[dest_x], opa));
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_l8 += src_stride;
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
+                    dest_buf_u16[dest_x] = lv_color_8_16_mix(src_buf_l8[src_x], dest_buf_u16[dest_x], mask_buf[dest_x]);
                 }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_l8 += src_stride;
+                mask_buf += mask_stride;
             }
         }
     }
-    else {
-        uint16_t res = 0;
-        for(y = 0; y < h; y++) {
-            lv_color16_t * dest_buf_c16 = (lv_color16_t *)dest_buf_u16;
-            for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
-                uint8_t rb = src_buf_l8[src_x] >> 3;
-                uint8_t g = src_buf_l8[src_x] >> 2;
-                switch(dsc->blend_mode) {
-                    case LV_BLEND_MODE_ADDITIVE:
-                        res = (LV_MIN(dest_buf_c16[dest_x].red + rb, 31)) << 11;
-                        res += (LV_MIN(dest_buf_c16[dest_x].green + g, 63)) << 5;
-                        res += LV_MIN(dest_buf_c16[dest_x].blue + rb, 31);
-                        break;
-                    case LV_BLEND_MODE_SUBTRACTIVE:
-                        res = (LV_MAX(dest_buf_c16[dest_x].red - rb, 0)) << 11;
-                        res += (LV_MAX(dest_buf_c16[dest_x].green - g, 0)) << 5;
-                        res += LV_MAX(dest_buf_c16[dest_x].blue - rb, 0);
-                        break;
-                    case LV_BLEND_MODE_MULTIPLY:
-                        res = ((dest_buf_c16[dest_x].red * rb) >> 5) << 11;
-                        res += ((dest_buf_c16[dest_x].green * g) >> 6) << 5;
-                        res += (dest_buf_c16[dest_x].blue * rb) >> 5;
-                        break;
-                    default:
-                        LV_LOG_WARN("Not supported blend mode: %d", dsc->blend_mode);
-                        return;
-                }
-
-                if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-                    dest_buf_u16[dest_x] = res;
-                }
-                else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-                    dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], opa);
-                }
-                else {
-                    if(opa >= LV_OPA_MAX) dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], mask_buf[dest_x]);
-                    else dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], LV_OPA_MIX2(mask_buf[dest_x], opa));
+    else if(mask_buf && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
+                    dest_buf_u16[dest_x] = lv_color_8_16_mix(src_buf_l8[src_x], dest_buf_u16[dest_x], LV_OPA_MIX2(mask_buf[dest_x], opa));
                 }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_l8 += src_stride;
+                mask_buf += mask_stride;
             }
-
-            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-            src_buf_l8 += src_stride;
-            if(mask_buf) mask_buf += mask_stride;
         }
     }
 }
@@ -600,95 +515,49 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(_lv_draw_sw_blend_image_dsc
     int32_t x;
     int32_t y;
 
-    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
-        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565(dsc)) {
-                uint32_t line_in_bytes = w * 2;
-                for(y = 0; y < h; y++) {
-                    lv_memcpy(dest_buf_u16, src_buf_u16, line_in_bytes);
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
-                }
-            }
-        }
-        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(x = 0; x < w; x++) {
-                        dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], opa);
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
-                }
+    if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565(dsc)) {
+            uint32_t line_in_bytes = w * 2;
+            for(y = 0; y < h; y++) {
+                lv_memcpy(dest_buf_u16, src_buf_u16, line_in_bytes);
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
             }
         }
-        else if(mask_buf && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(x = 0; x < w; x++) {
-                        dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], mask_buf[x]);
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(x = 0; x < w; x++) {
+                    dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], opa);
                 }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
             }
         }
-        else {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(x = 0; x < w; x++) {
-                        dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], LV_OPA_MIX2(mask_buf[x], opa));
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(x = 0; x < w; x++) {
+                    dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], mask_buf[x]);
                 }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
+                mask_buf += mask_stride;
             }
         }
     }
     else {
-        uint16_t res = 0;
-        for(y = 0; y < h; y++) {
-            lv_color16_t * dest_buf_c16 = (lv_color16_t *) dest_buf_u16;
-            lv_color16_t * src_buf_c16 = (lv_color16_t *) src_buf_u16;
-            for(x = 0; x < w; x++) {
-                switch(dsc->blend_mode) {
-                    case LV_BLEND_MODE_ADDITIVE:
-                        if(src_buf_u16[x] == 0x0000) continue;   /*Do not add pure black*/
-                        res = (LV_MIN(dest_buf_c16[x].red + src_buf_c16[x].red, 31)) << 11;
-                        res += (LV_MIN(dest_buf_c16[x].green + src_buf_c16[x].green, 63)) << 5;
-                        res += LV_MIN(dest_buf_c16[x].blue + src_buf_c16[x].blue, 31);
-                        break;
-                    case LV_BLEND_MODE_SUBTRACTIVE:
-                        if(src_buf_u16[x] == 0x0000) continue;   /*Do not subtract pure black*/
-                        res = (LV_MAX(dest_buf_c16[x].red - src_buf_c16[x].red, 0)) << 11;
-                        res += (LV_MAX(dest_buf_c16[x].green - src_buf_c16[x].green, 0)) << 5;
-                        res += LV_MAX(dest_buf_c16[x].blue - src_buf_c16[x].blue, 0);
-                        break;
-                    case LV_BLEND_MODE_MULTIPLY:
-                        if(src_buf_u16[x] == 0xffff) continue;   /*Do not multiply with pure white (considered as 1)*/
-                        res = ((dest_buf_c16[x].red * src_buf_c16[x].red) >> 5) << 11;
-                        res += ((dest_buf_c16[x].green * src_buf_c16[x].green) >> 6) << 5;
-                        res += (dest_buf_c16[x].blue * src_buf_c16[x].blue) >> 5;
-                        break;
-                    default:
-                        LV_LOG_WARN("Not supported blend mode: %d", dsc->blend_mode);
-                        return;
-                }
-
-                if(mask_buf == NULL) {
-                    dest_buf_u16[x] = lv_color_16_16_mix(res, dest_buf_u16[x], opa);
-                }
-                else {
-                    if(opa >= LV_OPA_MAX) dest_buf_u16[x] = lv_color_16_16_mix(res, dest_buf_u16[x], mask_buf[x]);
-                    else dest_buf_u16[x] = lv_color_16_16_mix(res, dest_buf_u16[x], LV_OPA_MIX2(mask_buf[x], opa));
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(x = 0; x < w; x++) {
+                    dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], LV_OPA_MIX2(mask_buf[x], opa));
                 }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
+                mask_buf += mask_stride;
             }
-
-            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-            src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
-            if(mask_buf) mask_buf += mask_stride;
         }
     }
 }
@@ -709,95 +578,53 @@ static void LV_ATTRIBUTE_FAST_MEM rgb888_image_blend(_lv_draw_sw_blend_image_dsc
     int32_t src_x;
     int32_t y;
 
-    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
-        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565(dsc, src_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
-                        dest_buf_u16[dest_x]  = ((src_buf_u8[src_x + 2] & 0xF8) << 8) +
-                                                ((src_buf_u8[src_x + 1] & 0xFC) << 3) +
-                                                ((src_buf_u8[src_x + 0] & 0xF8) >> 3);
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u8 += src_stride;
-                }
-            }
-        }
-        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc, src_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
-                        dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x], opa);
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u8 += src_stride;
+    if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565(dsc, src_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
+                    dest_buf_u16[dest_x]  = ((src_buf_u8[src_x + 2] & 0xF8) << 8) +
+                                            ((src_buf_u8[src_x + 1] & 0xFC) << 3) +
+                                            ((src_buf_u8[src_x + 0] & 0xF8) >> 3);
                 }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_u8 += src_stride;
             }
         }
-        if(mask_buf && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc, src_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
-                        dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x], mask_buf[dest_x]);
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u8 += src_stride;
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc, src_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
+                    dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x], opa);
                 }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_u8 += src_stride;
             }
         }
-        if(mask_buf && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc, src_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
-                        dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x], LV_OPA_MIX2(mask_buf[dest_x], opa));
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u8 += src_stride;
-                    mask_buf += mask_stride;
+    }
+    if(mask_buf && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc, src_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
+                    dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x], mask_buf[dest_x]);
                 }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_u8 += src_stride;
+                mask_buf += mask_stride;
             }
         }
     }
-    else {
-        uint16_t res = 0;
-        for(y = 0; y < h; y++) {
-            lv_color16_t * dest_buf_c16 = (lv_color16_t *) dest_buf_u16;
-            for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
-                switch(dsc->blend_mode) {
-                    case LV_BLEND_MODE_ADDITIVE:
-                        res = (LV_MIN(dest_buf_c16[dest_x].red + (src_buf_u8[src_x + 2] >> 3), 31)) << 11;
-                        res += (LV_MIN(dest_buf_c16[dest_x].green + (src_buf_u8[src_x + 1] >> 2), 63)) << 5;
-                        res += LV_MIN(dest_buf_c16[dest_x].blue + (src_buf_u8[src_x + 0] >> 3), 31);
-                        break;
-                    case LV_BLEND_MODE_SUBTRACTIVE:
-                        res = (LV_MAX(dest_buf_c16[dest_x].red - (src_buf_u8[src_x + 2] >> 3), 0)) << 11;
-                        res += (LV_MAX(dest_buf_c16[dest_x].green - (src_buf_u8[src_x + 1] >> 2), 0)) << 5;
-                        res += LV_MAX(dest_buf_c16[dest_x].blue - (src_buf_u8[src_x + 0] >> 3), 0);
-                        break;
-                    case LV_BLEND_MODE_MULTIPLY:
-                        res = ((dest_buf_c16[dest_x].red * (src_buf_u8[src_x + 2] >> 3)) >> 5) << 11;
-                        res += ((dest_buf_c16[dest_x].green * (src_buf_u8[src_x + 1] >> 2)) >> 6) << 5;
-                        res += (dest_buf_c16[dest_x].blue * (src_buf_u8[src_x + 0] >> 3)) >> 5;
-                        break;
-                    default:
-                        LV_LOG_WARN("Not supported blend mode: %d", dsc->blend_mode);
-                        return;
-                }
-
-                if(mask_buf == NULL) {
-                    dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], opa);
-                }
-                else {
-                    if(opa >= LV_OPA_MAX) dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], mask_buf[dest_x]);
-                    else dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], LV_OPA_MIX2(mask_buf[dest_x], opa));
+    if(mask_buf && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc, src_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
+                    dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x], LV_OPA_MIX2(mask_buf[dest_x], opa));
                 }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_u8 += src_stride;
+                mask_buf += mask_stride;
             }
-            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-            src_buf_u8 += src_stride;
-            if(mask_buf) mask_buf += mask_stride;
         }
-
     }
 }
 
@@ -817,99 +644,53 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(_lv_draw_sw_blend_image_d
     int32_t src_x;
     int32_t y;
 
-    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
-        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
-                        dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x], src_buf_u8[src_x + 3]);
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u8 += src_stride;
-                }
-            }
-        }
-        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
-                        dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x], LV_OPA_MIX2(src_buf_u8[src_x + 3],
-                                                                                                                        opa));
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u8 += src_stride;
+    if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
+                    dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x], src_buf_u8[src_x + 3]);
                 }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_u8 += src_stride;
             }
         }
-        else if(mask_buf && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
-                        dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x],
-                                                                  LV_OPA_MIX2(src_buf_u8[src_x + 3], mask_buf[dest_x]));
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u8 += src_stride;
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
+                    dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x], LV_OPA_MIX2(src_buf_u8[src_x + 3],
+                                                                                                                    opa));
                 }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_u8 += src_stride;
             }
         }
-        else if(mask_buf && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
-                        dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x],
-                                                                  LV_OPA_MIX3(src_buf_u8[src_x + 3], mask_buf[dest_x], opa));
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u8 += src_stride;
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
+                    dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x],
+                                                              LV_OPA_MIX2(src_buf_u8[src_x + 3], mask_buf[dest_x]));
                 }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_u8 += src_stride;
+                mask_buf += mask_stride;
             }
         }
     }
-    else {
-        uint16_t res = 0;
-        for(y = 0; y < h; y++) {
-            lv_color16_t * dest_buf_c16 = (lv_color16_t *) dest_buf_u16;
-            for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
-                switch(dsc->blend_mode) {
-                    case LV_BLEND_MODE_ADDITIVE:
-                        res = (LV_MIN(dest_buf_c16[dest_x].red + (src_buf_u8[src_x + 2] >> 3), 31)) << 11;
-                        res += (LV_MIN(dest_buf_c16[dest_x].green + (src_buf_u8[src_x + 1] >> 2), 63)) << 5;
-                        res += LV_MIN(dest_buf_c16[dest_x].blue + (src_buf_u8[src_x + 0] >> 3), 31);
-                        break;
-                    case LV_BLEND_MODE_SUBTRACTIVE:
-                        res = (LV_MAX(dest_buf_c16[dest_x].red - (src_buf_u8[src_x + 2] >> 3), 0)) << 11;
-                        res += (LV_MAX(dest_buf_c16[dest_x].green - (src_buf_u8[src_x + 1] >> 2), 0)) << 5;
-                        res += LV_MAX(dest_buf_c16[dest_x].blue - (src_buf_u8[src_x + 0] >> 3), 0);
-                        break;
-                    case LV_BLEND_MODE_MULTIPLY:
-                        res = ((dest_buf_c16[dest_x].red * (src_buf_u8[src_x + 2] >> 3)) >> 5) << 11;
-                        res += ((dest_buf_c16[dest_x].green * (src_buf_u8[src_x + 1] >> 2)) >> 6) << 5;
-                        res += (dest_buf_c16[dest_x].blue * (src_buf_u8[src_x + 0] >> 3)) >> 5;
-                        break;
-                    default:
-                        LV_LOG_WARN("Not supported blend mode: %d", dsc->blend_mode);
-                        return;
-                }
-
-                if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-                    dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], src_buf_u8[src_x + 3]);
-                }
-                else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-                    dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], LV_OPA_MIX2(opa, src_buf_u8[src_x + 3]));
-                }
-                else {
-                    if(opa >= LV_OPA_MAX) dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], mask_buf[dest_x]);
-                    else dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], LV_OPA_MIX3(mask_buf[dest_x], opa,
-                                                                                                              src_buf_u8[src_x + 3]));
+    else if(mask_buf && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
+                    dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x],
+                                                              LV_OPA_MIX3(src_buf_u8[src_x + 3], mask_buf[dest_x], opa));
                 }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_u8 += src_stride;
+                mask_buf += mask_stride;
             }
-
-            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-            src_buf_u8 += src_stride;
-            if(mask_buf) mask_buf += mask_stride;
         }
     }
 }
@@ -10,6 +10,7 @@
 #if LV_USE_DRAW_SW
 
 #include "lv_draw_sw_blend.h"
+#include "lv_draw_sw_blend_mode.h"
 #include "../../../misc/lv_math.h"
 #include "../../../display/lv_display.h"
 #include "../../../core/lv_refr.h"
@@ -20,6 +21,8 @@
     #include "neon/lv_blend_neon.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_HELIUM
     #include "helium/lv_blend_helium.h"
+#elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+    #include "x86/lv_blend_x86.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
     #include LV_DRAW_SW_ASM_CUSTOM_INCLUDE
 #endif
@@ -53,8 +56,6 @@ static inline void /* LV_ATTRIBUTE_FAST_MEM */ lv_color_8_24_mix(const uint8_t s
 
 static inline void /* LV_ATTRIBUTE_FAST_MEM */ lv_color_24_24_mix(const uint8_t * src, uint8_t * dest, uint8_t mix);
 
-static inline void /* LV_ATTRIBUTE_FAST_MEM */ blend_non_normal_pixel(uint8_t * dest, lv_color32_t src,
-                                                                      lv_blend_mode_t mode);
 static inline void * /* LV_ATTRIBUTE_FAST_MEM */ drawbuf_next_row(const void * buf, uint32_t stride);
 
 /**********************
@@ -278,6 +279,11 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_rgb888(_lv_draw_sw_blend_fi
 
 void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_rgb888(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dest_px_size)
 {
+    /*Additive, subtractive and multiply have their own row kernels*/
+    if(dsc->blend_mode != LV_BLEND_MODE_NORMAL) {
+        lv_draw_sw_blend_mode_image_to_rgb888(dsc, dest_px_size);
+        return;
+    }
 
     switch(dsc->src_color_format) {
         case LV_COLOR_FORMAT_RGB565:
@@ -324,68 +330,52 @@ static void LV_ATTRIBUTE_FAST_MEM al88_image_blend(_lv_draw_sw_blend_image_dsc_t
     int32_t src_x;
     int32_t y;
 
-    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
-        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB888(dsc, dest_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        lv_color_8_24_mix(src_buf_al88[src_x].lumi, &dest_buf_u8[dest_x], src_buf_al88[src_x].alpha);
-                    }
-                    dest_buf_u8 += dest_stride;
-                    src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
-                }
-            }
-        }
-        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB888_WITH_OPA(dsc, dest_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        lv_color_8_24_mix(src_buf_al88[src_x].lumi, &dest_buf_u8[dest_x], LV_OPA_MIX2(src_buf_al88[src_x].alpha, opa));
-                    }
-                    dest_buf_u8 += dest_stride;
-                    src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
+    if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB888(dsc, dest_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
+                    lv_color_8_24_mix(src_buf_al88[src_x].lumi, &dest_buf_u8[dest_x], src_buf_al88[src_x].alpha);
                 }
+                dest_buf_u8 += dest_stride;
+                src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
             }
         }
-        else if(mask_buf && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB888_WITH_MASK(dsc, dest_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        lv_color_8_24_mix(src_buf_al88[src_x].lumi, &dest_buf_u8[dest_x], LV_OPA_MIX2(src_buf_al88[src_x].alpha,
-                                                                                                      mask_buf[src_x]));
-                    }
-                    dest_buf_u8 += dest_stride;
-                    src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB888_WITH_OPA(dsc, dest_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
+                    lv_color_8_24_mix(src_buf_al88[src_x].lumi, &dest_buf_u8[dest_x], LV_OPA_MIX2(src_buf_al88[src_x].alpha, opa));
                 }
+                dest_buf_u8 += dest_stride;
+                src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
             }
         }
-        else if(mask_buf && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(dsc, dest_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        lv_color_8_24_mix(src_buf_al88[src_x].lumi, &dest_buf_u8[dest_x], LV_OPA_MIX3(src_buf_al88[src_x].alpha,
-                                                                                                      mask_buf[src_x], opa));
-                    }
-                    dest_buf_u8 += dest_stride;
-                    src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB888_WITH_MASK(dsc, dest_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
+                    lv_color_8_24_mix(src_buf_al88[src_x].lumi, &dest_buf_u8[dest_x], LV_OPA_MIX2(src_buf_al88[src_x].alpha,
+                                                                                                  mask_buf[src_x]));
                 }
+                dest_buf_u8 += dest_stride;
+                src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
+                mask_buf += mask_stride;
             }
         }
     }
-    else {
-        for(y = 0; y < h; y++) {
-            for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                lv_color32_t src_argb;
-                src_argb.red = src_argb.green = src_argb.blue = src_buf_al88[src_x].lumi;
-                if(mask_buf == NULL) src_argb.alpha = LV_OPA_MIX2(src_buf_al88[src_x].alpha, opa);
-                else src_argb.alpha = LV_OPA_MIX3(src_buf_al88[src_x].alpha, mask_buf[dest_x], opa);
-                blend_non_normal_pixel(&dest_buf_u8[dest_x], src_argb, dsc->blend_mode);
+    else if(mask_buf && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(dsc, dest_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
+                    lv_color_8_24_mix(src_buf_al88[src_x].lumi, &dest_buf_u8[dest_x], LV_OPA_MIX3(src_buf_al88[src_x].alpha,
+                                                                                                  mask_buf[src_x], opa));
+                }
+                dest_buf_u8 += dest_stride;
+                src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
+                mask_buf += mask_stride;
             }
-            if(mask_buf) mask_buf += mask_stride;
-            dest_buf_u8 += dest_stride;
-            src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
         }
     }
 }
@@ -406,70 +396,52 @@ static void LV_ATTRIBUTE_FAST_MEM l8_image_blend(_lv_draw_sw_blend_image_dsc_t *
     int32_t src_x;
     int32_t y;
 
-    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
-        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB888(dsc, dest_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        dest_buf_u8[dest_x + 2] = src_buf_l8[src_x];
-                        dest_buf_u8[dest_x + 1] = src_buf_l8[src_x];
-                        dest_buf_u8[dest_x + 0] = src_buf_l8[src_x];
-                    }
-                    dest_buf_u8 += dest_stride;
-                    src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
-                }
-            }
-        }
-        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB888_WITH_OPA(dsc, dest_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        lv_color_8_24_mix(src_buf_l8[src_x], &dest_buf_u8[dest_x], opa);
-                    }
-                    dest_buf_u8 += dest_stride;
-                    src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
+    if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB888(dsc, dest_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
+                    dest_buf_u8[dest_x + 2] = src_buf_l8[src_x];
+                    dest_buf_u8[dest_x + 1] = src_buf_l8[src_x];
+                    dest_buf_u8[dest_x + 0] = src_buf_l8[src_x];
                 }
+                dest_buf_u8 += dest_stride;
+                src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
             }
         }
-        else if(mask_buf && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB888_WITH_MASK(dsc, dest_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        lv_color_8_24_mix(src_buf_l8[src_x], &dest_buf_u8[dest_x], mask_buf[src_x]);
-                    }
-                    dest_buf_u8 += dest_stride;
-                    src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB888_WITH_OPA(dsc, dest_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
+                    lv_color_8_24_mix(src_buf_l8[src_x], &dest_buf_u8[dest_x], opa);
                 }
+                dest_buf_u8 += dest_stride;
+                src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
             }
         }
-        else if(mask_buf && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(dsc, dest_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        lv_color_8_24_mix(src_buf_l8[src_x], &dest_buf_u8[dest_x], LV_OPA_MIX2(opa, mask_buf[src_x]));
-                    }
-                    dest_buf_u8 += dest_stride;
-                    src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB888_WITH_MASK(dsc, dest_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
+                    lv_color_8_24_mix(src_buf_l8[src_x], &dest_buf_u8[dest_x], mask_buf[src_x]);
                 }
+                dest_buf_u8 += dest_stride;
+                src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
+                mask_buf += mask_stride;
             }
         }
     }
-    else {
-        lv_color32_t src_argb;
-        for(y = 0; y < h; y++) {
-            for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                src_argb.red = src_buf_l8[src_x];
-                src_argb.green = src_buf_l8[src_x];
-                src_argb.blue = src_buf_l8[src_x];
-                if(mask_buf == NULL) src_argb.alpha = opa;
-                else src_argb.alpha = LV_OPA_MIX2(mask_buf[dest_x], opa);
-                blend_non_normal_pixel(&dest_buf_u8[dest_x], src_argb, dsc->blend_mode);
+    else if(mask_buf && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(dsc, dest_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
+                    lv_color_8_24_mix(src_buf_l8[src_x], &dest_buf_u8[dest_x], LV_OPA_MIX2(opa, mask_buf[src_x]));
+                }
+                dest_buf_u8 += dest_stride;
+                src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
+                mask_buf += mask_stride;
             }
-            if(mask_buf) mask_buf += mask_stride;
-            dest_buf_u8 += dest_stride;
-            src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
         }
     }
 }
@@ -490,82 +462,64 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(_lv_draw_sw_blend_image_dsc
     int32_t dest_x;
     int32_t y;
 
-    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
-        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB888(dsc, dest_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(src_x = 0, dest_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        dest_buf_u8[dest_x + 2] = (src_buf_c16[src_x].red * 2106) >> 8;  /*To make it rounded*/
-                        dest_buf_u8[dest_x + 1] = (src_buf_c16[src_x].green * 1037) >> 8;
-                        dest_buf_u8[dest_x + 0] = (src_buf_c16[src_x].blue * 2106) >> 8;
-                    }
-                    dest_buf_u8 += dest_stride;
-                    src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
-                }
-            }
-        }
-        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB888_WITH_OPA(dsc, dest_px_size)) {
-                uint8_t res[3];
-                for(y = 0; y < h; y++) {
-                    for(src_x = 0, dest_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        res[2] = (src_buf_c16[src_x].red * 2106) >> 8; /*To make it rounded*/
-                        res[1] = (src_buf_c16[src_x].green * 1037) >> 8;
-                        res[0] = (src_buf_c16[src_x].blue * 2106) >> 8;
-                        lv_color_24_24_mix(res, &dest_buf_u8[dest_x], opa);
-                    }
-                    dest_buf_u8 += dest_stride;
-                    src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
+    if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB888(dsc, dest_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(src_x = 0, dest_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
+                    dest_buf_u8[dest_x + 2] = (src_buf_c16[src_x].red * 2106) >> 8;  /*To make it rounded*/
+                    dest_buf_u8[dest_x + 1] = (src_buf_c16[src_x].green * 1037) >> 8;
+                    dest_buf_u8[dest_x + 0] = (src_buf_c16[src_x].blue * 2106) >> 8;
                 }
+                dest_buf_u8 += dest_stride;
+                src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
             }
         }
-        else if(mask_buf && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB888_WITH_MASK(dsc, dest_px_size)) {
-                uint8_t res[3];
-                for(y = 0; y < h; y++) {
-                    for(src_x = 0, dest_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        res[2] = (src_buf_c16[src_x].red * 2106) >> 8;  /*To make it rounded*/
-                        res[1] = (src_buf_c16[src_x].green * 1037) >> 8;
-                        res[0] = (src_buf_c16[src_x].blue * 2106) >> 8;
-                        lv_color_24_24_mix(res, &dest_buf_u8[dest_x], mask_buf[src_x]);
-                    }
-                    dest_buf_u8 += dest_stride;
-                    src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB888_WITH_OPA(dsc, dest_px_size)) {
+            uint8_t res[3];
+            for(y = 0; y < h; y++) {
+                for(src_x = 0, dest_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
+                    res[2] = (src_buf_c16[src_x].red * 2106) >> 8; /*To make it rounded*/
+                    res[1] = (src_buf_c16[src_x].green * 1037) >> 8;
+                    res[0] = (src_buf_c16[src_x].blue * 2106) >> 8;
+                    lv_color_24_24_mix(res, &dest_buf_u8[dest_x], opa);
                 }
+                dest_buf_u8 += dest_stride;
+                src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
             }
         }
-        else {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(dsc, dest_px_size)) {
-                uint8_t res[3];
-                for(y = 0; y < h; y++) {
-                    for(src_x = 0, dest_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        res[2] = (src_buf_c16[src_x].red * 2106) >> 8;  /*To make it rounded*/
-                        res[1] = (src_buf_c16[src_x].green * 1037) >> 8;
-                        res[0] = (src_buf_c16[src_x].blue * 2106) >> 8;
-                        lv_color_24_24_mix(res, &dest_buf_u8[dest_x], LV_OPA_MIX2(opa, mask_buf[src_x]));
-                    }
-                    dest_buf_u8 += dest_stride;
-                    src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB888_WITH_MASK(dsc, dest_px_size)) {
+            uint8_t res[3];
+            for(y = 0; y < h; y++) {
+                for(src_x = 0, dest_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
+                    res[2] = (src_buf_c16[src_x].red * 2106) >> 8;  /*To make it rounded*/
+                    res[1] = (src_buf_c16[src_x].green * 1037) >> 8;
+                    res[0] = (src_buf_c16[src_x].blue * 2106) >> 8;
+                    lv_color_24_24_mix(res, &dest_buf_u8[dest_x], mask_buf[src_x]);
                 }
+                dest_buf_u8 += dest_stride;
+                src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
+                mask_buf += mask_stride;
             }
         }
     }
     else {
-        lv_color32_t src_argb;
-        for(y = 0; y < h; y++) {
-            for(src_x = 0, dest_x = 0; src_x < w; src_x++, dest_x += dest_px_size) {
-                src_argb.red = (src_buf_c16[src_x].red * 2106) >> 8;
-                src_argb.green = (src_buf_c16[src_x].green * 1037) >> 8;
-                src_argb.blue = (src_buf_c16[src_x].blue * 2106) >> 8;
-                if(mask_buf == NULL) src_argb.alpha = opa;
-                else src_argb.alpha = LV_OPA_MIX2(mask_buf[src_x], opa);
-                blend_non_normal_pixel(&dest_buf_u8[dest_x], src_argb, dsc->blend_mode);
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(dsc, dest_px_size)) {
+            uint8_t res[3];
+            for(y = 0; y < h; y++) {
+                for(src_x = 0, dest_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
+                    res[2] = (src_buf_c16[src_x].red * 2106) >> 8;  /*To make it rounded*/
+                    res[1] = (src_buf_c16[src_x].green * 1037) >> 8;
+                    res[0] = (src_buf_c16[src_x].blue * 2106) >> 8;
+                    lv_color_24_24_mix(res, &dest_buf_u8[dest_x], LV_OPA_MIX2(opa, mask_buf[src_x]));
+                }
+                dest_buf_u8 += dest_stride;
+                src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
+                mask_buf += mask_stride;
             }
-            if(mask_buf) mask_buf += mask_stride;
-            dest_buf_u8 += dest_stride;
-            src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
         }
     }
 }
@@ -587,83 +541,64 @@ static void LV_ATTRIBUTE_FAST_MEM rgb888_image_blend(_lv_draw_sw_blend_image_dsc
     int32_t src_x;
     int32_t y;
 
-    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
-        /*Special case*/
-        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888(dsc, dest_px_size, src_px_size)) {
-                if(src_px_size == dest_px_size) {
-                    for(y = 0; y < h; y++) {
-                        lv_memcpy(dest_buf, src_buf, w);
-                        dest_buf += dest_stride;
-                        src_buf += src_stride;
-                    }
-                }
-                else {
-                    for(y = 0; y < h; y++) {
-                        for(dest_x = 0, src_x = 0; dest_x < w; dest_x += dest_px_size, src_x += src_px_size) {
-                            dest_buf[dest_x + 0] = src_buf[src_x + 0];
-                            dest_buf[dest_x + 1] = src_buf[src_x + 1];
-                            dest_buf[dest_x + 2] = src_buf[src_x + 2];
-                        }
-                        dest_buf += dest_stride;
-                        src_buf += src_stride;
-                    }
+    /*Special case*/
+    if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888(dsc, dest_px_size, src_px_size)) {
+            if(src_px_size == dest_px_size) {
+                for(y = 0; y < h; y++) {
+                    lv_memcpy(dest_buf, src_buf, w);
+                    dest_buf += dest_stride;
+                    src_buf += src_stride;
                 }
             }
-        }
-        if(mask_buf == NULL && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_WITH_OPA(dsc, dest_px_size, src_px_size)) {
+            else {
                 for(y = 0; y < h; y++) {
                     for(dest_x = 0, src_x = 0; dest_x < w; dest_x += dest_px_size, src_x += src_px_size) {
-                        lv_color_24_24_mix(&src_buf[src_x], &dest_buf[dest_x], opa);
+                        dest_buf[dest_x + 0] = src_buf[src_x + 0];
+                        dest_buf[dest_x + 1] = src_buf[src_x + 1];
+                        dest_buf[dest_x + 2] = src_buf[src_x + 2];
                     }
                     dest_buf += dest_stride;
                     src_buf += src_stride;
                 }
             }
         }
-        if(mask_buf && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_WITH_MASK(dsc, dest_px_size, src_px_size)) {
-                uint32_t mask_x;
-                for(y = 0; y < h; y++) {
-                    for(mask_x = 0, dest_x = 0, src_x = 0; dest_x < w; mask_x++, dest_x += dest_px_size, src_x += src_px_size) {
-                        lv_color_24_24_mix(&src_buf[src_x], &dest_buf[dest_x], mask_buf[mask_x]);
-                    }
-                    dest_buf += dest_stride;
-                    src_buf += src_stride;
-                    mask_buf += mask_stride;
+    }
+    if(mask_buf == NULL && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_WITH_OPA(dsc, dest_px_size, src_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x += dest_px_size, src_x += src_px_size) {
+                    lv_color_24_24_mix(&src_buf[src_x], &dest_buf[dest_x], opa);
                 }
+                dest_buf += dest_stride;
+                src_buf += src_stride;
             }
         }
-        if(mask_buf && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(dsc, dest_px_size, src_px_size)) {
-                uint32_t mask_x;
-                for(y = 0; y < h; y++) {
-                    for(mask_x = 0, dest_x = 0, src_x = 0; dest_x < w; mask_x++, dest_x += dest_px_size, src_x += src_px_size) {
-                        lv_color_24_24_mix(&src_buf[src_x], &dest_buf[dest_x], LV_OPA_MIX2(opa, mask_buf[mask_x]));
-                    }
-                    dest_buf += dest_stride;
-                    src_buf += src_stride;
-                    mask_buf += mask_stride;
+    }
+    if(mask_buf && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_WITH_MASK(dsc, dest_px_size, src_px_size)) {
+            uint32_t mask_x;
+            for(y = 0; y < h; y++) {
+                for(mask_x = 0, dest_x = 0, src_x = 0; dest_x < w; mask_x++, dest_x += dest_px_size, src_x += src_px_size) {
+                    lv_color_24_24_mix(&src_buf[src_x], &dest_buf[dest_x], mask_buf[mask_x]);
                 }
+                dest_buf += dest_stride;
+                src_buf += src_stride;
+                mask_buf += mask_stride;
             }
         }
     }
-    else {
-        lv_color32_t src_argb;
-        for(y = 0; y < h; y++) {
-            for(dest_x = 0, src_x = 0; dest_x < w; dest_x += dest_px_size, src_x += src_px_size) {
-                src_argb.red = src_buf[src_x + 2];
-                src_argb.green = src_buf[src_x + 1];
-                src_argb.blue = src_buf[src_x + 0];
-                if(mask_buf == NULL) src_argb.alpha = opa;
-                else src_argb.alpha = LV_OPA_MIX2(mask_buf[dest_x], opa);
-
-                blend_non_normal_pixel(&dest_buf[dest_x], src_argb, dsc->blend_mode);
+    if(mask_buf && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(dsc, dest_px_size, src_px_size)) {
+            uint32_t mask_x;
+            for(y = 0; y < h; y++) {
+                for(mask_x = 0, dest_x = 0, src_x = 0; dest_x < w; mask_x++, dest_x += dest_px_size, src_x += src_px_size) {
+                    lv_color_24_24_mix(&src_buf[src_x], &dest_buf[dest_x], LV_OPA_MIX2(opa, mask_buf[mask_x]));
+                }
+                dest_buf += dest_stride;
+                src_buf += src_stride;
+                mask_buf += mask_stride;
             }
-            if(mask_buf) mask_buf += mask_stride;
-            dest_buf += dest_stride;
-            src_buf += src_stride;
         }
     }
 }
@@ -684,99 +619,56 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(_lv_draw_sw_blend_image_d
     int32_t src_x;
     int32_t y;
 
-    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
-        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888(dsc, dest_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        lv_color_24_24_mix((const uint8_t *)&src_buf_c32[src_x], &dest_buf[dest_x], src_buf_c32[src_x].alpha);
-                    }
-                    dest_buf += dest_stride;
-                    src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
-                }
-            }
-        }
-        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_OPA(dsc, dest_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        lv_color_24_24_mix((const uint8_t *)&src_buf_c32[src_x], &dest_buf[dest_x], LV_OPA_MIX2(src_buf_c32[src_x].alpha, opa));
-                    }
-                    dest_buf += dest_stride;
-                    src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+    if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888(dsc, dest_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
+                    lv_color_24_24_mix((const uint8_t *)&src_buf_c32[src_x], &dest_buf[dest_x], src_buf_c32[src_x].alpha);
                 }
+                dest_buf += dest_stride;
+                src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
             }
         }
-        else if(mask_buf && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_MASK(dsc, dest_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        lv_color_24_24_mix((const uint8_t *)&src_buf_c32[src_x], &dest_buf[dest_x],
-                                           LV_OPA_MIX2(src_buf_c32[src_x].alpha, mask_buf[src_x]));
-                    }
-                    dest_buf += dest_stride;
-                    src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_OPA(dsc, dest_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
+                    lv_color_24_24_mix((const uint8_t *)&src_buf_c32[src_x], &dest_buf[dest_x], LV_OPA_MIX2(src_buf_c32[src_x].alpha, opa));
                 }
+                dest_buf += dest_stride;
+                src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
             }
         }
-        else if(mask_buf && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(dsc, dest_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        lv_color_24_24_mix((const uint8_t *)&src_buf_c32[src_x], &dest_buf[dest_x],
-                                           LV_OPA_MIX3(src_buf_c32[src_x].alpha, mask_buf[src_x], opa));
-                    }
-                    dest_buf += dest_stride;
-                    src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
-                    mask_buf += mask_stride;
+    }
+    else if(mask_buf && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_MASK(dsc, dest_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
+                    lv_color_24_24_mix((const uint8_t *)&src_buf_c32[src_x], &dest_buf[dest_x],
+                                       LV_OPA_MIX2(src_buf_c32[src_x].alpha, mask_buf[src_x]));
                 }
+                dest_buf += dest_stride;
+                src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+                mask_buf += mask_stride;
             }
         }
     }
-    else {
-        lv_color32_t src_argb;
-        for(y = 0; y < h; y++) {
-            for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x ++) {
-                src_argb = src_buf_c32[src_x];
-                if(mask_buf == NULL) src_argb.alpha = LV_OPA_MIX2(src_argb.alpha, opa);
-                else src_argb.alpha = LV_OPA_MIX3(src_argb.alpha, mask_buf[dest_x], opa);
-
-                blend_non_normal_pixel(&dest_buf[dest_x], src_argb, dsc->blend_mode);
+    else if(mask_buf && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(dsc, dest_px_size)) {
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
+                    lv_color_24_24_mix((const uint8_t *)&src_buf_c32[src_x], &dest_buf[dest_x],
+                                       LV_OPA_MIX3(src_buf_c32[src_x].alpha, mask_buf[src_x], opa));
+                }
+                dest_buf += dest_stride;
+                src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+                mask_buf += mask_stride;
             }
-            if(mask_buf) mask_buf += mask_stride;
-            dest_buf += dest_stride;
-            src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
         }
     }
 }
 
-static inline void LV_ATTRIBUTE_FAST_MEM blend_non_normal_pixel(uint8_t * dest, lv_color32_t src, lv_blend_mode_t mode)
-{
-    uint8_t res[3] = {0, 0, 0};
-    switch(mode) {
-        case LV_BLEND_MODE_ADDITIVE:
-            res[0] = LV_MIN(dest[0] + src.blue, 255);
-            res[1] = LV_MIN(dest[1] + src.green, 255);
-            res[2] = LV_MIN(dest[2] + src.red, 255);
-            break;
-        case LV_BLEND_MODE_SUBTRACTIVE:
-            res[0] = LV_MAX(dest[0] - src.blue, 0);
-            res[1] = LV_MAX(dest[1] - src.green, 0);
-            res[2] = LV_MAX(dest[2] - src.red, 0);
-            break;
-        case LV_BLEND_MODE_MULTIPLY:
-            res[0] = (dest[0] * src.blue) >> 8;
-            res[1] = (dest[1] * src.green) >> 8;
-            res[2] = (dest[2] * src.red) >> 8;
-            break;
-        default:
-            LV_LOG_WARN("Not supported blend mode: %d", mode);
-            return;
-    }
-    lv_color_24_24_mix(res, dest, src.alpha);
-}
-
 static inline void LV_ATTRIBUTE_FAST_MEM lv_color_8_24_mix(const uint8_t src, uint8_t * dest, uint8_t mix)
 {
 
@@ -0,0 +1,56 @@
+/**
+ * @file lv_blend_x86.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_blend_x86.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_blend_x86_init_kernels(lv_draw_sw_kernels_t * kernels, uint32_t features)
+{
+    if(features & LV_DRAW_SW_CPU_FEATURE_SSE2) {
+        _lv_blend_x86_init_kernels_sse2(kernels);
+    }
+
+#if LV_BLEND_X86_AVX2_SUPPORTED
+    /*Overwrite the SSE2 kernels*/
+    if(features & LV_DRAW_SW_CPU_FEATURE_AVX2) {
+        _lv_blend_x86_init_kernels_avx2(kernels);
+    }
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86*/
@@ -0,0 +1,239 @@
+/**
+ * @file lv_blend_x86.h
+ *
+ */
+
+#ifndef LV_BLEND_X86_H
+#define LV_BLEND_X86_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lv_conf_internal.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+
+#include "../../lv_draw_sw_kernels.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* The kernels are selected at run time (SSE2 or AVX2) by `lv_draw_sw_init()`.
+ * The same kernel handles the simple, opa, mask and mix variants.
+ * Copying RGB565 and XRGB8888 images is left to the `lv_memcpy` of the C implementation.
+ * RGB888 (3 bytes/pixel) sources and destinations are also left to the C implementation.*/
+
+/*AVX2 code can be generated without enabling it for the whole project*/
+#if defined(__AVX2__) || defined(_MSC_VER) || defined(__clang__) || \
+    (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+#define LV_BLEND_X86_AVX2_SUPPORTED 1
+#else
+#define LV_BLEND_X86_AVX2_SUPPORTED 0
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565(dsc) \
+    LV_DRAW_SW_KERNEL(color_blend_to_rgb565, dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc) \
+    LV_DRAW_SW_KERNEL(color_blend_to_rgb565, dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK(dsc) \
+    LV_DRAW_SW_KERNEL(color_blend_to_rgb565, dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA(dsc) \
+    LV_DRAW_SW_KERNEL(color_blend_to_rgb565, dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc) \
+    LV_DRAW_SW_KERNEL(rgb565_blend_normal_to_rgb565, dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc) \
+    LV_DRAW_SW_KERNEL(rgb565_blend_normal_to_rgb565, dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc) \
+    LV_DRAW_SW_KERNEL(rgb565_blend_normal_to_rgb565, dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565(dsc) \
+    LV_DRAW_SW_KERNEL(argb8888_blend_normal_to_rgb565, dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc) \
+    LV_DRAW_SW_KERNEL(argb8888_blend_normal_to_rgb565, dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc) \
+    LV_DRAW_SW_KERNEL(argb8888_blend_normal_to_rgb565, dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc) \
+    LV_DRAW_SW_KERNEL(argb8888_blend_normal_to_rgb565, dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB888
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888(dsc, dst_px_size) \
+    LV_DRAW_SW_KERNEL(color_blend_to_rgb888, dsc, dst_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB888_WITH_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888_WITH_OPA(dsc, dst_px_size) \
+    LV_DRAW_SW_KERNEL(color_blend_to_rgb888, dsc, dst_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB888_WITH_MASK
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888_WITH_MASK(dsc, dst_px_size) \
+    LV_DRAW_SW_KERNEL(color_blend_to_rgb888, dsc, dst_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB888_MIX_MASK_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888_MIX_MASK_OPA(dsc, dst_px_size) \
+    LV_DRAW_SW_KERNEL(color_blend_to_rgb888, dsc, dst_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_WITH_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_WITH_OPA(dsc, dst_px_size, src_px_size) \
+    LV_DRAW_SW_KERNEL(rgb888_blend_normal_to_rgb888, dsc, dst_px_size, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_WITH_MASK
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_WITH_MASK(dsc, dst_px_size, src_px_size) \
+    LV_DRAW_SW_KERNEL(rgb888_blend_normal_to_rgb888, dsc, dst_px_size, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(dsc, dst_px_size, src_px_size) \
+    LV_DRAW_SW_KERNEL(rgb888_blend_normal_to_rgb888, dsc, dst_px_size, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888(dsc, dst_px_size) \
+    LV_DRAW_SW_KERNEL(argb8888_blend_normal_to_rgb888, dsc, dst_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_OPA(dsc, dst_px_size) \
+    LV_DRAW_SW_KERNEL(argb8888_blend_normal_to_rgb888, dsc, dst_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_MASK
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_MASK(dsc, dst_px_size) \
+    LV_DRAW_SW_KERNEL(argb8888_blend_normal_to_rgb888, dsc, dst_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(dsc, dst_px_size) \
+    LV_DRAW_SW_KERNEL(argb8888_blend_normal_to_rgb888, dsc, dst_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888(dsc) \
+    LV_DRAW_SW_KERNEL(color_blend_to_argb8888, dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_OPA(dsc) \
+    LV_DRAW_SW_KERNEL(color_blend_to_argb8888, dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_MASK
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_MASK(dsc) \
+    LV_DRAW_SW_KERNEL(color_blend_to_argb8888, dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_MIX_MASK_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_MIX_MASK_OPA(dsc) \
+    LV_DRAW_SW_KERNEL(color_blend_to_argb8888, dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888(dsc) \
+    LV_DRAW_SW_KERNEL(argb8888_blend_normal_to_argb8888, dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc) \
+    LV_DRAW_SW_KERNEL(argb8888_blend_normal_to_argb8888, dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc) \
+    LV_DRAW_SW_KERNEL(argb8888_blend_normal_to_argb8888, dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc) \
+    LV_DRAW_SW_KERNEL(argb8888_blend_normal_to_argb8888, dsc)
+#endif
+
+#ifndef LV_DRAW_SW_BLEND_MODE_ROW_TO_RGB565
+#define LV_DRAW_SW_BLEND_MODE_ROW_TO_RGB565(dest, src, len, mode) \
+    LV_DRAW_SW_KERNEL(blend_mode_row_to_rgb565, dest, src, len, mode)
+#endif
+
+#ifndef LV_DRAW_SW_BLEND_MODE_ROW_TO_RGB888
+#define LV_DRAW_SW_BLEND_MODE_ROW_TO_RGB888(dest, src, len, mode, dst_px_size) \
+    LV_DRAW_SW_KERNEL(blend_mode_row_to_rgb888, dest, src, len, mode, dst_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_BLEND_MODE_ROW_TO_ARGB8888
+#define LV_DRAW_SW_BLEND_MODE_ROW_TO_ARGB8888(dest, src, len, mode) \
+    LV_DRAW_SW_KERNEL(blend_mode_row_to_argb8888, dest, src, len, mode)
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Set the x86 kernels in a kernel table.
+ * Called by `lv_draw_sw_set_kernel_features()`.
+ * @param kernels   pointer to a kernel table
+ * @param features  the CPU features which can be used (OR-ed values of `lv_draw_sw_cpu_feature_t`)
+ */
+void lv_blend_x86_init_kernels(lv_draw_sw_kernels_t * kernels, uint32_t features);
+
+/**
+ * Set the SSE2 kernels in a kernel table
+ * @param kernels   pointer to a kernel table
+ */
+void _lv_blend_x86_init_kernels_sse2(lv_draw_sw_kernels_t * kernels);
+
+/**
+ * Set the AVX2 kernels in a kernel table
+ * @param kernels   pointer to a kernel table
+ */
+void _lv_blend_x86_init_kernels_avx2(lv_draw_sw_kernels_t * kernels);
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_BLEND_X86_H*/
@@ -0,0 +1,40 @@
+/**
+ * @file lv_blend_x86_avx2.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_blend_x86.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 && LV_BLEND_X86_AVX2_SUPPORTED
+
+#include "../../../../misc/lv_color.h"
+#include "../../../../misc/lv_color_op.h"
+#include "../../../../stdlib/lv_string.h"
+
+#include <immintrin.h>
+
+/*Generate AVX2 code only for the functions of this file.
+ *They are used only if the CPU supports AVX2.*/
+#if defined(__clang__)
+    #pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__GNUC__)
+    #pragma GCC push_options
+    #pragma GCC target("avx2")
+#endif
+
+#define LV_BLEND_X86_AVX2           1
+#define LV_BLEND_X86_INIT_KERNELS   _lv_blend_x86_init_kernels_avx2
+
+#include "lv_blend_x86_impl.h"
+
+#if defined(__clang__)
+    #pragma clang attribute pop
+#elif defined(__GNUC__)
+    #pragma GCC pop_options
+#endif
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 && LV_BLEND_X86_AVX2_SUPPORTED*/
@@ -0,0 +1,1810 @@
+/**
+ * @file lv_blend_x86_impl.h
+ *
+ * The kernels of the x86 backend.
+ * Included by lv_blend_x86_sse2.c and lv_blend_x86_avx2.c to compile the same code for both instruction sets.
+ * Before including it define
+ * - `LV_BLEND_X86_AVX2`: 1: use 256 bit AVX2 vectors, 0: use 128 bit SSE2 vectors
+ * - `LV_BLEND_X86_INIT_KERNELS`: the name of the function setting the kernels in a `lv_draw_sw_kernels_t`
+ */
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*The same code is used for SSE2 and AVX2. Only the vector width is different.*/
+#if LV_BLEND_X86_AVX2
+    typedef __m256i vec_t;
+    #define VEC_BYTES               32
+    #define vec_loadu(p)            _mm256_loadu_si256((const __m256i *)(p))
+    #define vec_storeu(p, v)        _mm256_storeu_si256((__m256i *)(p), v)
+    #define vec_zero()              _mm256_setzero_si256()
+    #define vec_set1_16(x)          _mm256_set1_epi16((short)(x))
+    #define vec_set1_32(x)          _mm256_set1_epi32((int)(x))
+    #define vec_and                 _mm256_and_si256
+    #define vec_or                  _mm256_or_si256
+    #define vec_andnot              _mm256_andnot_si256
+    #define vec_add16               _mm256_add_epi16
+    #define vec_add32               _mm256_add_epi32
+    #define vec_sub32               _mm256_sub_epi32
+    #define vec_adds_u8             _mm256_adds_epu8
+    #define vec_subs_u8             _mm256_subs_epu8
+    #define vec_min16               _mm256_min_epi16
+    #define vec_max16               _mm256_max_epi16
+    #define vec_sub16               _mm256_sub_epi16
+    #define vec_mullo16             _mm256_mullo_epi16
+    #define vec_mulhi_u16           _mm256_mulhi_epu16
+    #define vec_srli16              _mm256_srli_epi16
+    #define vec_srai16              _mm256_srai_epi16
+    #define vec_slli16              _mm256_slli_epi16
+    #define vec_srli32              _mm256_srli_epi32
+    #define vec_srai32              _mm256_srai_epi32
+    #define vec_slli32              _mm256_slli_epi32
+    #define vec_cmpeq16             _mm256_cmpeq_epi16
+    #define vec_cmpeq32             _mm256_cmpeq_epi32
+    #define vec_cmpgt32             _mm256_cmpgt_epi32
+    #define vec_unpacklo8           _mm256_unpacklo_epi8
+    #define vec_unpackhi8           _mm256_unpackhi_epi8
+    #define vec_unpacklo32          _mm256_unpacklo_epi32
+    #define vec_unpackhi32          _mm256_unpackhi_epi32
+    #define vec_packus16            _mm256_packus_epi16
+    #define vec_movemask8           _mm256_movemask_epi8
+#else
+    typedef __m128i vec_t;
+    #define VEC_BYTES               16
+    #define vec_loadu(p)            _mm_loadu_si128((const __m128i *)(p))
+    #define vec_storeu(p, v)        _mm_storeu_si128((__m128i *)(p), v)
+    #define vec_zero()              _mm_setzero_si128()
+    #define vec_set1_16(x)          _mm_set1_epi16((short)(x))
+    #define vec_set1_32(x)          _mm_set1_epi32((int)(x))
+    #define vec_and                 _mm_and_si128
+    #define vec_or                  _mm_or_si128
+    #define vec_andnot              _mm_andnot_si128
+    #define vec_add16               _mm_add_epi16
+    #define vec_add32               _mm_add_epi32
+    #define vec_sub32               _mm_sub_epi32
+    #define vec_adds_u8             _mm_adds_epu8
+    #define vec_subs_u8             _mm_subs_epu8
+    #define vec_min16               _mm_min_epi16
+    #define vec_max16               _mm_max_epi16
+    #define vec_sub16               _mm_sub_epi16
+    #define vec_mullo16             _mm_mullo_epi16
+    #define vec_mulhi_u16           _mm_mulhi_epu16
+    #define vec_srli16              _mm_srli_epi16
+    #define vec_srai16              _mm_srai_epi16
+    #define vec_slli16              _mm_slli_epi16
+    #define vec_srli32              _mm_srli_epi32
+    #define vec_srai32              _mm_srai_epi32
+    #define vec_slli32              _mm_slli_epi32
+    #define vec_cmpeq16             _mm_cmpeq_epi16
+    #define vec_cmpeq32             _mm_cmpeq_epi32
+    #define vec_cmpgt32             _mm_cmpgt_epi32
+    #define vec_unpacklo8           _mm_unpacklo_epi8
+    #define vec_unpackhi8           _mm_unpackhi_epi8
+    #define vec_unpacklo32          _mm_unpacklo_epi32
+    #define vec_unpackhi32          _mm_unpackhi_epi32
+    #define vec_packus16            _mm_packus_epi16
+    #define vec_movemask8           _mm_movemask_epi8
+#endif
+
+#define PX16_CNT            (VEC_BYTES / 2)     /*Number of 16 bit pixels in a vector*/
+#define PX32_CNT            (VEC_BYTES / 4)     /*Number of 32 bit pixels in a vector*/
+#define MOVEMASK_ALL        ((int)((1ULL << VEC_BYTES) - 1))
+
+/*Rotate by 90 and 270 degrees in tiles of this many pixels. A multiple of the 8 pixels of the transposed blocks.*/
+#define ROTATE_TILE_SIZE    32
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Where the pixels of a transformed image are on the source image. Sized for the 16 bit pixels.*/
+typedef struct {
+    int32_t x[PX16_CNT];        /**< Integer coordinates on the source image*/
+    int32_t y[PX16_CNT];
+    int32_t x_next[PX16_CNT];   /**< Direction of the horizontal and vertical neighbors to mix with (-1 or 1)*/
+    int32_t y_next[PX16_CNT];
+    int32_t x_fract[PX16_CNT];  /**< Weight of the neighbors (0..127)*/
+    int32_t y_fract[PX16_CNT];
+    bool in_image[PX16_CNT];    /**< The pixel is on the source image. Set only by `transform_get_lanes_px`*/
+    bool inside[PX16_CNT];      /**< Its neighbors are on the source image too. Set only by `transform_get_lanes_px`*/
+} transform_lanes_t;
+
+typedef enum {
+    TRANSFORM_LANES_MIXED,      /*Some pixels need to be handled one by one by `transform_get_lanes_px`*/
+    TRANSFORM_LANES_INSIDE,     /*All pixels and their neighbors are on the image*/
+    TRANSFORM_LANES_OUT,        /*All pixels are out of the image*/
+} transform_lanes_res_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_result_t color_blend_to_rgb565(_lv_draw_sw_blend_fill_dsc_t * dsc);
+static lv_result_t rgb565_blend_normal_to_rgb565(_lv_draw_sw_blend_image_dsc_t * dsc);
+static lv_result_t argb8888_blend_normal_to_rgb565(_lv_draw_sw_blend_image_dsc_t * dsc);
+static lv_result_t color_blend_to_rgb888(_lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size);
+static lv_result_t rgb888_blend_normal_to_rgb888(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size,
+                                                uint32_t src_px_size);
+static lv_result_t argb8888_blend_normal_to_rgb888(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size);
+static lv_result_t color_blend_to_argb8888(_lv_draw_sw_blend_fill_dsc_t * dsc);
+static lv_result_t argb8888_blend_normal_to_argb8888(_lv_draw_sw_blend_image_dsc_t * dsc);
+static lv_result_t blend_mode_row_to_rgb565(uint16_t * dest, const lv_color32_t * src, int32_t len,
+                                            lv_blend_mode_t mode);
+static lv_result_t blend_mode_row_to_rgb888(uint8_t * dest, const lv_color32_t * src, int32_t len,
+                                            lv_blend_mode_t mode, uint32_t dst_px_size);
+static lv_result_t blend_mode_row_to_argb8888(lv_color32_t * dest, const lv_color32_t * src, int32_t len,
+                                              lv_blend_mode_t mode);
+static lv_result_t rgb565_swap(void * buf, uint32_t buf_size_px);
+static lv_result_t rotate(const void * src, void * dest, int32_t src_width, int32_t src_height, int32_t src_stride,
+                          int32_t dest_stride, lv_display_rotation_t rotation, uint32_t px_size);
+static inline int32_t rotated_index(int32_t x, int32_t y, int32_t w, int32_t h, int32_t dest_stride,
+                                    lv_display_rotation_t rotation);
+static inline void rotate_180(const uint8_t * src, uint8_t * dest, int32_t w, int32_t h, int32_t src_stride,
+                              int32_t dest_stride, uint32_t px_size);
+static inline void rotate_90_270(const uint8_t * src, uint8_t * dest, int32_t w, int32_t h, int32_t src_stride,
+                                 int32_t dest_stride, lv_display_rotation_t rotation, uint32_t px_size);
+static void rotate_area_px(const void * src, void * dest, const lv_area_t * area, int32_t w, int32_t h,
+                           int32_t src_stride, int32_t dest_stride, lv_display_rotation_t rotation, uint32_t px_size);
+static inline void rotate_block_32(const uint8_t * src, int32_t src_stride, uint8_t * dest, int32_t dest_step,
+                                   bool reverse);
+static inline void rotate_block_16(const uint8_t * src, int32_t src_stride, uint8_t * dest, int32_t dest_step,
+                                   bool reverse);
+static inline __m128i reverse_16(__m128i v);
+static lv_result_t transform_argb8888(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                      int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                      int32_t x_end, uint8_t * dest_buf, bool aa);
+static lv_result_t transform_rgb888(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                    int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                    int32_t x_end, uint8_t * dest_buf, bool aa, uint32_t px_size);
+static lv_result_t transform_rgb565a8(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                      int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                      int32_t x_end, uint16_t * cbuf, uint8_t * abuf, bool src_has_a8, bool aa);
+static inline vec_t transform_acc_init(int32_t step, int32_t first);
+static inline transform_lanes_res_t transform_get_lanes(vec_t xs_acc, vec_t ys_acc, int32_t xs_ups, int32_t ys_ups,
+                                                       int32_t src_w, int32_t src_h, transform_lanes_t * lanes,
+                                                       int32_t ofs);
+static inline int32_t transform_get_lanes_px(int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                             int32_t x, int32_t cnt, int32_t lane_cnt, int32_t src_w, int32_t src_h,
+                                             transform_lanes_t * lanes);
+static inline int32_t transform_get_edge(const transform_lanes_t * lanes, int32_t i, int32_t src_w, int32_t src_h);
+static inline void transform_argb8888_edge_px(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                              const transform_lanes_t * lanes, int32_t i, uint32_t * dest);
+static inline void transform_rgb888_edge_px(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                            uint32_t px_size, const transform_lanes_t * lanes, int32_t i,
+                                            uint32_t * dest);
+static inline void transform_rgb565a8_edge_px(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                              bool src_has_a8, const transform_lanes_t * lanes, int32_t i,
+                                              uint16_t * cbuf, uint8_t * abuf);
+static inline uint32_t load_rgb888(const uint8_t * p);
+static inline vec_t transform_mix_32(vec_t px, vec_t next, vec_t fract, bool mix_alpha);
+static inline vec_t transform_mix_a8(vec_t a, vec_t next, vec_t fract);
+static inline vec_t vec_select(vec_t cond, vec_t a, vec_t b);
+static inline vec_t load_mask_16(const lv_opa_t * mask);
+static inline vec_t load_mask_32(const lv_opa_t * mask);
+static inline vec_t pack_32_to_16(vec_t a, vec_t b);
+static inline vec_t get_mix(vec_t mask_v, bool has_mask, vec_t opa_v, lv_opa_t opa);
+static inline vec_t get_mix_alpha(vec_t alpha, vec_t mask_v, bool has_mask, vec_t opa_v, lv_opa_t opa);
+static inline lv_opa_t get_mix_px(const lv_opa_t * mask, int32_t x, lv_opa_t opa);
+static inline lv_opa_t get_mix_alpha_px(lv_opa_t alpha, const lv_opa_t * mask, int32_t x, lv_opa_t opa);
+static inline bool is_blend_mode_supported(lv_blend_mode_t mode);
+static inline vec_t blend_mode_16(vec_t dest, const uint32_t * src, lv_blend_mode_t mode);
+static inline vec_t blend_mode_32(vec_t dest, vec_t src, lv_blend_mode_t mode);
+static inline void blend_mode_32_to_xrgb8888(uint32_t * dest, const uint32_t * src, lv_blend_mode_t mode);
+static inline void blend_mode_32_to_argb8888(lv_color32_t * dest, const lv_color32_t * src, lv_blend_mode_t mode);
+static inline vec_t mix_16_16(vec_t fg, vec_t bg, vec_t mix);
+static inline vec_t mix_24_16(vec_t fg_r, vec_t fg_g, vec_t fg_b, vec_t bg, vec_t mix);
+static inline vec_t mix_24_24(vec_t fg, vec_t bg, vec_t mix);
+static inline bool mix_32_32(vec_t fg, vec_t bg, vec_t * res);
+static inline uint16_t mix_24_16_px(const uint8_t * c1, uint16_t c2, uint8_t mix);
+static inline void mix_24_24_px(const uint8_t * src, uint8_t * dest, uint8_t mix);
+static inline lv_color32_t mix_32_32_px(lv_color32_t fg, lv_color32_t bg);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void LV_BLEND_X86_INIT_KERNELS(lv_draw_sw_kernels_t * kernels)
+{
+    kernels->color_blend_to_rgb565 = color_blend_to_rgb565;
+    kernels->rgb565_blend_normal_to_rgb565 = rgb565_blend_normal_to_rgb565;
+    kernels->argb8888_blend_normal_to_rgb565 = argb8888_blend_normal_to_rgb565;
+    kernels->color_blend_to_rgb888 = color_blend_to_rgb888;
+    kernels->rgb888_blend_normal_to_rgb888 = rgb888_blend_normal_to_rgb888;
+    kernels->argb8888_blend_normal_to_rgb888 = argb8888_blend_normal_to_rgb888;
+    kernels->color_blend_to_argb8888 = color_blend_to_argb8888;
+    kernels->argb8888_blend_normal_to_argb8888 = argb8888_blend_normal_to_argb8888;
+    kernels->blend_mode_row_to_rgb565 = blend_mode_row_to_rgb565;
+    kernels->blend_mode_row_to_rgb888 = blend_mode_row_to_rgb888;
+    kernels->blend_mode_row_to_argb8888 = blend_mode_row_to_argb8888;
+    kernels->rgb565_swap = rgb565_swap;
+    kernels->rotate = rotate;
+    kernels->transform_argb8888 = transform_argb8888;
+    kernels->transform_rgb888 = transform_rgb888;
+    kernels->transform_rgb565a8 = transform_rgb565a8;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_result_t color_blend_to_rgb565(_lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint8_t * dest_row = dsc->dest_buf;
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    vec_t color_v = vec_set1_16(color16);
+    vec_t opa_v = vec_set1_16(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint16_t * dest = (uint16_t *)dest_row;
+        if(mask == NULL && opa >= LV_OPA_MAX) {
+            for(x = 0; x <= w - PX16_CNT; x += PX16_CNT) {
+                vec_storeu(&dest[x], color_v);
+            }
+            for(; x < w; x++) dest[x] = color16;
+        }
+        else {
+            for(x = 0; x <= w - PX16_CNT; x += PX16_CNT) {
+                vec_t mask_v = mask ? load_mask_16(&mask[x]) : opa_v;
+                vec_t mix = get_mix(mask_v, mask != NULL, opa_v, opa);
+                vec_storeu(&dest[x], mix_16_16(color_v, vec_loadu(&dest[x]), mix));
+            }
+            for(; x < w; x++) {
+                dest[x] = lv_color_16_16_mix(color16, dest[x], get_mix_px(mask, x, opa));
+            }
+        }
+        dest_row += dsc->dest_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+static lv_result_t rgb565_blend_normal_to_rgb565(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint8_t * dest_row = dsc->dest_buf;
+    const uint8_t * src_row = dsc->src_buf;
+    vec_t opa_v = vec_set1_16(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint16_t * dest = (uint16_t *)dest_row;
+        const uint16_t * src = (const uint16_t *)src_row;
+        for(x = 0; x <= w - PX16_CNT; x += PX16_CNT) {
+            vec_t mask_v = mask ? load_mask_16(&mask[x]) : opa_v;
+            vec_t mix = get_mix(mask_v, mask != NULL, opa_v, opa);
+            vec_storeu(&dest[x], mix_16_16(vec_loadu(&src[x]), vec_loadu(&dest[x]), mix));
+        }
+        for(; x < w; x++) {
+            dest[x] = lv_color_16_16_mix(src[x], dest[x], get_mix_px(mask, x, opa));
+        }
+        dest_row += dsc->dest_stride;
+        src_row += dsc->src_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+static lv_result_t argb8888_blend_normal_to_rgb565(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint8_t * dest_row = dsc->dest_buf;
+    const uint8_t * src_row = dsc->src_buf;
+    vec_t opa_v = vec_set1_16(opa);
+    vec_t ch_mask = vec_set1_32(0xFF);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint16_t * dest = (uint16_t *)dest_row;
+        const uint32_t * src = (const uint32_t *)src_row;
+        for(x = 0; x <= w - PX16_CNT; x += PX16_CNT) {
+            vec_t src1 = vec_loadu(&src[x]);
+            vec_t src2 = vec_loadu(&src[x + PX32_CNT]);
+            vec_t r = pack_32_to_16(vec_and(vec_srli32(src1, 16), ch_mask), vec_and(vec_srli32(src2, 16), ch_mask));
+            vec_t g = pack_32_to_16(vec_and(vec_srli32(src1, 8), ch_mask), vec_and(vec_srli32(src2, 8), ch_mask));
+            vec_t b = pack_32_to_16(vec_and(src1, ch_mask), vec_and(src2, ch_mask));
+            vec_t a = pack_32_to_16(vec_srli32(src1, 24), vec_srli32(src2, 24));
+            vec_t mask_v = mask ? load_mask_16(&mask[x]) : opa_v;
+            vec_t mix = get_mix_alpha(a, mask_v, mask != NULL, opa_v, opa);
+            vec_storeu(&dest[x], mix_24_16(r, g, b, vec_loadu(&dest[x]), mix));
+        }
+        for(; x < w; x++) {
+            const uint8_t * src_px = (const uint8_t *)&src[x];
+            dest[x] = mix_24_16_px(src_px, dest[x], get_mix_alpha_px(src_px[3], mask, x, opa));
+        }
+        dest_row += dsc->dest_stride;
+        src_row += dsc->src_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+static lv_result_t color_blend_to_rgb888(_lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size)
+{
+    if(dst_px_size != 4) return LV_RESULT_INVALID;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint8_t * dest_row = dsc->dest_buf;
+    uint32_t color32 = lv_color_to_u32(dsc->color);
+    vec_t color_v = vec_set1_32(color32);
+    vec_t opa_v = vec_set1_32(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint32_t * dest = (uint32_t *)dest_row;
+        if(mask == NULL && opa >= LV_OPA_MAX) {
+            for(x = 0; x <= w - PX32_CNT; x += PX32_CNT) {
+                vec_storeu(&dest[x], color_v);
+            }
+            for(; x < w; x++) dest[x] = color32;
+        }
+        else {
+            for(x = 0; x <= w - PX32_CNT; x += PX32_CNT) {
+                vec_t mask_v = mask ? load_mask_32(&mask[x]) : opa_v;
+                vec_t mix = get_mix(mask_v, mask != NULL, opa_v, opa);
+                vec_storeu(&dest[x], mix_24_24(color_v, vec_loadu(&dest[x]), mix));
+            }
+            for(; x < w; x++) {
+                mix_24_24_px((const uint8_t *)&color32, (uint8_t *)&dest[x], get_mix_px(mask, x, opa));
+            }
+        }
+        dest_row += dsc->dest_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+static lv_result_t rgb888_blend_normal_to_rgb888(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size,
+                                                uint32_t src_px_size)
+{
+    if(dst_px_size != 4 || src_px_size != 4) return LV_RESULT_INVALID;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint8_t * dest_row = dsc->dest_buf;
+    const uint8_t * src_row = dsc->src_buf;
+    vec_t opa_v = vec_set1_32(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint32_t * dest = (uint32_t *)dest_row;
+        const uint32_t * src = (const uint32_t *)src_row;
+        for(x = 0; x <= w - PX32_CNT; x += PX32_CNT) {
+            vec_t mask_v = mask ? load_mask_32(&mask[x]) : opa_v;
+            vec_t mix = get_mix(mask_v, mask != NULL, opa_v, opa);
+            vec_storeu(&dest[x], mix_24_24(vec_loadu(&src[x]), vec_loadu(&dest[x]), mix));
+        }
+        for(; x < w; x++) {
+            mix_24_24_px((const uint8_t *)&src[x], (uint8_t *)&dest[x], get_mix_px(mask, x, opa));
+        }
+        dest_row += dsc->dest_stride;
+        src_row += dsc->src_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+static lv_result_t argb8888_blend_normal_to_rgb888(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size)
+{
+    if(dst_px_size != 4) return LV_RESULT_INVALID;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint8_t * dest_row = dsc->dest_buf;
+    const uint8_t * src_row = dsc->src_buf;
+    vec_t opa_v = vec_set1_32(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint32_t * dest = (uint32_t *)dest_row;
+        const uint32_t * src = (const uint32_t *)src_row;
+        for(x = 0; x <= w - PX32_CNT; x += PX32_CNT) {
+            vec_t src_v = vec_loadu(&src[x]);
+            vec_t mask_v = mask ? load_mask_32(&mask[x]) : opa_v;
+            vec_t mix = get_mix_alpha(vec_srli32(src_v, 24), mask_v, mask != NULL, opa_v, opa);
+            vec_storeu(&dest[x], mix_24_24(src_v, vec_loadu(&dest[x]), mix));
+        }
+        for(; x < w; x++) {
+            const uint8_t * src_px = (const uint8_t *)&src[x];
+            mix_24_24_px(src_px, (uint8_t *)&dest[x], get_mix_alpha_px(src_px[3], mask, x, opa));
+        }
+        dest_row += dsc->dest_stride;
+        src_row += dsc->src_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+static lv_result_t color_blend_to_argb8888(_lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint8_t * dest_row = dsc->dest_buf;
+    uint32_t color32 = lv_color_to_u32(dsc->color);
+    vec_t color_v = vec_set1_32(color32);
+    vec_t color_rgb_v = vec_set1_32(color32 & 0x00FFFFFF);
+    vec_t opa_v = vec_set1_32(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint32_t * dest = (uint32_t *)dest_row;
+        if(mask == NULL && opa >= LV_OPA_MAX) {
+            for(x = 0; x <= w - PX32_CNT; x += PX32_CNT) {
+                vec_storeu(&dest[x], color_v);
+            }
+            for(; x < w; x++) dest[x] = color32;
+        }
+        else {
+            lv_color32_t fg_px = lv_color_to_32(dsc->color, 0xff);
+            for(x = 0; x <= w - PX32_CNT; x += PX32_CNT) {
+                vec_t mask_v = mask ? load_mask_32(&mask[x]) : opa_v;
+                vec_t mix = get_mix(mask_v, mask != NULL, opa_v, opa);
+                vec_t fg = vec_or(color_rgb_v, vec_slli32(mix, 24));
+                vec_t res;
+                if(mix_32_32(fg, vec_loadu(&dest[x]), &res)) {
+                    vec_storeu(&dest[x], res);
+                }
+                else {
+                    int32_t i;
+                    for(i = x; i < x + PX32_CNT; i++) {
+                        fg_px.alpha = get_mix_px(mask, i, opa);
+                        ((lv_color32_t *)dest)[i] = mix_32_32_px(fg_px, ((lv_color32_t *)dest)[i]);
+                    }
+                }
+            }
+            for(; x < w; x++) {
+                fg_px.alpha = get_mix_px(mask, x, opa);
+                ((lv_color32_t *)dest)[x] = mix_32_32_px(fg_px, ((lv_color32_t *)dest)[x]);
+            }
+        }
+        dest_row += dsc->dest_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+static lv_result_t argb8888_blend_normal_to_argb8888(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint8_t * dest_row = dsc->dest_buf;
+    const uint8_t * src_row = dsc->src_buf;
+    vec_t opa_v = vec_set1_32(opa);
+    vec_t rgb_mask = vec_set1_32(0x00FFFFFF);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        lv_color32_t * dest = (lv_color32_t *)dest_row;
+        const lv_color32_t * src = (const lv_color32_t *)src_row;
+        for(x = 0; x <= w - PX32_CNT; x += PX32_CNT) {
+            vec_t src_v = vec_loadu(&src[x]);
+            vec_t mask_v = mask ? load_mask_32(&mask[x]) : opa_v;
+            vec_t mix = get_mix_alpha(vec_srli32(src_v, 24), mask_v, mask != NULL, opa_v, opa);
+            vec_t fg = vec_or(vec_and(src_v, rgb_mask), vec_slli32(mix, 24));
+            vec_t res;
+            if(mix_32_32(fg, vec_loadu(&dest[x]), &res)) {
+                vec_storeu(&dest[x], res);
+            }
+            else {
+                int32_t i;
+                for(i = x; i < x + PX32_CNT; i++) {
+                    lv_color32_t fg_px = src[i];
+                    fg_px.alpha = get_mix_alpha_px(fg_px.alpha, mask, i, opa);
+                    dest[i] = mix_32_32_px(fg_px, dest[i]);
+                }
+            }
+        }
+        for(; x < w; x++) {
+            lv_color32_t fg_px = src[x];
+            fg_px.alpha = get_mix_alpha_px(fg_px.alpha, mask, x, opa);
+            dest[x] = mix_32_32_px(fg_px, dest[x]);
+        }
+        dest_row += dsc->dest_stride;
+        src_row += dsc->src_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+static lv_result_t blend_mode_row_to_rgb565(uint16_t * dest, const lv_color32_t * src, int32_t len,
+                                            lv_blend_mode_t mode)
+{
+    if(!is_blend_mode_supported(mode)) return LV_RESULT_INVALID;
+
+    const uint32_t * src32 = (const uint32_t *)src;
+    int32_t x;
+    for(x = 0; x <= len - PX16_CNT; x += PX16_CNT) {
+        vec_storeu(&dest[x], blend_mode_16(vec_loadu(&dest[x]), &src32[x], mode));
+    }
+
+    /*Handle the remaining pixels in a vector padded with transparent pixels*/
+    if(x < len) {
+        uint16_t dest_tmp[PX16_CNT] = {0};
+        uint32_t src_tmp[PX16_CNT] = {0};
+        lv_memcpy(dest_tmp, &dest[x], (len - x) * sizeof(uint16_t));
+        lv_memcpy(src_tmp, &src32[x], (len - x) * sizeof(uint32_t));
+        vec_storeu(dest_tmp, blend_mode_16(vec_loadu(dest_tmp), src_tmp, mode));
+        lv_memcpy(&dest[x], dest_tmp, (len - x) * sizeof(uint16_t));
+    }
+
+    return LV_RESULT_OK;
+}
+
+static lv_result_t blend_mode_row_to_rgb888(uint8_t * dest, const lv_color32_t * src, int32_t len,
+                                            lv_blend_mode_t mode, uint32_t dst_px_size)
+{
+    if(dst_px_size != 4) return LV_RESULT_INVALID;
+    if(!is_blend_mode_supported(mode)) return LV_RESULT_INVALID;
+
+    uint32_t * dest32 = (uint32_t *)dest;
+    const uint32_t * src32 = (const uint32_t *)src;
+    int32_t x;
+    for(x = 0; x <= len - PX32_CNT; x += PX32_CNT) {
+        blend_mode_32_to_xrgb8888(&dest32[x], &src32[x], mode);
+    }
+
+    /*Handle the remaining pixels in a vector padded with transparent pixels*/
+    if(x < len) {
+        uint32_t dest_tmp[PX32_CNT] = {0};
+        uint32_t src_tmp[PX32_CNT] = {0};
+        lv_memcpy(dest_tmp, &dest32[x], (len - x) * sizeof(uint32_t));
+        lv_memcpy(src_tmp, &src32[x], (len - x) * sizeof(uint32_t));
+        blend_mode_32_to_xrgb8888(dest_tmp, src_tmp, mode);
+        lv_memcpy(&dest32[x], dest_tmp, (len - x) * sizeof(uint32_t));
+    }
+
+    return LV_RESULT_OK;
+}
+
+static lv_result_t blend_mode_row_to_argb8888(lv_color32_t * dest, const lv_color32_t * src, int32_t len,
+                                              lv_blend_mode_t mode)
+{
+    if(!is_blend_mode_supported(mode)) return LV_RESULT_INVALID;
+
+    int32_t x;
+    for(x = 0; x <= len - PX32_CNT; x += PX32_CNT) {
+        blend_mode_32_to_argb8888(&dest[x], &src[x], mode);
+    }
+
+    /*Handle the remaining pixels in a vector padded with transparent pixels*/
+    if(x < len) {
+        lv_color32_t dest_tmp[PX32_CNT];
+        lv_color32_t src_tmp[PX32_CNT];
+        lv_memzero(dest_tmp, sizeof(dest_tmp));
+        lv_memzero(src_tmp, sizeof(src_tmp));
+        lv_memcpy(dest_tmp, &dest[x], (len - x) * sizeof(lv_color32_t));
+        lv_memcpy(src_tmp, &src[x], (len - x) * sizeof(lv_color32_t));
+        blend_mode_32_to_argb8888(dest_tmp, src_tmp, mode);
+        lv_memcpy(&dest[x], dest_tmp, (len - x) * sizeof(lv_color32_t));
+    }
+
+    return LV_RESULT_OK;
+}
+
+static lv_result_t rgb565_swap(void * buf, uint32_t buf_size_px)
+{
+    uint16_t * buf16 = buf;
+    uint32_t i;
+    for(i = 0; i + PX16_CNT <= buf_size_px; i += PX16_CNT) {
+        vec_t px = vec_loadu(&buf16[i]);
+        vec_storeu(&buf16[i], vec_or(vec_slli16(px, 8), vec_srli16(px, 8)));
+    }
+    for(; i < buf_size_px; i++) {
+        buf16[i] = (uint16_t)((buf16[i] << 8) | (buf16[i] >> 8));
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Rotate 16 and 32 bit pixels.
+ * By 90 and 270 degrees the image is processed in `ROTATE_TILE_SIZE` large tiles to keep the written rows in the cache
+ * and the blocks of the tiles (4x4 pixels of 32 bit or 8x8 pixels of 16 bit) are transposed in SSE2 registers.
+ * By 180 degrees the rows are reversed in the registers. The edges are handled pixel by pixel.
+ */
+static lv_result_t rotate(const void * src, void * dest, int32_t src_width, int32_t src_height, int32_t src_stride,
+                          int32_t dest_stride, lv_display_rotation_t rotation, uint32_t px_size)
+{
+    if(px_size != 2 && px_size != 4) return LV_RESULT_INVALID;
+
+    /*Called with constant pixel sizes to let the compiler remove the checks of the pixel size*/
+    if(rotation == LV_DISPLAY_ROTATION_180) {
+        if(px_size == 4) rotate_180(src, dest, src_width, src_height, src_stride, dest_stride, 4);
+        else rotate_180(src, dest, src_width, src_height, src_stride, dest_stride, 2);
+    }
+    else if(rotation == LV_DISPLAY_ROTATION_90 || rotation == LV_DISPLAY_ROTATION_270) {
+        if(px_size == 4) rotate_90_270(src, dest, src_width, src_height, src_stride, dest_stride, rotation, 4);
+        else rotate_90_270(src, dest, src_width, src_height, src_stride, dest_stride, rotation, 2);
+    }
+    else {
+        return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Transform a line of an ARGB8888 image with bilinear sampling like `transform_argb8888` in lv_draw_sw_transform.c.
+ * The coordinates and the mixing are calculated on vectors of pixels, only the source pixels are fetched one by one.
+ */
+static lv_result_t transform_argb8888(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                      int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                      int32_t x_end, uint8_t * dest_buf, bool aa)
+{
+    if(!aa) return LV_RESULT_INVALID;
+
+    uint32_t * dest = (uint32_t *)dest_buf;
+    uint32_t px[PX32_CNT];
+    uint32_t hor[PX32_CNT];
+    uint32_t ver[PX32_CNT];
+    transform_lanes_t lanes;
+
+    vec_t xs_acc = transform_acc_init(xs_step, 0);
+    vec_t ys_acc = transform_acc_init(ys_step, 0);
+    vec_t xs_inc = vec_set1_32(xs_step * PX32_CNT);
+    vec_t ys_inc = vec_set1_32(ys_step * PX32_CNT);
+
+    int32_t x;
+    for(x = 0; x < x_end; x += PX32_CNT) {
+        int32_t cnt = LV_MIN(PX32_CNT, x_end - x);
+        transform_lanes_res_t lanes_res = TRANSFORM_LANES_MIXED;
+        if(cnt == PX32_CNT) lanes_res = transform_get_lanes(xs_acc, ys_acc, xs_ups, ys_ups, src_w, src_h, &lanes, 0);
+        xs_acc = vec_add32(xs_acc, xs_inc);
+        ys_acc = vec_add32(ys_acc, ys_inc);
+
+        if(lanes_res == TRANSFORM_LANES_OUT) {
+            vec_storeu(&dest[x], vec_zero());
+            continue;
+        }
+
+        int32_t inside_cnt = PX32_CNT;
+        if(lanes_res == TRANSFORM_LANES_MIXED) {
+            inside_cnt = transform_get_lanes_px(xs_ups, ys_ups, xs_step, ys_step, x, cnt, PX32_CNT, src_w, src_h,
+                                                &lanes);
+        }
+
+        int32_t i;
+        if(inside_cnt == 0) {
+            for(i = 0; i < cnt; i++) transform_argb8888_edge_px(src, src_w, src_h, src_stride, &lanes, i, &dest[x + i]);
+            continue;
+        }
+
+        for(i = 0; i < PX32_CNT; i++) {
+            if(inside_cnt < PX32_CNT && !lanes.inside[i]) {
+                px[i] = 0;
+                hor[i] = 0;
+                ver[i] = 0;
+                continue;
+            }
+            const uint32_t * p = (const uint32_t *)(src + lanes.y[i] * src_stride + lanes.x[i] * 4);
+            px[i] = p[0];
+            hor[i] = p[lanes.x_next[i]];
+            ver[i] = *(const uint32_t *)((const uint8_t *)p + lanes.y_next[i] * src_stride);
+        }
+
+        vec_t res = transform_mix_32(vec_loadu(px), vec_loadu(ver), vec_loadu(lanes.y_fract), true);
+        res = transform_mix_32(res, vec_loadu(hor), vec_loadu(lanes.x_fract), true);
+
+        if(inside_cnt == PX32_CNT) {
+            vec_storeu(&dest[x], res);
+        }
+        else {
+            vec_storeu(px, res);
+            for(i = 0; i < cnt; i++) {
+                if(lanes.inside[i]) dest[x + i] = px[i];
+                else transform_argb8888_edge_px(src, src_w, src_h, src_stride, &lanes, i, &dest[x + i]);
+            }
+        }
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Transform a line of an RGB888 or XRGB8888 image to ARGB8888 like `transform_rgb888` in lv_draw_sw_transform.c.
+ */
+static lv_result_t transform_rgb888(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                    int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                    int32_t x_end, uint8_t * dest_buf, bool aa, uint32_t px_size)
+{
+    if(!aa) return LV_RESULT_INVALID;
+
+    uint32_t * dest = (uint32_t *)dest_buf;
+    uint32_t px[PX32_CNT];
+    uint32_t hor[PX32_CNT];
+    uint32_t ver[PX32_CNT];
+    transform_lanes_t lanes;
+
+    vec_t xs_acc = transform_acc_init(xs_step, 0);
+    vec_t ys_acc = transform_acc_init(ys_step, 0);
+    vec_t xs_inc = vec_set1_32(xs_step * PX32_CNT);
+    vec_t ys_inc = vec_set1_32(ys_step * PX32_CNT);
+
+    int32_t x;
+    for(x = 0; x < x_end; x += PX32_CNT) {
+        int32_t cnt = LV_MIN(PX32_CNT, x_end - x);
+        transform_lanes_res_t lanes_res = TRANSFORM_LANES_MIXED;
+        if(cnt == PX32_CNT) lanes_res = transform_get_lanes(xs_acc, ys_acc, xs_ups, ys_ups, src_w, src_h, &lanes, 0);
+        xs_acc = vec_add32(xs_acc, xs_inc);
+        ys_acc = vec_add32(ys_acc, ys_inc);
+
+        if(lanes_res == TRANSFORM_LANES_OUT) {
+            /*Only the alpha channel is cleared*/
+            vec_storeu(&dest[x], vec_and(vec_loadu(&dest[x]), vec_set1_32(0x00FFFFFF)));
+            continue;
+        }
+
+        int32_t inside_cnt = PX32_CNT;
+        if(lanes_res == TRANSFORM_LANES_MIXED) {
+            inside_cnt = transform_get_lanes_px(xs_ups, ys_ups, xs_step, ys_step, x, cnt, PX32_CNT, src_w, src_h,
+                                                &lanes);
+        }
+
+        int32_t i;
+        if(inside_cnt == 0) {
+            for(i = 0; i < cnt; i++) {
+                transform_rgb888_edge_px(src, src_w, src_h, src_stride, px_size, &lanes, i, &dest[x + i]);
+            }
+            continue;
+        }
+
+        for(i = 0; i < PX32_CNT; i++) {
+            if(inside_cnt < PX32_CNT && !lanes.inside[i]) {
+                px[i] = 0;
+                hor[i] = 0;
+                ver[i] = 0;
+                continue;
+            }
+            const uint8_t * p = src + lanes.y[i] * src_stride + lanes.x[i] * (int32_t)px_size;
+            px[i] = load_rgb888(p);
+            hor[i] = load_rgb888(p + lanes.x_next[i] * (int32_t)px_size);
+            ver[i] = load_rgb888(p + lanes.y_next[i] * src_stride);
+        }
+
+        vec_t res = transform_mix_32(vec_loadu(px), vec_loadu(ver), vec_loadu(lanes.y_fract), false);
+        res = transform_mix_32(res, vec_loadu(hor), vec_loadu(lanes.x_fract), false);
+
+        if(inside_cnt == PX32_CNT) {
+            vec_storeu(&dest[x], res);
+        }
+        else {
+            vec_storeu(px, res);
+            for(i = 0; i < cnt; i++) {
+                if(lanes.inside[i]) dest[x + i] = px[i];
+                else transform_rgb888_edge_px(src, src_w, src_h, src_stride, px_size, &lanes, i, &dest[x + i]);
+            }
+        }
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Transform a line of an RGB565 or RGB565A8 image like `transform_rgb565a8` in lv_draw_sw_transform.c.
+ */
+static lv_result_t transform_rgb565a8(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                      int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                      int32_t x_end, uint16_t * cbuf, uint8_t * abuf, bool src_has_a8, bool aa)
+{
+    if(!aa) return LV_RESULT_INVALID;
+
+    const lv_opa_t * src_alpha = src + src_stride * src_h;
+    int32_t alpha_stride = src_stride / 2;
+
+    uint16_t px[PX16_CNT];
+    uint16_t hor[PX16_CNT];
+    uint16_t ver[PX16_CNT];
+    uint16_t a[PX16_CNT];
+    uint16_t a_hor[PX16_CNT];
+    uint16_t a_ver[PX16_CNT];
+    transform_lanes_t lanes;
+
+    /*The 16 pixels are handled in two vectors of 32 bit coordinates*/
+    vec_t xs_acc_lo = transform_acc_init(xs_step, 0);
+    vec_t ys_acc_lo = transform_acc_init(ys_step, 0);
+    vec_t xs_acc_hi = transform_acc_init(xs_step, PX32_CNT);
+    vec_t ys_acc_hi = transform_acc_init(ys_step, PX32_CNT);
+    vec_t xs_inc = vec_set1_32(xs_step * PX16_CNT);
+    vec_t ys_inc = vec_set1_32(ys_step * PX16_CNT);
+
+    int32_t x;
+    for(x = 0; x < x_end; x += PX16_CNT) {
+        int32_t cnt = LV_MIN(PX16_CNT, x_end - x);
+        transform_lanes_res_t lanes_res = TRANSFORM_LANES_MIXED;
+        if(cnt == PX16_CNT) {
+            lanes_res = transform_get_lanes(xs_acc_lo, ys_acc_lo, xs_ups, ys_ups, src_w, src_h, &lanes, 0);
+            if(lanes_res != TRANSFORM_LANES_MIXED &&
+               transform_get_lanes(xs_acc_hi, ys_acc_hi, xs_ups, ys_ups, src_w, src_h, &lanes, PX32_CNT) != lanes_res) {
+                lanes_res = TRANSFORM_LANES_MIXED;
+            }
+        }
+        xs_acc_lo = vec_add32(xs_acc_lo, xs_inc);
+        ys_acc_lo = vec_add32(ys_acc_lo, ys_inc);
+        xs_acc_hi = vec_add32(xs_acc_hi, xs_inc);
+        ys_acc_hi = vec_add32(ys_acc_hi, ys_inc);
+
+        if(lanes_res == TRANSFORM_LANES_OUT) {
+            lv_memzero(&abuf[x], PX16_CNT);
+            continue;
+        }
+
+        int32_t inside_cnt = PX16_CNT;
+        if(lanes_res == TRANSFORM_LANES_MIXED) {
+            inside_cnt = transform_get_lanes_px(xs_ups, ys_ups, xs_step, ys_step, x, cnt, PX16_CNT, src_w, src_h,
+                                                &lanes);
+        }
+
+        int32_t i;
+        if(inside_cnt == 0) {
+            for(i = 0; i < cnt; i++) {
+                transform_rgb565a8_edge_px(src, src_w, src_h, src_stride, src_has_a8, &lanes, i, &cbuf[x + i],
+                                           &abuf[x + i]);
+            }
+            continue;
+        }
+
+        for(i = 0; i < PX16_CNT; i++) {
+            if(inside_cnt < PX16_CNT && !lanes.inside[i]) {
+                px[i] = 0;
+                hor[i] = 0;
+                ver[i] = 0;
+                a[i] = 0;
+                a_hor[i] = 0;
+                a_ver[i] = 0;
+                continue;
+            }
+            const uint16_t * p = (const uint16_t *)(src + lanes.y[i] * src_stride + lanes.x[i] * 2);
+            px[i] = p[0];
+            hor[i] = p[lanes.x_next[i]];
+            ver[i] = *(const uint16_t *)((const uint8_t *)p + lanes.y_next[i] * src_stride);
+            if(src_has_a8) {
+                const lv_opa_t * pa = src_alpha + lanes.y[i] * alpha_stride + lanes.x[i];
+                a[i] = pa[0];
+                a_hor[i] = pa[lanes.x_next[i]];
+                a_ver[i] = pa[lanes.y_next[i] * alpha_stride];
+            }
+        }
+
+        /*The weights are 0..254 here*/
+        vec_t x_fract = vec_slli16(pack_32_to_16(vec_loadu(&lanes.x_fract[0]), vec_loadu(&lanes.x_fract[PX32_CNT])), 1);
+        vec_t y_fract = vec_slli16(pack_32_to_16(vec_loadu(&lanes.y_fract[0]), vec_loadu(&lanes.y_fract[PX32_CNT])), 1);
+        vec_t c = vec_loadu(px);
+        vec_t mix_ver = mix_16_16(vec_loadu(ver), c, y_fract);
+        vec_t mix_hor = mix_16_16(vec_loadu(hor), c, x_fract);
+        vec_t res = mix_16_16(mix_hor, mix_ver, vec_set1_16(LV_OPA_50));
+
+        vec_t a_v = vec_set1_16(0xFF);
+        if(src_has_a8) {
+            a_v = vec_loadu(a);
+            a_v = vec_srli16(vec_add16(transform_mix_a8(a_v, vec_loadu(a_ver), y_fract),
+                                       transform_mix_a8(a_v, vec_loadu(a_hor), x_fract)), 1);
+            /*The color of the fully transparent pixels is not mixed*/
+            res = vec_select(vec_cmpeq16(a_v, vec_zero()), c, res);
+        }
+
+        vec_storeu(px, res);
+        vec_storeu(a, a_v);
+        for(i = 0; i < cnt; i++) {
+            if(inside_cnt == PX16_CNT || lanes.inside[i]) {
+                cbuf[x + i] = px[i];
+                abuf[x + i] = (lv_opa_t)a[i];
+            }
+            else {
+                transform_rgb565a8_edge_px(src, src_w, src_h, src_stride, src_has_a8, &lanes, i, &cbuf[x + i],
+                                           &abuf[x + i]);
+            }
+        }
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Get `step * (first + i)` in the i-th lane
+ */
+static inline vec_t transform_acc_init(int32_t step, int32_t first)
+{
+    int32_t acc[PX32_CNT];
+    int32_t i;
+    for(i = 0; i < PX32_CNT; i++) acc[i] = step * (first + i);
+    return vec_loadu(acc);
+}
+
+/**
+ * Get where transformed pixels are on the source image like the C implementation
+ * @param xs_acc        `xs_step * x` of the pixels in 32 bit lanes
+ * @param ys_acc        `ys_step * x` of the pixels in 32 bit lanes
+ * @param xs_ups        X coordinate of the first pixel of the line in 1/256 pixel units
+ * @param ys_ups        Y coordinate of the first pixel of the line in 1/256 pixel units
+ * @param src_w         width of the source image
+ * @param src_h         height of the source image
+ * @param lanes         store the positions here
+ * @param ofs           index of the first lane to set in `lanes`
+ * @return              TRANSFORM_LANES_INSIDE: `lanes` is set, TRANSFORM_LANES_OUT: nothing to mix,
+ *                      TRANSFORM_LANES_MIXED: `transform_get_lanes_px` needs to be used
+ */
+static inline transform_lanes_res_t transform_get_lanes(vec_t xs_acc, vec_t ys_acc, int32_t xs_ups, int32_t ys_ups,
+                                                       int32_t src_w, int32_t src_h, transform_lanes_t * lanes,
+                                                       int32_t ofs)
+{
+    vec_t v80 = vec_set1_32(0x80);
+    vec_t v7f = vec_set1_32(0x7F);
+    vec_t vff = vec_set1_32(0xFF);
+    vec_t one = vec_set1_32(1);
+    vec_t minus_one = vec_set1_32(-1);
+
+    vec_t xs = vec_add32(vec_set1_32(xs_ups), vec_srai32(xs_acc, 8));
+    vec_t ys = vec_add32(vec_set1_32(ys_ups), vec_srai32(ys_acc, 8));
+    vec_t x_int = vec_srai32(xs, 8);
+    vec_t y_int = vec_srai32(ys, 8);
+    vec_t x_fract = vec_and(xs, vff);
+    vec_t y_fract = vec_and(ys, vff);
+
+    /*-1 (all bits set) if the neighbor is on the left or top, 1 otherwise*/
+    vec_t x_neg = vec_cmpgt32(v80, x_fract);
+    vec_t y_neg = vec_cmpgt32(v80, y_fract);
+    vec_t x_next = vec_or(x_neg, one);
+    vec_t y_next = vec_or(y_neg, one);
+    vec_t x_nb = vec_add32(x_int, x_next);
+    vec_t y_nb = vec_add32(y_int, y_next);
+
+    vec_t w = vec_set1_32(src_w);
+    vec_t h = vec_set1_32(src_h);
+    vec_t in_image = vec_and(vec_and(vec_cmpgt32(x_int, minus_one), vec_cmpgt32(w, x_int)),
+                             vec_and(vec_cmpgt32(y_int, minus_one), vec_cmpgt32(h, y_int)));
+    vec_t inside = vec_and(vec_and(vec_cmpgt32(x_nb, minus_one), vec_cmpgt32(w, x_nb)),
+                           vec_and(vec_cmpgt32(y_nb, minus_one), vec_cmpgt32(h, y_nb)));
+    inside = vec_and(inside, in_image);
+    if(vec_movemask8(in_image) == 0) return TRANSFORM_LANES_OUT;
+    if(vec_movemask8(inside) != MOVEMASK_ALL) return TRANSFORM_LANES_MIXED;
+
+    vec_storeu(&lanes->x[ofs], x_int);
+    vec_storeu(&lanes->y[ofs], y_int);
+    vec_storeu(&lanes->x_next[ofs], x_next);
+    vec_storeu(&lanes->y_next[ofs], y_next);
+    vec_storeu(&lanes->x_fract[ofs], vec_select(x_neg, vec_sub32(v7f, x_fract), vec_sub32(x_fract, v80)));
+    vec_storeu(&lanes->y_fract[ofs], vec_select(y_neg, vec_sub32(v7f, y_fract), vec_sub32(y_fract, v80)));
+    return TRANSFORM_LANES_INSIDE;
+}
+
+/**
+ * Get where transformed pixels are on the source image one by one. Used if some of them are not inside the image.
+ * @param xs_ups        X coordinate of the first pixel of the line in 1/256 pixel units
+ * @param ys_ups        Y coordinate of the first pixel of the line in 1/256 pixel units
+ * @param xs_step       X step in 1/256 pixel units
+ * @param ys_step       Y step in 1/256 pixel units
+ * @param x             index of the first pixel in the line
+ * @param cnt           number of pixels to process
+ * @param lane_cnt      number of lanes to set. Lanes after `cnt` are marked as not inside.
+ * @param src_w         width of the source image
+ * @param src_h         height of the source image
+ * @param lanes         store the positions here
+ * @return              number of pixels which can be mixed with their neighbors
+ */
+static inline int32_t transform_get_lanes_px(int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                             int32_t x, int32_t cnt, int32_t lane_cnt, int32_t src_w, int32_t src_h,
+                                             transform_lanes_t * lanes)
+{
+    int32_t inside_cnt = 0;
+    int32_t i;
+    for(i = 0; i < lane_cnt; i++) {
+        lanes->x_fract[i] = 0;
+        lanes->y_fract[i] = 0;
+        if(i >= cnt) {
+            lanes->in_image[i] = false;
+            lanes->inside[i] = false;
+            continue;
+        }
+
+        int32_t xs = xs_ups + ((xs_step * (x + i)) >> 8);
+        int32_t ys = ys_ups + ((ys_step * (x + i)) >> 8);
+        int32_t xs_int = xs >> 8;
+        int32_t ys_int = ys >> 8;
+        lanes->in_image[i] = xs_int >= 0 && xs_int < src_w && ys_int >= 0 && ys_int < src_h;
+        if(!lanes->in_image[i]) {
+            lanes->inside[i] = false;
+            continue;
+        }
+
+        int32_t xs_fract = xs & 0xFF;
+        int32_t ys_fract = ys & 0xFF;
+        int32_t x_next = xs_fract < 0x80 ? -1 : 1;
+        int32_t y_next = ys_fract < 0x80 ? -1 : 1;
+        lanes->x[i] = xs_int;
+        lanes->y[i] = ys_int;
+        lanes->x_next[i] = x_next;
+        lanes->y_next[i] = y_next;
+        lanes->inside[i] = xs_int + x_next >= 0 && xs_int + x_next <= src_w - 1 &&
+                           ys_int + y_next >= 0 && ys_int + y_next <= src_h - 1;
+
+        /*The edge pixels need the weights too*/
+        lanes->x_fract[i] = xs_fract < 0x80 ? 0x7F - xs_fract : xs_fract - 0x80;
+        lanes->y_fract[i] = ys_fract < 0x80 ? 0x7F - ys_fract : ys_fract - 0x80;
+        if(lanes->inside[i]) inside_cnt++;
+    }
+
+    return inside_cnt;
+}
+
+/**
+ * Tell which edge of the image a transformed pixel fades out on
+ * @param lanes         the positions of the pixels
+ * @param i             index of the pixel in `lanes`
+ * @param src_w         width of the source image
+ * @param src_h         height of the source image
+ * @return              1: on the left or right edge, 2: on the top or bottom edge, 0: not faded
+ */
+static inline int32_t transform_get_edge(const transform_lanes_t * lanes, int32_t i, int32_t src_w, int32_t src_h)
+{
+    if((lanes->x[i] == 0 && lanes->x_next[i] < 0) || (lanes->x[i] == src_w - 1 && lanes->x_next[i] > 0)) return 1;
+    if((lanes->y[i] == 0 && lanes->y_next[i] < 0) || (lanes->y[i] == src_h - 1 && lanes->y_next[i] > 0)) return 2;
+    return 0;
+}
+
+/**
+ * Transform an ARGB8888 pixel which has no neighbor in the image to mix with
+ */
+static inline void transform_argb8888_edge_px(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                              const transform_lanes_t * lanes, int32_t i, uint32_t * dest)
+{
+    if(!lanes->in_image[i]) {
+        *dest = 0x00000000;
+        return;
+    }
+
+    lv_color32_t px = *(const lv_color32_t *)(src + lanes->y[i] * src_stride + lanes->x[i] * 4);
+    int32_t edge = transform_get_edge(lanes, i, src_w, src_h);
+    if(edge == 1) px.alpha = (px.alpha * (0x7F - lanes->x_fract[i])) >> 7;
+    else if(edge == 2) px.alpha = (px.alpha * (0x7F - lanes->y_fract[i])) >> 7;
+    *(lv_color32_t *)dest = px;
+}
+
+/**
+ * Transform an RGB888 or XRGB8888 pixel which has no neighbor in the image to mix with
+ */
+static inline void transform_rgb888_edge_px(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                            uint32_t px_size, const transform_lanes_t * lanes, int32_t i,
+                                            uint32_t * dest)
+{
+    lv_color32_t * dest_c32 = (lv_color32_t *)dest;
+    if(!lanes->in_image[i]) {
+        dest_c32->alpha = 0x00;
+        return;
+    }
+
+    *dest = load_rgb888(src + lanes->y[i] * src_stride + lanes->x[i] * (int32_t)px_size);
+    int32_t edge = transform_get_edge(lanes, i, src_w, src_h);
+    if(edge == 1) dest_c32->alpha = (0xFF * (0xFF - lanes->x_fract[i])) >> 8;
+    else if(edge == 2) dest_c32->alpha = (0xFF * (0xFF - lanes->y_fract[i])) >> 8;
+}
+
+/**
+ * Transform an RGB565 or RGB565A8 pixel which has no neighbor in the image to mix with
+ */
+static inline void transform_rgb565a8_edge_px(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                              bool src_has_a8, const transform_lanes_t * lanes, int32_t i,
+                                              uint16_t * cbuf, uint8_t * abuf)
+{
+    if(!lanes->in_image[i]) {
+        *abuf = 0x00;
+        return;
+    }
+
+    *cbuf = *(const uint16_t *)(src + lanes->y[i] * src_stride + lanes->x[i] * 2);
+    lv_opa_t a = 0xFF;
+    if(src_has_a8) a = src[src_stride * src_h + lanes->y[i] * (src_stride / 2) + lanes->x[i]];
+
+    int32_t edge = transform_get_edge(lanes, i, src_w, src_h);
+    if(edge == 1) *abuf = (a * (0xFF - lanes->x_fract[i] * 2)) >> 8;
+    else if(edge == 2) *abuf = (a * (0xFF - lanes->y_fract[i] * 2)) >> 8;
+    else *abuf = a;
+}
+
+/**
+ * Load an RGB888 or XRGB8888 pixel as an opaque ARGB8888 pixel
+ */
+static inline uint32_t load_rgb888(const uint8_t * p)
+{
+    return 0xFF000000 | ((uint32_t)p[2] << 16) | ((uint32_t)p[1] << 8) | p[0];
+}
+
+/**
+ * Mix the neighbors of transformed ARGB8888 pixels into them like `transform_argb8888` and
+ * `transform_rgb888` in lv_draw_sw_transform.c. The color is mixed like `lv_color_mix32`.
+ * @param px            the pixels
+ * @param next          their horizontal or vertical neighbors
+ * @param fract         the weights of the neighbors (0..127) in 32 bit lanes
+ * @param mix_alpha     true: mix the alpha channels too; false: keep the alpha of `px`
+ * @return              the mixed pixels
+ */
+static inline vec_t transform_mix_32(vec_t px, vec_t next, vec_t fract, bool mix_alpha)
+{
+    vec_t same = vec_cmpeq32(px, next);
+    vec_t next_a = vec_srli32(next, 24);
+
+    /*The color is kept if the neighbor is the same or transparent, or its weight is too small*/
+    vec_t keep = vec_or(same, vec_cmpgt32(vec_set1_32(LV_OPA_MIN + 1), fract));
+    if(mix_alpha) keep = vec_or(keep, vec_cmpeq32(next_a, vec_zero()));
+    vec_t res = mix_24_24(next, px, vec_andnot(keep, fract));
+    if(!mix_alpha) return res;
+
+    /*The products fit into the lower 16 bits of the 32 bit lanes*/
+    vec_t px_a = vec_srli32(px, 24);
+    vec_t a = vec_add16(vec_mullo16(next_a, fract), vec_mullo16(px_a, vec_sub16(vec_set1_32(255), fract)));
+    a = vec_select(same, px_a, vec_srli32(a, 8));
+    return vec_or(vec_and(res, vec_set1_32(0x00FFFFFF)), vec_slli32(a, 24));
+}
+
+/**
+ * Mix the alpha of the neighbors of transformed pixels like `transform_rgb565a8` in lv_draw_sw_transform.c
+ * @param a             the alpha values in 16 bit lanes
+ * @param next          the alpha of their horizontal or vertical neighbors
+ * @param fract         the weights of the neighbors (0..254)
+ * @return              the mixed alpha values
+ */
+static inline vec_t transform_mix_a8(vec_t a, vec_t next, vec_t fract)
+{
+    vec_t res = vec_add16(vec_mullo16(next, fract), vec_mullo16(a, vec_sub16(vec_set1_16(0x100), fract)));
+    return vec_select(vec_cmpeq16(a, next), next, vec_srli16(res, 8));
+}
+
+/**
+ * Get the index of a pixel in the rotated buffer
+ * @param x             X coordinate in the source buffer
+ * @param y             Y coordinate in the source buffer
+ * @param w             width of the source buffer
+ * @param h             height of the source buffer
+ * @param dest_stride   stride of the destination buffer in pixels
+ * @param rotation      LV_DISPLAY_ROTATION_90/180/270
+ * @return              the index of the pixel in the destination buffer
+ */
+static inline int32_t rotated_index(int32_t x, int32_t y, int32_t w, int32_t h, int32_t dest_stride,
+                                    lv_display_rotation_t rotation)
+{
+    if(rotation == LV_DISPLAY_ROTATION_90) return (w - 1 - x) * dest_stride + y;
+    else if(rotation == LV_DISPLAY_ROTATION_180) return (h - 1 - y) * dest_stride + w - 1 - x;
+    else return x * dest_stride + h - 1 - y;
+}
+
+/**
+ * Rotate by 180 degrees
+ * @param src           pointer to the source buffer
+ * @param dest          pointer to the destination buffer
+ * @param w             width of the source buffer
+ * @param h             height of the source buffer
+ * @param src_stride    stride of the source buffer in bytes
+ * @param dest_stride   stride of the destination buffer in bytes
+ * @param px_size       2 or 4 bytes per pixel
+ */
+static inline void rotate_180(const uint8_t * src, uint8_t * dest, int32_t w, int32_t h, int32_t src_stride,
+                              int32_t dest_stride, uint32_t px_size)
+{
+    int32_t px_cnt = 16 / px_size;  /*Pixels in a register*/
+
+    /*Reverse the order of the pixels in the rows and the order of the rows*/
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * s = src + y * src_stride;
+        uint8_t * d = dest + (h - 1 - y) * dest_stride + w * px_size;
+        for(x = 0; x <= w - px_cnt; x += px_cnt) {
+            __m128i px = _mm_loadu_si128((const __m128i *)(s + x * px_size));
+            px = px_size == 4 ? _mm_shuffle_epi32(px, 0x1B) : reverse_16(px);
+            _mm_storeu_si128((__m128i *)(d - (x + px_cnt) * px_size), px);
+        }
+        for(; x < w; x++) {
+            if(px_size == 4) ((uint32_t *)d)[-1 - x] = ((const uint32_t *)s)[x];
+            else ((uint16_t *)d)[-1 - x] = ((const uint16_t *)s)[x];
+        }
+    }
+}
+
+/**
+ * Rotate by 90 or 270 degrees
+ * @param src           pointer to the source buffer
+ * @param dest          pointer to the destination buffer
+ * @param w             width of the source buffer
+ * @param h             height of the source buffer
+ * @param src_stride    stride of the source buffer in bytes
+ * @param dest_stride   stride of the destination buffer in bytes
+ * @param rotation      LV_DISPLAY_ROTATION_90/270
+ * @param px_size       2 or 4 bytes per pixel
+ */
+static inline void rotate_90_270(const uint8_t * src, uint8_t * dest, int32_t w, int32_t h, int32_t src_stride,
+                                 int32_t dest_stride, lv_display_rotation_t rotation, uint32_t px_size)
+{
+    int32_t block = 16 / px_size;   /*Pixels in a row of the transposed blocks*/
+    bool ccw = rotation == LV_DISPLAY_ROTATION_90;
+    lv_area_t edge;
+
+    int32_t x;
+    int32_t y;
+    int32_t tx;
+    int32_t ty;
+    for(ty = 0; ty < h; ty += ROTATE_TILE_SIZE) {
+        int32_t y_end = LV_MIN(ty + ROTATE_TILE_SIZE, h);
+        for(tx = 0; tx < w; tx += ROTATE_TILE_SIZE) {
+            int32_t x_end = LV_MIN(tx + ROTATE_TILE_SIZE, w);
+            for(y = ty; y <= y_end - block; y += block) {
+                /*The columns of the blocks are stored from the first destination row of the block*/
+                const uint8_t * s = src + y * src_stride;
+                uint8_t * d;
+                int32_t d_step;
+                if(ccw) {
+                    d = dest + (w - 1) * dest_stride + y * px_size;
+                    d_step = -dest_stride;
+                }
+                else {
+                    d = dest + (h - block - y) * px_size;
+                    d_step = dest_stride;
+                }
+
+                for(x = tx; x <= x_end - block; x += block) {
+                    if(px_size == 4) rotate_block_32(s + x * px_size, src_stride, d + x * d_step, d_step, !ccw);
+                    else rotate_block_16(s + x * px_size, src_stride, d + x * d_step, d_step, !ccw);
+                }
+
+                /*The remaining columns of these rows*/
+                if(x < x_end) {
+                    lv_area_set(&edge, x, y, x_end - 1, y + block - 1);
+                    rotate_area_px(src, dest, &edge, w, h, src_stride, dest_stride, rotation, px_size);
+                }
+            }
+
+            /*The remaining rows of the tile*/
+            if(y < y_end) {
+                lv_area_set(&edge, tx, y, x_end - 1, y_end - 1);
+                rotate_area_px(src, dest, &edge, w, h, src_stride, dest_stride, rotation, px_size);
+            }
+        }
+    }
+}
+
+/**
+ * Rotate an area of the source pixel by pixel
+ * @param src           pointer to the source buffer
+ * @param dest          pointer to the destination buffer
+ * @param area          the area to rotate in the source buffer. Nothing happens if it's empty.
+ * @param w             width of the source buffer
+ * @param h             height of the source buffer
+ * @param src_stride    stride of the source buffer in bytes
+ * @param dest_stride   stride of the destination buffer in bytes
+ * @param rotation      LV_DISPLAY_ROTATION_90/180/270
+ * @param px_size       2 or 4 bytes per pixel
+ */
+static void rotate_area_px(const void * src, void * dest, const lv_area_t * area, int32_t w, int32_t h,
+                           int32_t src_stride, int32_t dest_stride, lv_display_rotation_t rotation, uint32_t px_size)
+{
+    src_stride /= px_size;
+    dest_stride /= px_size;
+
+    int32_t x;
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        for(x = area->x1; x <= area->x2; x++) {
+            int32_t i = rotated_index(x, y, w, h, dest_stride, rotation);
+            if(px_size == 4) ((uint32_t *)dest)[i] = ((const uint32_t *)src)[y * src_stride + x];
+            else ((uint16_t *)dest)[i] = ((const uint16_t *)src)[y * src_stride + x];
+        }
+    }
+}
+
+/**
+ * Transpose a block of 4x4 32 bit pixels
+ * @param src           pointer to the top left pixel of the block
+ * @param src_stride    stride of the source in bytes
+ * @param dest          the first column of the block is stored here
+ * @param dest_step     the distance of the stored columns in bytes
+ * @param reverse       true: store the columns bottom to top
+ */
+static inline void rotate_block_32(const uint8_t * src, int32_t src_stride, uint8_t * dest, int32_t dest_step,
+                                   bool reverse)
+{
+    __m128i r0 = _mm_loadu_si128((const __m128i *)src);
+    __m128i r1 = _mm_loadu_si128((const __m128i *)(src + src_stride));
+    __m128i r2 = _mm_loadu_si128((const __m128i *)(src + 2 * src_stride));
+    __m128i r3 = _mm_loadu_si128((const __m128i *)(src + 3 * src_stride));
+
+    __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+    __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+    __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+    __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+    __m128i c0 = _mm_unpacklo_epi64(t0, t1);
+    __m128i c1 = _mm_unpackhi_epi64(t0, t1);
+    __m128i c2 = _mm_unpacklo_epi64(t2, t3);
+    __m128i c3 = _mm_unpackhi_epi64(t2, t3);
+
+    if(reverse) {
+        c0 = _mm_shuffle_epi32(c0, 0x1B);
+        c1 = _mm_shuffle_epi32(c1, 0x1B);
+        c2 = _mm_shuffle_epi32(c2, 0x1B);
+        c3 = _mm_shuffle_epi32(c3, 0x1B);
+    }
+
+    _mm_storeu_si128((__m128i *)dest, c0);
+    _mm_storeu_si128((__m128i *)(dest + dest_step), c1);
+    _mm_storeu_si128((__m128i *)(dest + 2 * dest_step), c2);
+    _mm_storeu_si128((__m128i *)(dest + 3 * dest_step), c3);
+}
+
+/**
+ * Transpose a block of 8x8 16 bit pixels
+ * @param src           pointer to the top left pixel of the block
+ * @param src_stride    stride of the source in bytes
+ * @param dest          the first column of the block is stored here
+ * @param dest_step     the distance of the stored columns in bytes
+ * @param reverse       true: store the columns bottom to top
+ */
+static inline void rotate_block_16(const uint8_t * src, int32_t src_stride, uint8_t * dest, int32_t dest_step,
+                                   bool reverse)
+{
+    __m128i r[8];
+    int32_t i;
+    for(i = 0; i < 8; i++) {
+        r[i] = _mm_loadu_si128((const __m128i *)(src + i * src_stride));
+    }
+
+    /*Pairs of rows interleaved, then 2 pixels of 4 rows, then the 8 pixels of the columns*/
+    __m128i a[8];
+    __m128i b[8];
+    __m128i c[8];
+    for(i = 0; i < 4; i++) {
+        a[2 * i] = _mm_unpacklo_epi16(r[2 * i], r[2 * i + 1]);
+        a[2 * i + 1] = _mm_unpackhi_epi16(r[2 * i], r[2 * i + 1]);
+    }
+    for(i = 0; i < 2; i++) {
+        b[4 * i] = _mm_unpacklo_epi32(a[4 * i], a[4 * i + 2]);
+        b[4 * i + 1] = _mm_unpackhi_epi32(a[4 * i], a[4 * i + 2]);
+        b[4 * i + 2] = _mm_unpacklo_epi32(a[4 * i + 1], a[4 * i + 3]);
+        b[4 * i + 3] = _mm_unpackhi_epi32(a[4 * i + 1], a[4 * i + 3]);
+    }
+    for(i = 0; i < 4; i++) {
+        c[2 * i] = _mm_unpacklo_epi64(b[i], b[i + 4]);
+        c[2 * i + 1] = _mm_unpackhi_epi64(b[i], b[i + 4]);
+    }
+
+    for(i = 0; i < 8; i++) {
+        if(reverse) c[i] = reverse_16(c[i]);
+        _mm_storeu_si128((__m128i *)(dest + i * dest_step), c[i]);
+    }
+}
+
+/**
+ * Reverse the order of the 16 bit lanes
+ */
+static inline __m128i reverse_16(__m128i v)
+{
+    v = _mm_shuffle_epi32(v, 0x1B);
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xB1), 0xB1);
+}
+
+/**
+ * Select the lanes of `a` where `cond` is set and the lanes of `b` elsewhere
+ */
+static inline vec_t vec_select(vec_t cond, vec_t a, vec_t b)
+{
+    return vec_or(vec_and(cond, a), vec_andnot(cond, b));
+}
+
+/**
+ * Load `PX16_CNT` mask values into 16 bit lanes
+ */
+static inline vec_t load_mask_16(const lv_opa_t * mask)
+{
+#if LV_BLEND_X86_AVX2
+    return _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)mask));
+#else
+    return _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)mask), _mm_setzero_si128());
+#endif
+}
+
+/**
+ * Load `PX32_CNT` mask values into 32 bit lanes
+ */
+static inline vec_t load_mask_32(const lv_opa_t * mask)
+{
+#if LV_BLEND_X86_AVX2
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)mask));
+#else
+    uint32_t m = (uint32_t)mask[0] | ((uint32_t)mask[1] << 8) | ((uint32_t)mask[2] << 16) | ((uint32_t)mask[3] << 24);
+    __m128i zero = _mm_setzero_si128();
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128((int)m), zero), zero);
+#endif
+}
+
+/**
+ * Pack two vectors with values in 0..255 from 32 bit lanes to 16 bit lanes keeping their order
+ */
+static inline vec_t pack_32_to_16(vec_t a, vec_t b)
+{
+#if LV_BLEND_X86_AVX2
+    /*The packing works in 128 bit halves so the 64 bit blocks need to be reordered*/
+    return _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8);
+#else
+    return _mm_packs_epi32(a, b);
+#endif
+}
+
+/**
+ * Get the mix ratio of a fill or an image without alpha channel the same way as the C implementation.
+ * Works with both 16 and 32 bit lanes.
+ * @param mask_v    the mask values (ignored if `has_mask` is false)
+ * @param has_mask  true: a mask is used
+ * @param opa_v     `opa` in each lane
+ * @param opa       the overall opacity
+ * @return          the mix ratios
+ */
+static inline vec_t get_mix(vec_t mask_v, bool has_mask, vec_t opa_v, lv_opa_t opa)
+{
+    if(!has_mask) return opa_v;
+    if(opa >= LV_OPA_MAX) return mask_v;
+    return vec_srli16(vec_mullo16(mask_v, opa_v), 8);
+}
+
+/**
+ * Get the mix ratio of an image with alpha channel the same way as the C implementation.
+ * Works with both 16 and 32 bit lanes.
+ * @param alpha     the alpha values of the pixels
+ * @param mask_v    the mask values (ignored if `has_mask` is false)
+ * @param has_mask  true: a mask is used
+ * @param opa_v     `opa` in each lane
+ * @param opa       the overall opacity
+ * @return          the mix ratios
+ */
+static inline vec_t get_mix_alpha(vec_t alpha, vec_t mask_v, bool has_mask, vec_t opa_v, lv_opa_t opa)
+{
+    if(!has_mask) {
+        if(opa >= LV_OPA_MAX) return alpha;
+        return vec_srli16(vec_mullo16(alpha, opa_v), 8);
+    }
+
+    /*alpha * mask fits into 16 bit, and the high 16 bits of `* opa` is `>> 16`*/
+    vec_t alpha_mask = vec_mullo16(alpha, mask_v);
+    if(opa >= LV_OPA_MAX) return vec_srli16(alpha_mask, 8);
+    return vec_mulhi_u16(alpha_mask, opa_v);
+}
+
+static inline lv_opa_t get_mix_px(const lv_opa_t * mask, int32_t x, lv_opa_t opa)
+{
+    if(mask == NULL) return opa;
+    if(opa >= LV_OPA_MAX) return mask[x];
+    return LV_OPA_MIX2(mask[x], opa);
+}
+
+static inline lv_opa_t get_mix_alpha_px(lv_opa_t alpha, const lv_opa_t * mask, int32_t x, lv_opa_t opa)
+{
+    if(mask == NULL) return opa >= LV_OPA_MAX ? alpha : LV_OPA_MIX2(alpha, opa);
+    if(opa >= LV_OPA_MAX) return LV_OPA_MIX2(alpha, mask[x]);
+    return LV_OPA_MIX3(alpha, mask[x], opa);
+}
+
+static inline bool is_blend_mode_supported(lv_blend_mode_t mode)
+{
+    return mode == LV_BLEND_MODE_ADDITIVE || mode == LV_BLEND_MODE_SUBTRACTIVE || mode == LV_BLEND_MODE_MULTIPLY;
+}
+
+/**
+ * Blend `PX16_CNT` ARGB8888 pixels to RGB565 pixels with a blend mode like `row_to_rgb565` of
+ * lv_draw_sw_blend_mode.c. The channels are calculated with 5 and 6 bit precision.
+ * @param dest      the destination pixels
+ * @param src       the source pixels. Their alpha channel is the mix ratio.
+ * @param mode      the blend mode
+ * @return          the new destination pixels
+ */
+static inline vec_t blend_mode_16(vec_t dest, const uint32_t * src, lv_blend_mode_t mode)
+{
+    vec_t ch_mask = vec_set1_32(0xFF);
+    vec_t mask5 = vec_set1_16(0x1F);
+    vec_t mask6 = vec_set1_16(0x3F);
+
+    vec_t src1 = vec_loadu(src);
+    vec_t src2 = vec_loadu(src + PX32_CNT);
+    vec_t src_r = pack_32_to_16(vec_and(vec_srli32(src1, 16), ch_mask), vec_and(vec_srli32(src2, 16), ch_mask));
+    vec_t src_g = pack_32_to_16(vec_and(vec_srli32(src1, 8), ch_mask), vec_and(vec_srli32(src2, 8), ch_mask));
+    vec_t src_b = pack_32_to_16(vec_and(src1, ch_mask), vec_and(src2, ch_mask));
+    vec_t mix = pack_32_to_16(vec_srli32(src1, 24), vec_srli32(src2, 24));
+    src_r = vec_srli16(src_r, 3);
+    src_g = vec_srli16(src_g, 2);
+    src_b = vec_srli16(src_b, 3);
+
+    vec_t r = vec_srli16(dest, 11);
+    vec_t g = vec_and(vec_srli16(dest, 5), mask6);
+    vec_t b = vec_and(dest, mask5);
+
+    if(mode == LV_BLEND_MODE_ADDITIVE) {
+        r = vec_min16(vec_add16(r, src_r), mask5);
+        g = vec_min16(vec_add16(g, src_g), mask6);
+        b = vec_min16(vec_add16(b, src_b), mask5);
+    }
+    else if(mode == LV_BLEND_MODE_SUBTRACTIVE) {
+        r = vec_max16(vec_sub16(r, src_r), vec_zero());
+        g = vec_max16(vec_sub16(g, src_g), vec_zero());
+        b = vec_max16(vec_sub16(b, src_b), vec_zero());
+    }
+    else {
+        r = vec_srli16(vec_mullo16(r, src_r), 5);
+        g = vec_srli16(vec_mullo16(g, src_g), 6);
+        b = vec_srli16(vec_mullo16(b, src_b), 5);
+    }
+
+    vec_t res = vec_or(vec_or(vec_slli16(r, 11), vec_slli16(g, 5)), b);
+    return mix_16_16(res, dest, mix);
+}
+
+/**
+ * Apply a blend mode on the RGB channels of 32 bit pixels.
+ * The 4th byte of the result is the 4th byte of `src`.
+ * @param dest      the destination pixels
+ * @param src       the source pixels
+ * @param mode      the blend mode
+ * @return          the result of the blend mode (not mixed with `dest` yet)
+ */
+static inline vec_t blend_mode_32(vec_t dest, vec_t src, lv_blend_mode_t mode)
+{
+    vec_t res;
+    if(mode == LV_BLEND_MODE_ADDITIVE) {
+        res = vec_adds_u8(dest, src);
+    }
+    else if(mode == LV_BLEND_MODE_SUBTRACTIVE) {
+        res = vec_subs_u8(dest, src);
+    }
+    else {
+        vec_t zero = vec_zero();
+        vec_t lo = vec_srli16(vec_mullo16(vec_unpacklo8(dest, zero), vec_unpacklo8(src, zero)), 8);
+        vec_t hi = vec_srli16(vec_mullo16(vec_unpackhi8(dest, zero), vec_unpackhi8(src, zero)), 8);
+        res = vec_packus16(lo, hi);
+    }
+
+    return vec_select(vec_set1_32(0x00FFFFFF), res, src);
+}
+
+/**
+ * Blend `PX32_CNT` ARGB8888 pixels to XRGB8888 pixels with a blend mode
+ * @param dest      the destination pixels
+ * @param src       the source pixels. Their alpha channel is the mix ratio.
+ * @param mode      the blend mode
+ */
+static inline void blend_mode_32_to_xrgb8888(uint32_t * dest, const uint32_t * src, lv_blend_mode_t mode)
+{
+    vec_t dest_v = vec_loadu(dest);
+    vec_t src_v = vec_loadu(src);
+    vec_storeu(dest, mix_24_24(blend_mode_32(dest_v, src_v, mode), dest_v, vec_srli32(src_v, 24)));
+}
+
+/**
+ * Blend `PX32_CNT` ARGB8888 pixels to ARGB8888 pixels with a blend mode
+ * @param dest      the destination pixels
+ * @param src       the source pixels. Their alpha channel is the mix ratio.
+ * @param mode      the blend mode
+ */
+static inline void blend_mode_32_to_argb8888(lv_color32_t * dest, const lv_color32_t * src, lv_blend_mode_t mode)
+{
+    vec_t dest_v = vec_loadu(dest);
+    vec_t fg = blend_mode_32(dest_v, vec_loadu(src), mode);
+    vec_t res;
+    if(mix_32_32(fg, dest_v, &res)) {
+        vec_storeu(dest, res);
+    }
+    else {
+        lv_color32_t fg_px[PX32_CNT];
+        vec_storeu(fg_px, fg);
+        int32_t i;
+        for(i = 0; i < PX32_CNT; i++) {
+            dest[i] = mix_32_32_px(fg_px[i], dest[i]);
+        }
+    }
+}
+
+/**
+ * Mix RGB565 pixels like `lv_color_16_16_mix`.
+ * Its packed 32 bit calculation is the same as mixing the channels one by one
+ * with a 5 bit ratio and an arithmetic shift.
+ * @param fg        the foreground colors
+ * @param bg        the background colors
+ * @param mix       the mix ratios in 16 bit lanes
+ * @return          the mixed colors
+ */
+static inline vec_t mix_16_16(vec_t fg, vec_t bg, vec_t mix)
+{
+    vec_t mix5 = vec_srli16(vec_add16(mix, vec_set1_16(4)), 3);
+    vec_t mask5 = vec_set1_16(0x1F);
+    vec_t mask6 = vec_set1_16(0x3F);
+
+    vec_t bg_r = vec_srli16(bg, 11);
+    vec_t bg_g = vec_and(vec_srli16(bg, 5), mask6);
+    vec_t bg_b = vec_and(bg, mask5);
+
+    vec_t r = vec_sub16(vec_srli16(fg, 11), bg_r);
+    vec_t g = vec_sub16(vec_and(vec_srli16(fg, 5), mask6), bg_g);
+    vec_t b = vec_sub16(vec_and(fg, mask5), bg_b);
+
+    r = vec_add16(bg_r, vec_srai16(vec_mullo16(r, mix5), 5));
+    g = vec_add16(bg_g, vec_srai16(vec_mullo16(g, mix5), 5));
+    b = vec_add16(bg_b, vec_srai16(vec_mullo16(b, mix5), 5));
+
+    return vec_or(vec_or(vec_slli16(r, 11), vec_slli16(g, 5)), b);
+}
+
+/**
+ * Mix RGB888 colors to RGB565 pixels like `lv_color_24_16_mix`
+ * @param fg_r      red channel of the foreground colors in 16 bit lanes
+ * @param fg_g      green channel of the foreground colors in 16 bit lanes
+ * @param fg_b      blue channel of the foreground colors in 16 bit lanes
+ * @param bg        the background colors
+ * @param mix       the mix ratios in 16 bit lanes
+ * @return          the mixed colors
+ */
+static inline vec_t mix_24_16(vec_t fg_r, vec_t fg_g, vec_t fg_b, vec_t bg, vec_t mix)
+{
+    vec_t mix_inv = vec_sub16(vec_set1_16(255), mix);
+    fg_r = vec_srli16(fg_r, 3);
+    fg_g = vec_srli16(fg_g, 2);
+    fg_b = vec_srli16(fg_b, 3);
+
+    vec_t r = vec_add16(vec_mullo16(fg_r, mix), vec_mullo16(vec_srli16(bg, 11), mix_inv));
+    vec_t g = vec_add16(vec_mullo16(fg_g, mix), vec_mullo16(vec_and(vec_srli16(bg, 5), vec_set1_16(0x3F)), mix_inv));
+    vec_t b = vec_add16(vec_mullo16(fg_b, mix), vec_mullo16(vec_and(bg, vec_set1_16(0x1F)), mix_inv));
+    vec_t res = vec_or(vec_or(vec_slli16(vec_srli16(r, 8), 11), vec_slli16(vec_srli16(g, 8), 5)), vec_srli16(b, 8));
+
+    vec_t fg = vec_or(vec_or(vec_slli16(fg_r, 11), vec_slli16(fg_g, 5)), fg_b);
+    res = vec_select(vec_cmpeq16(mix, vec_set1_16(255)), fg, res);
+    return vec_select(vec_cmpeq16(mix, vec_zero()), bg, res);
+}
+
+/**
+ * Mix the RGB channels of XRGB8888 pixels like `lv_color_24_24_mix`.
+ * The 4th byte of `bg` is kept.
+ * @param fg        the foreground colors
+ * @param bg        the background colors
+ * @param mix       the mix ratios in 32 bit lanes
+ * @return          the mixed colors
+ */
+static inline vec_t mix_24_24(vec_t fg, vec_t bg, vec_t mix)
+{
+    vec_t zero = vec_zero();
+    vec_t v255 = vec_set1_16(255);
+
+    /*Repeat the mix ratio for each channel*/
+    vec_t mix16 = vec_or(mix, vec_slli32(mix, 16));
+    vec_t mix_lo = vec_unpacklo32(mix16, mix16);
+    vec_t mix_hi = vec_unpackhi32(mix16, mix16);
+
+    vec_t res_lo = vec_add16(vec_mullo16(vec_unpacklo8(fg, zero), mix_lo),
+                             vec_mullo16(vec_unpacklo8(bg, zero), vec_sub16(v255, mix_lo)));
+    vec_t res_hi = vec_add16(vec_mullo16(vec_unpackhi8(fg, zero), mix_hi),
+                             vec_mullo16(vec_unpackhi8(bg, zero), vec_sub16(v255, mix_hi)));
+    vec_t res = vec_packus16(vec_srli16(res_lo, 8), vec_srli16(res_hi, 8));
+
+    res = vec_select(vec_cmpgt32(mix, vec_set1_32(LV_OPA_MAX - 1)), fg, res);
+    res = vec_select(vec_set1_32(0x00FFFFFF), res, bg);
+    return vec_select(vec_cmpeq32(mix, zero), bg, res);
+}
+
+/**
+ * Mix ARGB8888 pixels like `lv_color_32_32_mix`. The alpha channel of `fg` is the mix ratio.
+ * @param fg        the foreground colors
+ * @param bg        the background colors
+ * @param res       store the result here
+ * @return          false: a pixel needs the division of the semi transparent on semi transparent case,
+ *                  use `mix_32_32_px` instead. `res` is not set.
+ */
+static inline bool mix_32_32(vec_t fg, vec_t bg, vec_t * res)
+{
+    vec_t fg_a = vec_srli32(fg, 24);
+    vec_t bg_a = vec_srli32(bg, 24);
+
+    vec_t use_fg = vec_or(vec_cmpgt32(fg_a, vec_set1_32(LV_OPA_MAX - 1)),
+                          vec_cmpgt32(vec_set1_32(LV_OPA_MIN + 1), bg_a));
+    vec_t use_bg = vec_cmpgt32(vec_set1_32(LV_OPA_MIN + 1), fg_a);
+    vec_t opaque_bg = vec_cmpeq32(bg_a, vec_set1_32(0xFF));
+
+    if(vec_movemask8(vec_or(vec_or(use_fg, use_bg), opaque_bg)) != MOVEMASK_ALL) return false;
+
+    /*With opaque background the result is opaque too, so the alpha of `bg` can be kept*/
+    vec_t r = mix_24_24(fg, bg, fg_a);
+    r = vec_select(use_bg, bg, r);
+    *res = vec_select(use_fg, fg, r);
+    return true;
+}
+
+static inline uint16_t mix_24_16_px(const uint8_t * c1, uint16_t c2, uint8_t mix)
+{
+    if(mix == 0) {
+        return c2;
+    }
+    else if(mix == 255) {
+        return ((c1[2] & 0xF8) << 8)  + ((c1[1] & 0xFC) << 3) + ((c1[0] & 0xF8) >> 3);
+    }
+    else {
+        lv_opa_t mix_inv = 255 - mix;
+
+        return ((((c1[2] >> 3) * mix + ((c2 >> 11) & 0x1F) * mix_inv) << 3) & 0xF800) +
+               ((((c1[1] >> 2) * mix + ((c2 >> 5) & 0x3F) * mix_inv) >> 3) & 0x07E0) +
+               (((c1[0] >> 3) * mix + (c2 & 0x1F) * mix_inv) >> 8);
+    }
+}
+
+static inline void mix_24_24_px(const uint8_t * src, uint8_t * dest, uint8_t mix)
+{
+    if(mix == 0) return;
+
+    if(mix >= LV_OPA_MAX) {
+        dest[0] = src[0];
+        dest[1] = src[1];
+        dest[2] = src[2];
+    }
+    else {
+        lv_opa_t mix_inv = 255 - mix;
+        dest[0] = (uint32_t)((uint32_t)src[0] * mix + dest[0] * mix_inv) >> 8;
+        dest[1] = (uint32_t)((uint32_t)src[1] * mix + dest[1] * mix_inv) >> 8;
+        dest[2] = (uint32_t)((uint32_t)src[2] * mix + dest[2] * mix_inv) >> 8;
+    }
+}
+
+static inline lv_color32_t mix_32_32_px(lv_color32_t fg, lv_color32_t bg)
+{
+    if(fg.alpha >= LV_OPA_MAX || bg.alpha <= LV_OPA_MIN) {
+        return fg;
+    }
+    else if(fg.alpha <= LV_OPA_MIN) {
+        return bg;
+    }
+    else if(bg.alpha == 255) {
+        return lv_color_mix32(fg, bg);
+    }
+    else {
+        /*https://en.wikipedia.org/wiki/Alpha_compositing#Analytical_derivation_of_the_over_operator*/
+        lv_opa_t res_alpha = 255 - LV_OPA_MIX2(255 - fg.alpha, 255 - bg.alpha);
+        fg.alpha = (uint32_t)((uint32_t)fg.alpha * 255) / res_alpha;
+        lv_color32_t res = lv_color_mix32(fg, bg);
+        res.alpha = res_alpha;
+        return res;
+    }
+}
+
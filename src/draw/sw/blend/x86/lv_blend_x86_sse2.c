@@ -0,0 +1,25 @@
+/**
+ * @file lv_blend_x86_sse2.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_blend_x86.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+
+#include "../../../../misc/lv_color.h"
+#include "../../../../misc/lv_color_op.h"
+#include "../../../../stdlib/lv_string.h"
+
+#include <emmintrin.h>
+
+#define LV_BLEND_X86_AVX2           0
+#define LV_BLEND_X86_INIT_KERNELS   _lv_blend_x86_init_kernels_sse2
+
+#include "lv_blend_x86_impl.h"
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86*/
@@ -34,6 +34,9 @@
  *********************/
 #define DRAW_UNIT_ID_SW     1
 
+/*Rotate by 90 and 270 degrees in tiles of this many pixels to keep the read and written lines in the cache*/
+#define ROTATE_TILE_SIZE    16
+
 #ifndef LV_DRAW_SW_RGB565_SWAP
     #define LV_DRAW_SW_RGB565_SWAP(...) LV_RESULT_INVALID
 #endif
@@ -74,6 +77,12 @@
     #define LV_DRAW_SW_ROTATE270_RGB565(...) LV_RESULT_INVALID
 #endif
 
+/*Alignment of the allocations in the scratch buffers*/
+#define SCRATCH_ALIGN           8
+
+/*The scratch buffers are enlarged in steps of this many bytes*/
+#define SCRATCH_GROW_STEP       256
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -88,8 +97,16 @@
 static void execute_drawing(lv_draw_sw_unit_t * u);
 
 static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer);
+#if LV_USE_OS && LV_DRAW_SW_DRAW_UNIT_CNT > 1 && LV_DRAW_SW_STRIPE_MIN_SIZE
+    static bool open_shared_image(lv_draw_task_t * t, lv_image_decoder_dsc_t * decoder_dsc);
+    static bool split_task(lv_draw_sw_unit_t * lead_unit, lv_layer_t * layer, lv_draw_task_t * t);
+#endif
 static int32_t evaluate(lv_draw_unit_t * draw_unit, lv_draw_task_t * task);
 static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit);
+static lv_draw_sw_scratch_t * get_scratch(lv_draw_unit_t * draw_unit);
+#if LV_DRAW_SW_SCRATCH_MAX_SIZE
+    static void scratch_grow(lv_draw_sw_scratch_t * scratch);
+#endif
 
 static void rotate90_argb8888(const uint32_t * src, uint32_t * dst, int32_t srcWidth, int32_t srcHeight,
                               int32_t srcStride,
@@ -113,11 +130,22 @@ static void rotate180_rgb565(const uint16_t * src, uint16_t * dst, int32_t width
 static void rotate270_rgb565(const uint16_t * src, uint16_t * dst, int32_t srcWidth, int32_t srcHeight,
                              int32_t srcStride,
                              int32_t dstStride);
+static void rotate90_l8(const uint8_t * src, uint8_t * dst, int32_t width, int32_t height, int32_t src_stride,
+                        int32_t dest_stride);
+static void rotate180_l8(const uint8_t * src, uint8_t * dst, int32_t width, int32_t height, int32_t src_stride,
+                         int32_t dest_stride);
+static void rotate270_l8(const uint8_t * src, uint8_t * dst, int32_t width, int32_t height, int32_t src_stride,
+                         int32_t dest_stride);
+static inline void rotate_tiled(const uint8_t * src, uint8_t * dst, int32_t width, int32_t height, int32_t src_stride,
+                                int32_t dest_stride, uint32_t px_size, bool ccw);
+static inline void rotate_column(const uint8_t * src, uint8_t * dst, int32_t len, int32_t src_stride,
+                                 int32_t dest_step, uint32_t px_size);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 #define _draw_info LV_GLOBAL_DEFAULT()->draw_info
+#define scratch_monitor LV_GLOBAL_DEFAULT()->draw_sw_scratch_monitor
 
 /**********************
  *      MACROS
@@ -129,9 +157,14 @@ static void rotate270_rgb565(const uint16_t * src, uint16_t * dst, int32_t srcWi
 
 void lv_draw_sw_init(void)
 {
+    lv_draw_sw_kernels_init();
+    lv_gradient_cache_init(LV_DRAW_SW_GRADIENT_CACHE_SIZE);
 
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_init();
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    lv_draw_sw_shadow_cache_init();
+#endif
 #endif
 
     uint32_t i;
@@ -140,9 +173,10 @@ void lv_draw_sw_init(void)
         draw_sw_unit->base_unit.dispatch_cb = dispatch;
         draw_sw_unit->base_unit.evaluate_cb = evaluate;
         draw_sw_unit->idx = i;
-        draw_sw_unit->base_unit.delete_cb = LV_USE_OS ? lv_draw_sw_delete : NULL;
+        draw_sw_unit->base_unit.delete_cb = lv_draw_sw_delete;
 
 #if LV_USE_OS
+        lv_mutex_init(&draw_sw_unit->stripe_mutex);
         lv_thread_init(&draw_sw_unit->thread, LV_THREAD_PRIO_HIGH, render_thread_cb, LV_DRAW_THREAD_STACK_SIZE, draw_sw_unit);
 #endif
     }
@@ -160,14 +194,129 @@ void lv_draw_sw_deinit(void)
 
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_deinit();
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    lv_draw_sw_shadow_cache_deinit();
+#endif
+#endif
+
+    lv_gradient_cache_deinit();
+}
+
+void * lv_draw_sw_scratch_alloc(lv_draw_unit_t * draw_unit, size_t size)
+{
+    lv_draw_sw_scratch_t * scratch = get_scratch(draw_unit);
+    if(scratch == NULL) return lv_malloc(size);
+
+    lv_draw_sw_scratch_monitor_t * mon = &scratch_monitor;
+    size = (size + SCRATCH_ALIGN - 1) & ~(size_t)(SCRATCH_ALIGN - 1);
+    scratch->required += size;
+    if(scratch->required > scratch->max_required) scratch->max_required = scratch->required;
+    if(scratch->required > mon->max_required) mon->max_required = scratch->required;
+
+#if LV_DRAW_SW_SCRATCH_MAX_SIZE
+    /*The buffer can be reallocated only if nothing is allocated from it*/
+    if(scratch->used == 0 && scratch->size < scratch->max_required) scratch_grow(scratch);
+
+    if(scratch->buf && scratch->used + size <= scratch->size) {
+        void * p = scratch->buf + scratch->used;
+        scratch->used += size;
+        if(scratch->used > mon->max_used) mon->max_used = scratch->used;
+        return p;
+    }
+
+    mon->fallback_cnt++;
 #endif
+
+    /*Remember the size of the heap allocation to subtract it from `required` when it's freed*/
+    uint8_t * p = lv_malloc(size + SCRATCH_ALIGN);
+    if(p == NULL) {
+        scratch->required -= size;
+        return NULL;
+    }
+
+    *(uint32_t *)p = size;
+    return p + SCRATCH_ALIGN;
+}
+
+void lv_draw_sw_scratch_free(lv_draw_unit_t * draw_unit, void * data)
+{
+    if(data == NULL) return;
+
+    lv_draw_sw_scratch_t * scratch = get_scratch(draw_unit);
+    if(scratch == NULL) {
+        lv_free(data);
+        return;
+    }
+
+    uint8_t * p = data;
+    if(scratch->buf && p >= scratch->buf && p < scratch->buf + scratch->size) {
+        /*The buffers allocated after `data` are released too*/
+        uint32_t offset = p - scratch->buf;
+        if(offset < scratch->used) {
+            scratch->required -= scratch->used - offset;
+            scratch->used = offset;
+        }
+        return;
+    }
+
+    p -= SCRATCH_ALIGN;
+    uint32_t size = *(uint32_t *)p;
+    scratch->required = scratch->required > size ? scratch->required - size : 0;
+    lv_free(p);
+}
+
+void lv_draw_sw_scratch_monitor(lv_draw_sw_scratch_monitor_t * mon_p)
+{
+    *mon_p = scratch_monitor;
+}
+
+void lv_draw_sw_scratch_monitor_reset(void)
+{
+    uint32_t size = scratch_monitor.size;
+    lv_memzero(&scratch_monitor, sizeof(lv_draw_sw_scratch_monitor_t));
+    scratch_monitor.size = size;
+}
+
+#if LV_USE_DRAW_MONITOR
+void lv_draw_sw_blend_monitor(lv_draw_sw_blend_monitor_t * mon_p)
+{
+    lv_memzero(mon_p, sizeof(lv_draw_sw_blend_monitor_t));
+
+    lv_draw_unit_t * u = _draw_info.unit_head;
+    while(u) {
+        lv_draw_sw_blend_monitor_t * mon = _lv_draw_sw_get_blend_monitor(u);
+        if(mon) {
+            mon_p->fill_px_cnt += mon->fill_px_cnt;
+            mon_p->image_px_cnt += mon->image_px_cnt;
+            mon_p->call_cnt += mon->call_cnt;
+        }
+        u = u->next;
+    }
+}
+
+void lv_draw_sw_blend_monitor_reset(void)
+{
+    lv_draw_unit_t * u = _draw_info.unit_head;
+    while(u) {
+        lv_draw_sw_blend_monitor_t * mon = _lv_draw_sw_get_blend_monitor(u);
+        if(mon) lv_memzero(mon, sizeof(lv_draw_sw_blend_monitor_t));
+        u = u->next;
+    }
 }
 
+lv_draw_sw_blend_monitor_t * _lv_draw_sw_get_blend_monitor(lv_draw_unit_t * draw_unit)
+{
+    if(draw_unit == NULL || draw_unit->dispatch_cb != dispatch) return NULL;
+    return &((lv_draw_sw_unit_t *)draw_unit)->blend_monitor;
+}
+#endif
+
 static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
 {
-#if LV_USE_OS
     lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *) draw_unit;
+    int32_t res = 0;
 
+#if LV_USE_OS
     LV_LOG_INFO("cancel software rendering thread");
     draw_sw_unit->exit_status = true;
 
@@ -175,15 +324,20 @@ static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
         lv_thread_sync_signal(&draw_sw_unit->sync);
     }
 
-    return lv_thread_delete(&draw_sw_unit->thread);
-#else
-    LV_UNUSED(draw_unit);
-    return 0;
+    res = lv_thread_delete(&draw_sw_unit->thread);
+    lv_mutex_delete(&draw_sw_unit->stripe_mutex);
 #endif
+
+    scratch_monitor.size -= draw_sw_unit->scratch.size;
+    lv_free(draw_sw_unit->scratch.buf);
+    lv_memzero(&draw_sw_unit->scratch, sizeof(lv_draw_sw_scratch_t));
+
+    return res;
 }
 
 void lv_draw_sw_rgb565_swap(void * buf, uint32_t buf_size_px)
 {
+    if(LV_DRAW_SW_KERNEL(rgb565_swap, buf, buf_size_px) == LV_RESULT_OK) return;
     if(LV_DRAW_SW_RGB565_SWAP(buf, buf_size_px) == LV_RESULT_OK) return;
 
     uint32_t u32_cnt = buf_size_px / 2;
@@ -220,17 +374,25 @@ void lv_draw_sw_rotate(const void * src, void * dest, int32_t src_width, int32_t
                        int32_t dest_stride, lv_display_rotation_t rotation, lv_color_format_t color_format)
 {
     uint32_t px_bpp = lv_color_format_get_bpp(color_format);
+    if(LV_DRAW_SW_KERNEL(rotate, src, dest, src_width, src_height, src_sride, dest_stride, rotation,
+                         px_bpp / 8) == LV_RESULT_OK) {
+        return;
+    }
+
     if(rotation == LV_DISPLAY_ROTATION_90) {
+        if(px_bpp == 8) rotate90_l8(src, dest, src_width, src_height, src_sride, dest_stride);
         if(px_bpp == 16) rotate90_rgb565(src, dest, src_width, src_height, src_sride, dest_stride);
         if(px_bpp == 24) rotate90_rgb888(src, dest, src_width, src_height, src_sride, dest_stride);
         if(px_bpp == 32) rotate90_argb8888(src, dest, src_width, src_height, src_sride, dest_stride);
     }
     else if(rotation == LV_DISPLAY_ROTATION_180) {
+        if(px_bpp == 8) rotate180_l8(src, dest, src_width, src_height, src_sride, dest_stride);
         if(px_bpp == 16) rotate180_rgb565(src, dest, src_width, src_height, src_sride, dest_stride);
         if(px_bpp == 24) rotate180_rgb888(src, dest, src_width, src_height, src_sride, dest_stride);
         if(px_bpp == 32) rotate180_argb8888(src, dest, src_width, src_height, src_sride, dest_stride);
     }
     else if(rotation == LV_DISPLAY_ROTATION_270) {
+        if(px_bpp == 8) rotate270_l8(src, dest, src_width, src_height, src_sride, dest_stride);
         if(px_bpp == 16) rotate270_rgb565(src, dest, src_width, src_height, src_sride, dest_stride);
         if(px_bpp == 24) rotate270_rgb888(src, dest, src_width, src_height, src_sride, dest_stride);
         if(px_bpp == 32) rotate270_argb8888(src, dest, src_width, src_height, src_sride, dest_stride);
@@ -244,7 +406,33 @@ static inline void execute_drawing_unit(lv_draw_sw_unit_t * u)
 {
     execute_drawing(u);
 
+    /*All the temporary buffers of the task are released*/
+    u->scratch.used = 0;
+    u->scratch.required = 0;
+
+#if LV_USE_OS && LV_DRAW_SW_DRAW_UNIT_CNT > 1 && LV_DRAW_SW_STRIPE_MIN_SIZE
+    lv_draw_sw_unit_t * lead_unit = u->stripe_lead;
+    if(lead_unit) {
+        /*The task is ready only when its last stripe is finished.
+         *Close the shared image before the lead unit can be split again*/
+        lv_mutex_lock(&lead_unit->stripe_mutex);
+        lead_unit->stripe_cnt--;
+        bool last = lead_unit->stripe_cnt == 0;
+        if(last && lead_unit->stripe_decoder_opened) {
+            lv_image_decoder_close(&lead_unit->stripe_decoder_dsc);
+            lead_unit->stripe_decoder_opened = false;
+        }
+        lv_mutex_unlock(&lead_unit->stripe_mutex);
+
+        u->stripe_lead = NULL;
+        if(last) u->task_act->state = LV_DRAW_TASK_STATE_READY;
+    }
+    else {
+        u->task_act->state = LV_DRAW_TASK_STATE_READY;
+    }
+#else
     u->task_act->state = LV_DRAW_TASK_STATE_READY;
+#endif
     u->task_act = NULL;
 
     /*The draw unit is free now. Request a new dispatching as it can get a new task*/
@@ -313,6 +501,13 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
         return -1;
     }
 
+#if LV_USE_OS && LV_DRAW_SW_DRAW_UNIT_CNT > 1 && LV_DRAW_SW_STRIPE_MIN_SIZE
+    if(split_task(draw_sw_unit, layer, t)) {
+        LV_PROFILER_END;
+        return 1;
+    }
+#endif
+
     t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
     draw_sw_unit->base_unit.target_layer = layer;
     draw_sw_unit->base_unit.clip_area = &t->clip_area;
@@ -328,6 +523,121 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
     return 1;
 }
 
+#if LV_USE_OS && LV_DRAW_SW_DRAW_UNIT_CNT > 1 && LV_DRAW_SW_STRIPE_MIN_SIZE
+/**
+ * Open the image of an image or layer task once so that the stripes can share the decoded image
+ * instead of decoding it on each draw unit in parallel.
+ * @param t             an image or layer task
+ * @param decoder_dsc   store the opened decoder descriptor here. Close it when all the stripes are ready.
+ * @return              true: the stripes can use the decoded image; false: don't split the task
+ */
+static bool open_shared_image(lv_draw_task_t * t, lv_image_decoder_dsc_t * decoder_dsc)
+{
+    lv_draw_image_dsc_t * draw_dsc = t->draw_dsc;
+    const void * src = draw_dsc->src;
+    if(t->type == LV_DRAW_TASK_TYPE_LAYER) {
+        lv_layer_t * layer_to_draw = (lv_layer_t *)draw_dsc->src;
+        src = layer_to_draw->draw_buf;
+        if(src == NULL) return false;
+    }
+
+    if(lv_image_decoder_open(decoder_dsc, src, NULL) != LV_RESULT_OK) return false;
+
+    /*The decoded image is either in the cache (kept there while it's opened)
+     *or it's the variable image itself. Else each unit would decode it again.*/
+    if(decoder_dsc->cache_entry) return true;
+    if(decoder_dsc->src_type == LV_IMAGE_SRC_VARIABLE && decoder_dsc->decoded &&
+       decoder_dsc->decoded->data == ((const lv_image_dsc_t *)src)->data) return true;
+
+    lv_image_decoder_close(decoder_dsc);
+    return false;
+}
+
+/**
+ * Split a large task into horizontal stripes and assign them to the idle SW draw units.
+ * The units render their stripe in parallel by using only a part of the task's clip area.
+ * @param lead_unit     the unit which has taken the task
+ * @param layer         the layer of the task
+ * @param t             the task to split
+ * @return              true: the task was split and assigned to the units;
+ *                      false: the task should be rendered by `lead_unit` alone
+ */
+static bool split_task(lv_draw_sw_unit_t * lead_unit, lv_layer_t * layer, lv_draw_task_t * t)
+{
+    if(t->type != LV_DRAW_TASK_TYPE_FILL && t->type != LV_DRAW_TASK_TYPE_BOX_SHADOW &&
+       t->type != LV_DRAW_TASK_TYPE_IMAGE && t->type != LV_DRAW_TASK_TYPE_LAYER) {
+        return false;
+    }
+
+#if LV_DRAW_SW_COMPLEX
+    /*Each stripe would calculate the whole blurred corner again, unless it's shared via the cache*/
+    if(t->type == LV_DRAW_TASK_TYPE_BOX_SHADOW && !lv_draw_sw_box_shadow_is_cached(t->draw_dsc, &t->area)) return false;
+#else
+    if(t->type == LV_DRAW_TASK_TYPE_BOX_SHADOW) return false;
+#endif
+
+    /*The stripes of the last split task are still being rendered*/
+    lv_mutex_lock(&lead_unit->stripe_mutex);
+    uint32_t stripe_cnt = lead_unit->stripe_cnt;
+    lv_mutex_unlock(&lead_unit->stripe_mutex);
+    if(stripe_cnt) return false;
+
+    lv_area_t draw_area;
+    if(!_lv_area_intersect(&draw_area, &t->_real_area, &t->clip_area)) return false;
+
+    int32_t h = lv_area_get_height(&draw_area);
+    uint32_t stripe_max = lv_area_get_size(&draw_area) / LV_DRAW_SW_STRIPE_MIN_SIZE;
+    if(stripe_max > (uint32_t)h) stripe_max = h;
+    if(stripe_max < 2) return false;
+
+    /*Collect the idle SW draw units*/
+    lv_draw_sw_unit_t * units[LV_DRAW_SW_DRAW_UNIT_CNT];
+    uint32_t unit_cnt = 0;
+    units[unit_cnt++] = lead_unit;
+    lv_draw_unit_t * u = _draw_info.unit_head;
+    while(u && unit_cnt < LV_DRAW_SW_DRAW_UNIT_CNT && unit_cnt < stripe_max) {
+        lv_draw_sw_unit_t * sw_unit = (lv_draw_sw_unit_t *)u;
+        if(u != (lv_draw_unit_t *)lead_unit && u->dispatch_cb == dispatch &&
+           sw_unit->task_act == NULL && sw_unit->stripe_lead == NULL && sw_unit->inited) {
+            units[unit_cnt++] = sw_unit;
+        }
+        u = u->next;
+    }
+
+    if(unit_cnt < 2) return false;
+
+    lead_unit->stripe_decoder_opened = false;
+    if(t->type == LV_DRAW_TASK_TYPE_IMAGE || t->type == LV_DRAW_TASK_TYPE_LAYER) {
+        if(!open_shared_image(t, &lead_unit->stripe_decoder_dsc)) return false;
+        lead_unit->stripe_decoder_opened = true;
+    }
+
+    t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+    lv_mutex_lock(&lead_unit->stripe_mutex);
+    lead_unit->stripe_cnt = unit_cnt;
+    lv_mutex_unlock(&lead_unit->stripe_mutex);
+
+    uint32_t i;
+    for(i = 0; i < unit_cnt; i++) {
+        lv_draw_sw_unit_t * sw_unit = units[i];
+        sw_unit->stripe_clip_area = t->clip_area;
+        sw_unit->stripe_clip_area.y1 = draw_area.y1 + (int32_t)((h * i) / unit_cnt);
+        sw_unit->stripe_clip_area.y2 = draw_area.y1 + (int32_t)((h * (i + 1)) / unit_cnt) - 1;
+        sw_unit->stripe_lead = lead_unit;
+        sw_unit->base_unit.target_layer = layer;
+        sw_unit->base_unit.clip_area = &sw_unit->stripe_clip_area;
+        sw_unit->task_act = t;
+    }
+
+    /*Let the render threads work*/
+    for(i = 0; i < unit_cnt; i++) {
+        lv_thread_sync_signal(&units[i]->sync);
+    }
+
+    return true;
+}
+#endif
+
 #if LV_USE_OS
 static void render_thread_cb(void * ptr)
 {
@@ -457,31 +767,22 @@ static void rotate270_argb8888(const uint32_t * src, uint32_t * dst, int32_t src
         return ;
     }
 
-    srcStride /= sizeof(uint32_t);
-    dstStride /= sizeof(uint32_t);
-
-    for(int32_t x = 0; x < srcWidth; ++x) {
-        int32_t dstIndex = x * dstStride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < srcHeight; ++y) {
-            dst[dstIndex + (srcHeight - y - 1)] = src[srcIndex];
-            srcIndex += srcStride;
-        }
-    }
+    rotate_tiled((const uint8_t *)src, (uint8_t *)dst, srcWidth, srcHeight, srcStride, dstStride, sizeof(uint32_t),
+                 false);
 }
 
 static void rotate180_argb8888(const uint32_t * src, uint32_t * dst, int32_t width, int32_t height, int32_t src_stride,
                                int32_t dest_stride)
 {
-    LV_UNUSED(dest_stride);
     if(LV_RESULT_OK == LV_DRAW_SW_ROTATE180_ARGB8888(src, dst, srcWidth, srcHeight, srcStride, dstStride)) {
         return ;
     }
 
     src_stride /= sizeof(uint32_t);
+    dest_stride /= sizeof(uint32_t);
 
     for(int32_t y = 0; y < height; ++y) {
-        int32_t dstIndex = (height - y - 1) * src_stride;
+        int32_t dstIndex = (height - y - 1) * dest_stride;
         int32_t srcIndex = y * src_stride;
         for(int32_t x = 0; x < width; ++x) {
             dst[dstIndex + width - x - 1] = src[srcIndex + x];
@@ -497,17 +798,8 @@ static void rotate90_argb8888(const uint32_t * src, uint32_t * dst, int32_t srcW
         return ;
     }
 
-    srcStride /= sizeof(uint32_t);
-    dstStride /= sizeof(uint32_t);
-
-    for(int32_t x = 0; x < srcWidth; ++x) {
-        int32_t dstIndex = (srcWidth - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < srcHeight; ++y) {
-            dst[dstIndex * dstStride + y] = src[srcIndex];
-            srcIndex += srcStride;
-        }
-    }
+    rotate_tiled((const uint8_t *)src, (uint8_t *)dst, srcWidth, srcHeight, srcStride, dstStride, sizeof(uint32_t),
+                 true);
 }
 
 static void rotate270_rgb888(const uint8_t * src, uint8_t * dst, int32_t srcWidth, int32_t srcHeight, int32_t srcStride,
@@ -517,15 +809,7 @@ static void rotate270_rgb888(const uint8_t * src, uint8_t * dst, int32_t srcWidt
         return ;
     }
 
-    for(int32_t x = 0; x < srcWidth; ++x) {
-        for(int32_t y = 0; y < srcHeight; ++y) {
-            int32_t srcIndex = y * srcStride + x * 3;
-            int32_t dstIndex = (srcWidth - x - 1) * dstStride + y * 3;
-            dst[dstIndex] = src[srcIndex];       /*Red*/
-            dst[dstIndex + 1] = src[srcIndex + 1]; /*Green*/
-            dst[dstIndex + 2] = src[srcIndex + 2]; /*Blue*/
-        }
-    }
+    rotate_tiled(src, dst, srcWidth, srcHeight, srcStride, dstStride, 3, true);
 }
 
 static void rotate180_rgb888(const uint8_t * src, uint8_t * dst, int32_t width, int32_t height, int32_t src_stride,
@@ -553,15 +837,7 @@ static void rotate90_rgb888(const uint8_t * src, uint8_t * dst, int32_t width, i
         return ;
     }
 
-    for(int32_t x = 0; x < width; ++x) {
-        for(int32_t y = 0; y < height; ++y) {
-            int32_t srcIndex = y * srcStride + x * 3;
-            int32_t dstIndex = x * dstStride + (height - y - 1) * 3;
-            dst[dstIndex] = src[srcIndex];       /*Red*/
-            dst[dstIndex + 1] = src[srcIndex + 1]; /*Green*/
-            dst[dstIndex + 2] = src[srcIndex + 2]; /*Blue*/
-        }
-    }
+    rotate_tiled(src, dst, width, height, srcStride, dstStride, 3, false);
 }
 
 static void rotate270_rgb565(const uint16_t * src, uint16_t * dst, int32_t srcWidth, int32_t srcHeight,
@@ -572,17 +848,8 @@ static void rotate270_rgb565(const uint16_t * src, uint16_t * dst, int32_t srcWi
         return ;
     }
 
-    srcStride /= sizeof(uint16_t);
-    dstStride /= sizeof(uint16_t);
-
-    for(int32_t x = 0; x < srcWidth; ++x) {
-        int32_t dstIndex = x * dstStride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < srcHeight; ++y) {
-            dst[dstIndex + (srcHeight - y - 1)] = src[srcIndex];
-            srcIndex += srcStride;
-        }
-    }
+    rotate_tiled((const uint8_t *)src, (uint8_t *)dst, srcWidth, srcHeight, srcStride, dstStride, sizeof(uint16_t),
+                 false);
 }
 
 static void rotate180_rgb565(const uint16_t * src, uint16_t * dst, int32_t width, int32_t height, int32_t src_stride,
@@ -612,17 +879,137 @@ static void rotate90_rgb565(const uint16_t * src, uint16_t * dst, int32_t srcWid
         return ;
     }
 
-    srcStride /= sizeof(uint16_t);
-    dstStride /= sizeof(uint16_t);
+    rotate_tiled((const uint8_t *)src, (uint8_t *)dst, srcWidth, srcHeight, srcStride, dstStride, sizeof(uint16_t),
+                 true);
+}
+
+static void rotate270_l8(const uint8_t * src, uint8_t * dst, int32_t width, int32_t height, int32_t src_stride,
+                         int32_t dest_stride)
+{
+    rotate_tiled(src, dst, width, height, src_stride, dest_stride, 1, false);
+}
+
+static void rotate180_l8(const uint8_t * src, uint8_t * dst, int32_t width, int32_t height, int32_t src_stride,
+                         int32_t dest_stride)
+{
+    for(int32_t y = 0; y < height; ++y) {
+        int32_t dstIndex = (height - y - 1) * dest_stride;
+        int32_t srcIndex = y * src_stride;
+        for(int32_t x = 0; x < width; ++x) {
+            dst[dstIndex + width - x - 1] = src[srcIndex + x];
+        }
+    }
+}
+
+static void rotate90_l8(const uint8_t * src, uint8_t * dst, int32_t width, int32_t height, int32_t src_stride,
+                        int32_t dest_stride)
+{
+    rotate_tiled(src, dst, width, height, src_stride, dest_stride, 1, true);
+}
+
+/**
+ * Rotate by 90 or 270 degrees. The pixels are processed in `ROTATE_TILE_SIZE` x `ROTATE_TILE_SIZE` tiles because
+ * walking along the source rows would write the destination columns with a cache miss for each pixel.
+ * @param src           pointer to the source buffer
+ * @param dst           pointer to the destination buffer
+ * @param width         width of the source in pixels
+ * @param height        height of the source in pixels
+ * @param src_stride    stride of the source in bytes
+ * @param dest_stride   stride of the destination in bytes
+ * @param px_size       size of a pixel in bytes: 1, 2, 3 or 4
+ * @param ccw           true: `(x, y)` goes to `(y, width - 1 - x)`, false: it goes to `(height - 1 - y, x)`
+ */
+static inline void rotate_tiled(const uint8_t * src, uint8_t * dst, int32_t width, int32_t height, int32_t src_stride,
+                                int32_t dest_stride, uint32_t px_size, bool ccw)
+{
+    int32_t tx;
+    int32_t ty;
+    for(ty = 0; ty < height; ty += ROTATE_TILE_SIZE) {
+        int32_t tile_h = LV_MIN(ROTATE_TILE_SIZE, height - ty);
+        for(tx = 0; tx < width; tx += ROTATE_TILE_SIZE) {
+            int32_t x_end = LV_MIN(tx + ROTATE_TILE_SIZE, width);
+            int32_t x;
+            for(x = tx; x < x_end; x++) {
+                /*A column of the tile in the source is a part of a row in the destination*/
+                const uint8_t * s = src + ty * src_stride + x * px_size;
+                uint8_t * d;
+                int32_t d_step;
+                if(ccw) {
+                    d = dst + (width - 1 - x) * dest_stride + ty * px_size;
+                    d_step = px_size;
+                }
+                else {
+                    d = dst + x * dest_stride + (height - 1 - ty) * px_size;
+                    d_step = -(int32_t)px_size;
+                }
 
-    for(int32_t x = 0; x < srcWidth; ++x) {
-        int32_t dstIndex = (srcWidth - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < srcHeight; ++y) {
-            dst[dstIndex * dstStride + y] = src[srcIndex];
-            srcIndex += srcStride;
+                /*With a constant length the compiler can unroll and vectorize the loop*/
+                if(tile_h == ROTATE_TILE_SIZE) rotate_column(s, d, ROTATE_TILE_SIZE, src_stride, d_step, px_size);
+                else rotate_column(s, d, tile_h, src_stride, d_step, px_size);
+            }
+        }
+    }
+}
+
+/**
+ * Copy a column of pixels to a row
+ * @param src           pointer to the first pixel of the column
+ * @param dst           pointer to the destination of the first pixel
+ * @param len           number of pixels to copy
+ * @param src_stride    stride of the source in bytes
+ * @param dest_step     distance of the destination pixels in bytes, negative to write them backwards
+ * @param px_size       size of a pixel in bytes: 1, 2, 3 or 4
+ */
+static inline void rotate_column(const uint8_t * src, uint8_t * dst, int32_t len, int32_t src_stride,
+                                 int32_t dest_step, uint32_t px_size)
+{
+    int32_t i;
+    for(i = 0; i < len; i++) {
+        if(px_size == 4) *(uint32_t *)dst = *(const uint32_t *)src;
+        else if(px_size == 2) *(uint16_t *)dst = *(const uint16_t *)src;
+        else if(px_size == 1) *dst = *src;
+        else {
+            dst[0] = src[0];
+            dst[1] = src[1];
+            dst[2] = src[2];
         }
+        src += src_stride;
+        dst += dest_step;
     }
 }
 
+/**
+ * Get the scratch buffer of a draw unit
+ * @param draw_unit     pointer to a draw unit
+ * @return              the scratch buffer or NULL if `draw_unit` is not a SW draw unit
+ */
+static lv_draw_sw_scratch_t * get_scratch(lv_draw_unit_t * draw_unit)
+{
+    if(draw_unit == NULL || draw_unit->dispatch_cb != dispatch) return NULL;
+    return &((lv_draw_sw_unit_t *)draw_unit)->scratch;
+}
+
+#if LV_DRAW_SW_SCRATCH_MAX_SIZE
+/**
+ * Enlarge an unused scratch buffer to the most bytes required by a task, but not larger than the limit
+ * @param scratch       pointer to a scratch buffer with nothing allocated from it
+ */
+static void scratch_grow(lv_draw_sw_scratch_t * scratch)
+{
+    uint32_t new_size = (scratch->max_required + SCRATCH_GROW_STEP - 1) & ~(uint32_t)(SCRATCH_GROW_STEP - 1);
+    if(new_size > LV_DRAW_SW_SCRATCH_MAX_SIZE) new_size = LV_DRAW_SW_SCRATCH_MAX_SIZE;
+    if(new_size <= scratch->size) return;
+
+    /*Nothing needs to be kept so don't realloc*/
+    lv_free(scratch->buf);
+    scratch->buf = lv_malloc(new_size);
+    LV_ASSERT_MALLOC(scratch->buf);
+
+    scratch_monitor.size -= scratch->size;
+    scratch->size = scratch->buf ? new_size : 0;
+    scratch_monitor.size += scratch->size;
+    scratch_monitor.grow_cnt++;
+}
+#endif
+
 #endif /*LV_USE_DRAW_SW*/
@@ -32,25 +32,51 @@ extern "C" {
  **********************/
 
 typedef struct {
+    uint8_t * buf;          /**< Reused for the temporary buffers of the tasks, allocated on the first use*/
+    uint32_t size;          /**< The size of `buf`. Grows up to `LV_DRAW_SW_SCRATCH_MAX_SIZE`*/
+    uint32_t used;          /**< Number of bytes used in `buf`*/
+    uint32_t required;      /**< Number of bytes allocated by the current task, including the heap fallbacks*/
+    uint32_t max_required;  /**< The most bytes required by a task. `buf` is enlarged to this size when it's free*/
+} lv_draw_sw_scratch_t;
+
+typedef struct {
+    uint32_t size;          /**< Sum of the sizes of the draw units' scratch buffers*/
+    uint32_t max_used;      /**< The most bytes used in a scratch buffer*/
+    uint32_t max_required;  /**< The most bytes required by a draw task*/
+    uint32_t fallback_cnt;  /**< Number of allocations served by the heap as the scratch buffer was too small*/
+    uint32_t grow_cnt;      /**< Number of times a scratch buffer was enlarged*/
+} lv_draw_sw_scratch_monitor_t;
+
+typedef struct {
+    uint32_t fill_px_cnt;   /**< Number of pixels filled with a color*/
+    uint32_t image_px_cnt;  /**< Number of pixels blended from an image*/
+    uint32_t call_cnt;      /**< Number of `lv_draw_sw_blend()` calls blending at least one pixel*/
+} lv_draw_sw_blend_monitor_t;
+
+typedef struct _lv_draw_sw_unit_t {
     lv_draw_unit_t base_unit;
     lv_draw_task_t * task_act;
+    lv_draw_sw_scratch_t scratch;
+#if LV_USE_DRAW_MONITOR
+    lv_draw_sw_blend_monitor_t blend_monitor;  /**< Written only by this unit, summed by `lv_draw_sw_blend_monitor()`*/
+#endif
 #if LV_USE_OS
     lv_thread_sync_t sync;
     lv_thread_t thread;
     volatile bool inited;
     volatile bool exit_status;
+
+    /*Used when a large task is split into stripes and rendered by multiple units*/
+    lv_area_t stripe_clip_area;                 /**< The clip area of the stripe rendered by this unit*/
+    struct _lv_draw_sw_unit_t * stripe_lead;    /**< The unit which split the task*/
+    lv_mutex_t stripe_mutex;                    /**< Protects `stripe_cnt` of the lead unit*/
+    volatile uint32_t stripe_cnt;               /**< Number of not finished stripes of the task split by this unit*/
+    lv_image_decoder_dsc_t stripe_decoder_dsc;  /**< The image of the split task, decoded once for all stripes*/
+    bool stripe_decoder_opened;
 #endif
     uint32_t idx;
 } lv_draw_sw_unit_t;
 
-#if LV_DRAW_SW_SHADOW_CACHE_SIZE
-typedef struct {
-    uint8_t cache[LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE];
-    int32_t cache_size;
-    int32_t cache_r;
-} lv_draw_sw_shadow_cache_t;
-#endif
-
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -66,6 +92,61 @@ void lv_draw_sw_init(void);
  */
 void lv_draw_sw_deinit(void);
 
+/**
+ * Allocate a temporary buffer (e.g. a mask) needed only while the current draw task is rendered.
+ * The memory is taken from the scratch buffer of the draw unit to avoid a heap allocation for every task.
+ * If it doesn't fit or `draw_unit` is not a SW draw unit the heap is used.
+ * @param draw_unit     pointer to the draw unit rendering the task
+ * @param size          the size to allocate in bytes
+ * @return              pointer to the allocated memory or NULL on failure
+ */
+void * lv_draw_sw_scratch_alloc(lv_draw_unit_t * draw_unit, size_t size);
+
+/**
+ * Free a buffer allocated by `lv_draw_sw_scratch_alloc`.
+ * The scratch buffer works like a stack: freeing a buffer releases all buffers allocated after it too.
+ * All buffers are released when the draw task is finished.
+ * @param draw_unit     pointer to the draw unit used in `lv_draw_sw_scratch_alloc`
+ * @param data          pointer to the memory to free
+ */
+void lv_draw_sw_scratch_free(lv_draw_unit_t * draw_unit, void * data);
+
+/**
+ * Get statistics about the usage of the SW draw units' scratch buffers.
+ * Useful to find the optimal `LV_DRAW_SW_SCRATCH_MAX_SIZE`.
+ * @param mon_p         pointer to a `lv_draw_sw_scratch_monitor_t` variable to fill
+ * @note                The counters are updated without locking so they might be slightly inaccurate
+ *                      if LV_DRAW_SW_DRAW_UNIT_CNT > 1
+ */
+void lv_draw_sw_scratch_monitor(lv_draw_sw_scratch_monitor_t * mon_p);
+
+/**
+ * Reset the statistics of `lv_draw_sw_scratch_monitor()`. The size of the scratch buffers is kept.
+ */
+void lv_draw_sw_scratch_monitor_reset(void);
+
+#if LV_USE_DRAW_MONITOR
+/**
+ * Get the number of pixels blended by `lv_draw_sw_blend()` since the last reset.
+ * Each software draw unit counts its own blends and they are summed here,
+ * so call it when the rendering is finished to get consistent values.
+ * @param mon_p         pointer to a `lv_draw_sw_blend_monitor_t` variable to fill
+ */
+void lv_draw_sw_blend_monitor(lv_draw_sw_blend_monitor_t * mon_p);
+
+/**
+ * Reset the counters of `lv_draw_sw_blend_monitor()`
+ */
+void lv_draw_sw_blend_monitor_reset(void);
+
+/**
+ * Get the blend counters of a draw unit
+ * @param draw_unit     pointer to a draw unit
+ * @return              the counters or NULL if `draw_unit` is not a SW draw unit
+ */
+lv_draw_sw_blend_monitor_t * _lv_draw_sw_get_blend_monitor(lv_draw_unit_t * draw_unit);
+#endif
+
 /**
  * Fill an area using SW render. Handle gradient and radius.
  * @param draw_unit     pointer to a draw unit
@@ -82,6 +163,19 @@ void lv_draw_sw_fill(lv_draw_unit_t * draw_unit, const lv_draw_fill_dsc_t * dsc,
  */
 void lv_draw_sw_border(lv_draw_unit_t * draw_unit, const lv_draw_border_dsc_t * dsc, const lv_area_t * coords);
 
+#if LV_DRAW_SW_COMPLEX && LV_DRAW_SW_SHADOW_CACHE_SIZE
+/**
+ * Create the cache of the blurred shadow corners. Called by `lv_draw_sw_init()`.
+ * @return              LV_RESULT_OK: initialization succeeded, LV_RESULT_INVALID: failed.
+ */
+lv_result_t lv_draw_sw_shadow_cache_init(void);
+
+/**
+ * Delete the cache of the blurred shadow corners. Called by `lv_draw_sw_deinit()`.
+ */
+void lv_draw_sw_shadow_cache_deinit(void);
+#endif
+
 /**
  * Draw box shadow with SW render.
  * @param draw_unit     pointer to a draw unit
@@ -90,6 +184,14 @@ void lv_draw_sw_border(lv_draw_unit_t * draw_unit, const lv_draw_border_dsc_t *
  */
 void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords);
 
+/**
+ * Check if the blurred corner of a box shadow will be taken from the shadow cache.
+ * @param dsc           the draw descriptor
+ * @param coords        the coordinates of the rectangle for which the box shadow should be drawn
+ * @return              true: the corner is calculated only once and cached; false: it's calculated on each draw
+ */
+bool lv_draw_sw_box_shadow_is_cached(const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords);
+
 /**
  * Draw an image with SW render. It handles image decoding, tiling, transformations, and recoloring.
  * @param draw_unit     pointer to a draw unit
@@ -188,7 +290,7 @@ void lv_draw_sw_rgb565_swap(void * buf, uint32_t buf_size_px);
  * @param src_sride     source stride in bytes (number of bytes in a row)
  * @param dest_stride   destination stride in bytes (number of bytes in a row)
  * @param rotation      LV_DISPLAY_ROTATION_0/90/180/270
- * @param color_format  LV_COLOR_FORMAT_RGB565/RGB888/XRGB8888/ARGB8888
+ * @param color_format  LV_COLOR_FORMAT_L8/A8/I8/RGB565/RGB888/XRGB8888/ARGB8888
  */
 void lv_draw_sw_rotate(const void * src, void * dest, int32_t src_width, int32_t src_height, int32_t src_sride,
                        int32_t dest_stride, lv_display_rotation_t rotation, lv_color_format_t color_format);
@@ -202,6 +304,7 @@ void lv_draw_sw_rotate(const void * src, void * dest, int32_t src_width, int32_t
  **********************/
 
 #include "blend/lv_draw_sw_blend.h"
+#include "lv_draw_sw_kernels.h"
 
 #endif /*LV_USE_DRAW_SW*/
 
@@ -95,7 +95,7 @@ void draw_border_complex(lv_draw_unit_t * draw_unit, const lv_area_t * outer_are
 
     lv_draw_sw_blend_dsc_t blend_dsc;
     lv_memzero(&blend_dsc, sizeof(blend_dsc));
-    lv_opa_t * mask_buf = lv_malloc(draw_area_w);
+    lv_opa_t * mask_buf = lv_draw_sw_scratch_alloc(draw_unit, draw_area_w);
     blend_dsc.mask_buf = mask_buf;
 
     void * mask_list[3] = {0};
@@ -277,7 +277,7 @@ void draw_border_complex(lv_draw_unit_t * draw_unit, const lv_area_t * outer_are
 
     lv_draw_sw_mask_free_param(&mask_rin_param);
     if(rout > 0) lv_draw_sw_mask_free_param(&mask_rout_param);
-    lv_free(mask_buf);
+    lv_draw_sw_scratch_free(draw_unit, mask_buf);
 
 #endif /*LV_DRAW_SW_COMPLEX*/
 }
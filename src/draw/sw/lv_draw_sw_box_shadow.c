@@ -25,20 +25,53 @@
 #define SHADOW_UPSCALE_SHIFT    6
 #define SHADOW_ENHANCE          1
 
-#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    #define shadow_cache LV_GLOBAL_DEFAULT()->sw_shadow_cache
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    #define CACHE_NAME  "SW_SHADOW"
+    #define shadow_cache_p (LV_GLOBAL_DEFAULT()->sw_shadow_cache)
+
+    #if LV_DRAW_SW_SHADOW_CACHE_MEM_SIZE
+        #define SHADOW_CACHE_MEM_SIZE LV_DRAW_SW_SHADOW_CACHE_MEM_SIZE
+    #else
+        #define SHADOW_CACHE_MEM_SIZE (4 * LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE)
+    #endif
 #endif
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+typedef struct {
+    lv_cache_slot_size_t slot;  /**< Size of `buf`. Must be the first field*/
+    int32_t sw;                 /**< Key: shadow width*/
+    int32_t r;                  /**< Key: clamped radius*/
+    int32_t core_w;             /**< Key: width of the blurred rectangle, clamped to the size affecting the corner*/
+    int32_t core_h;             /**< Key: height of the blurred rectangle, clamped to the size affecting the corner*/
+    lv_opa_t * buf;             /**< The blurred corner: `(sw + r)^2` bytes*/
+} shadow_cache_data_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_draw_corner_buf(const lv_area_t * coords, uint16_t * sh_buf, int32_t s,
-                                                               int32_t r);
-static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf);
+static int32_t shadow_get_core_area(const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords,
+                                    lv_area_t * core_area);
+static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_draw_corner_buf(lv_draw_unit_t * draw_unit, const lv_area_t * coords,
+                                                               uint16_t * sh_buf, int32_t s, int32_t r);
+#if LV_DRAW_SW_SHADOW_BLUR_PASSES == 0
+static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(lv_draw_unit_t * draw_unit, int32_t size, int32_t sw,
+                                                           uint16_t * sh_ups_buf);
+#else
+static void shadow_box_blur_corner(lv_draw_unit_t * draw_unit, int32_t size, int32_t sw, uint16_t * sh_ups_buf);
+static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_box_blur_cols(const uint16_t * src, uint16_t * dest, uint32_t * sum,
+                                                             int32_t size, int32_t len, bool flip);
+static void shadow_transpose(const uint16_t * src, uint16_t * dest, int32_t size);
+#endif
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    static lv_cache_compare_res_t shadow_cache_compare_cb(const shadow_cache_data_t * lhs,
+                                                          const shadow_cache_data_t * rhs);
+    static bool shadow_cache_create_cb(shadow_cache_data_t * data, void * user_data);
+    static void shadow_cache_free_cb(shadow_cache_data_t * data, void * user_data);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -56,10 +89,7 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
 {
     /*Calculate the rectangle which is blurred to get the shadow in `shadow_area`*/
     lv_area_t core_area;
-    core_area.x1 = coords->x1  + dsc->ofs_x - dsc->spread;
-    core_area.x2 = coords->x2  + dsc->ofs_x + dsc->spread;
-    core_area.y1 = coords->y1  + dsc->ofs_y - dsc->spread;
-    core_area.y2 = coords->y2  + dsc->ofs_y + dsc->spread;
+    int32_t r_sh = shadow_get_core_area(dsc, coords, &core_area);
 
     /*Calculate the bounding box of the shadow*/
     lv_area_t shadow_area;
@@ -86,40 +116,38 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
     int32_t short_side = LV_MIN(lv_area_get_width(&bg_area), lv_area_get_height(&bg_area));
     if(r_bg > short_side >> 1) r_bg = short_side >> 1;
 
-    /*Get the clamped radius*/
-    int32_t r_sh = dsc->radius;
-    short_side = LV_MIN(lv_area_get_width(&core_area), lv_area_get_height(&core_area));
-    if(r_sh > short_side >> 1) r_sh = short_side >> 1;
-
     /*Get how many pixels are affected by the blur on the corners*/
     int32_t corner_size = dsc->width  + r_sh;
 
-    lv_opa_t * sh_buf;
+    lv_opa_t * sh_buf = NULL;
 
 #if LV_DRAW_SW_SHADOW_CACHE_SIZE
-    lv_draw_sw_shadow_cache_t * cache = &shadow_cache;
-    if(cache->cache_size == corner_size && cache->cache_r == r_sh) {
-        /*Use the cache if available*/
-        sh_buf = lv_malloc(corner_size * corner_size);
-        lv_memcpy(sh_buf, cache->cache, corner_size * corner_size);
-    }
-    else {
-        /*A larger buffer is required for calculation*/
-        sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
-        shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
-
-        /*Cache the corner if it fits into the cache size*/
-        if((uint32_t)corner_size * corner_size < sizeof(cache->cache)) {
-            lv_memcpy(cache->cache, sh_buf, corner_size * corner_size);
-            cache->cache_size = corner_size;
-            cache->cache_r = r_sh;
+    /*Get the corner from the cache or calculate it while the cache is locked
+     *so that the other draw units can use it too*/
+    lv_cache_entry_t * cache_entry = NULL;
+    if(corner_size <= LV_DRAW_SW_SHADOW_CACHE_SIZE) {
+        shadow_cache_data_t search_key;
+        lv_memzero(&search_key, sizeof(search_key));
+        search_key.slot.size = corner_size * corner_size;
+        search_key.sw = dsc->width;
+        search_key.r = r_sh;
+        /*The sides of the rectangle don't change the corner if they are far enough*/
+        search_key.core_w = LV_MIN(lv_area_get_width(&core_area), corner_size + r_sh);
+        search_key.core_h = LV_MIN(lv_area_get_height(&core_area), corner_size + r_sh);
+        cache_entry = lv_cache_acquire_or_create(shadow_cache_p, &search_key, draw_unit);
+        if(cache_entry) {
+            shadow_cache_data_t * cached_data = lv_cache_entry_get_data(cache_entry);
+            sh_buf = cached_data->buf;
         }
     }
-#else
-    sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
-    shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
 #endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
 
+    if(sh_buf == NULL) {
+        /*A larger buffer is required for calculation*/
+        sh_buf = lv_draw_sw_scratch_alloc(draw_unit, corner_size * corner_size * sizeof(uint16_t));
+        shadow_draw_corner_buf(draw_unit, &core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
+    }
+
     /*Skip a lot of masking if the background will cover the shadow that would be masked out*/
     bool simple = dsc->bg_cover;
 
@@ -132,7 +160,7 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
         masks[0] = &mask_rout_param;
     }
 
-    lv_opa_t * mask_buf = lv_malloc(lv_area_get_width(&shadow_area));
+    lv_opa_t * mask_buf = lv_draw_sw_scratch_alloc(draw_unit, lv_area_get_width(&shadow_area));
     lv_area_t blend_area;
     lv_area_t clip_area_sub;
     lv_opa_t * sh_buf_tmp;
@@ -181,7 +209,7 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
                 blend_area.y2 = y;
 
                 if(!simple_sub) {
-                    lv_memcpy(mask_buf, sh_buf_tmp, corner_size);
+                    lv_memcpy(mask_buf, sh_buf_tmp, w);
                     blend_dsc.mask_res = lv_draw_sw_mask_apply(masks, mask_buf, clip_area_sub.x1, y, w);
                     if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_FULL_COVER) blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
                 }
@@ -224,7 +252,7 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
                 blend_area.y2 = y;
 
                 if(!simple_sub) {
-                    lv_memcpy(mask_buf, sh_buf_tmp, corner_size);
+                    lv_memcpy(mask_buf, sh_buf_tmp, w);
                     blend_dsc.mask_res = lv_draw_sw_mask_apply(masks, mask_buf, clip_area_sub.x1, y, w);
                     if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_FULL_COVER) blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
                 }
@@ -376,8 +404,17 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
         }
     }
 
-    /*Mirror the shadow corner buffer horizontally*/
-    sh_buf_tmp = sh_buf ;
+    /*Mirror the shadow corner buffer horizontally.
+     *A cached corner can be used by other draw units too so mirror a copy of it*/
+    lv_opa_t * sh_buf_mirror = NULL;
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    if(cache_entry) {
+        sh_buf_mirror = lv_draw_sw_scratch_alloc(draw_unit, corner_size * corner_size);
+        lv_memcpy(sh_buf_mirror, sh_buf, corner_size * corner_size);
+        sh_buf = sh_buf_mirror;
+    }
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+    sh_buf_tmp = sh_buf;
     for(y = 0; y < corner_size; y++) {
         int32_t x;
         lv_opa_t * start = sh_buf_tmp;
@@ -463,7 +500,7 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
                 blend_area.y2 = y;
 
                 if(!simple_sub) {
-                    lv_memcpy(mask_buf, sh_buf_tmp, corner_size);
+                    lv_memcpy(mask_buf, sh_buf_tmp, w);
                     blend_dsc.mask_res = lv_draw_sw_mask_apply(masks, mask_buf, clip_area_sub.x1, y, w);
                     if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_FULL_COVER) blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
                 }
@@ -507,7 +544,7 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
                 blend_area.y2 = y;
 
                 if(!simple_sub) {
-                    lv_memcpy(mask_buf, sh_buf_tmp, corner_size);
+                    lv_memcpy(mask_buf, sh_buf_tmp, w);
                     blend_dsc.mask_res = lv_draw_sw_mask_apply(masks, mask_buf, clip_area_sub.x1, y, w);
                     if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_FULL_COVER) blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
                 }
@@ -549,14 +586,84 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
     if(!simple) {
         lv_draw_sw_mask_free_param(&mask_rout_param);
     }
-    lv_free(sh_buf);
-    lv_free(mask_buf);
+    if(sh_buf_mirror) lv_draw_sw_scratch_free(draw_unit, sh_buf_mirror);
+    lv_draw_sw_scratch_free(draw_unit, mask_buf);
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    if(cache_entry) {
+        lv_cache_release(shadow_cache_p, cache_entry, NULL);
+        return;
+    }
+#endif
+    lv_draw_sw_scratch_free(draw_unit, sh_buf);
+}
+
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+lv_result_t lv_draw_sw_shadow_cache_init(void)
+{
+    if(shadow_cache_p != NULL) {
+        return LV_RESULT_OK;
+    }
+
+    shadow_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(shadow_cache_data_t), SHADOW_CACHE_MEM_SIZE, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) shadow_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) shadow_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) shadow_cache_free_cb,
+    });
+
+    lv_cache_set_name(shadow_cache_p, CACHE_NAME);
+    return shadow_cache_p != NULL ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+void lv_draw_sw_shadow_cache_deinit(void)
+{
+    if(shadow_cache_p == NULL) return;
+
+    lv_cache_destroy(shadow_cache_p, NULL);
+    shadow_cache_p = NULL;
+}
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+
+bool lv_draw_sw_box_shadow_is_cached(const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    if(shadow_cache_p == NULL || !lv_cache_is_enabled(shadow_cache_p)) return false;
+
+    lv_area_t core_area;
+    int32_t r_sh = shadow_get_core_area(dsc, coords, &core_area);
+    return dsc->width + r_sh <= LV_DRAW_SW_SHADOW_CACHE_SIZE;
+#else
+    LV_UNUSED(dsc);
+    LV_UNUSED(coords);
+    return false;
+#endif
 }
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Get the rectangle which is blurred to get the shadow.
+ * @param dsc           the draw descriptor
+ * @param coords        the coordinates of the rectangle casting the shadow
+ * @param core_area     store the blurred rectangle here
+ * @return              the radius of the blurred rectangle, clamped to its size
+ */
+static int32_t shadow_get_core_area(const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords,
+                                    lv_area_t * core_area)
+{
+    core_area->x1 = coords->x1  + dsc->ofs_x - dsc->spread;
+    core_area->x2 = coords->x2  + dsc->ofs_x + dsc->spread;
+    core_area->y1 = coords->y1  + dsc->ofs_y - dsc->spread;
+    core_area->y2 = coords->y2  + dsc->ofs_y + dsc->spread;
+
+    int32_t r_sh = dsc->radius;
+    int32_t short_side = LV_MIN(lv_area_get_width(core_area), lv_area_get_height(core_area));
+    if(r_sh > short_side >> 1) r_sh = short_side >> 1;
+    return r_sh;
+}
+
 /**
  * Calculate a blurred corner
  * @param coords Coordinates of the shadow
@@ -564,8 +671,8 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
  * @param sw shadow width
  * @param r radius
  */
-static void LV_ATTRIBUTE_FAST_MEM shadow_draw_corner_buf(const lv_area_t * coords, uint16_t * sh_buf, int32_t sw,
-                                                         int32_t r)
+static void LV_ATTRIBUTE_FAST_MEM shadow_draw_corner_buf(lv_draw_unit_t * draw_unit, const lv_area_t * coords,
+                                                         uint16_t * sh_buf, int32_t sw, int32_t r)
 {
     int32_t sw_ori = sw;
     int32_t size = sw_ori  + r;
@@ -581,14 +688,20 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_draw_corner_buf(const lv_area_t * coord
     lv_draw_sw_mask_radius_param_t mask_param;
     lv_draw_sw_mask_radius_init(&mask_param, &sh_area, r, false);
 
+#if LV_DRAW_SW_SHADOW_BLUR_PASSES
+    /*The box blur normalizes the sums itself*/
+    int32_t div = 1;
+#else
 #if SHADOW_ENHANCE
     /*Set half shadow width width because blur will be repeated*/
     if(sw_ori == 1) sw = 1;
     else sw = sw_ori >> 1;
 #endif /*SHADOW_ENHANCE*/
+    int32_t div = sw;
+#endif /*LV_DRAW_SW_SHADOW_BLUR_PASSES*/
 
     int32_t y;
-    lv_opa_t * mask_line = lv_malloc(size);
+    lv_opa_t * mask_line = lv_draw_sw_scratch_alloc(draw_unit, size);
     uint16_t * sh_ups_tmp_buf = (uint16_t *)sh_buf;
     for(y = 0; y < size; y++) {
         lv_memset(mask_line, 0xff, size);
@@ -598,16 +711,16 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_draw_corner_buf(const lv_area_t * coord
         }
         else {
             int32_t i;
-            sh_ups_tmp_buf[0] = (mask_line[0] << SHADOW_UPSCALE_SHIFT) / sw;
+            sh_ups_tmp_buf[0] = (mask_line[0] << SHADOW_UPSCALE_SHIFT) / div;
             for(i = 1; i < size; i++) {
                 if(mask_line[i] == mask_line[i - 1]) sh_ups_tmp_buf[i] = sh_ups_tmp_buf[i - 1];
-                else  sh_ups_tmp_buf[i] = (mask_line[i] << SHADOW_UPSCALE_SHIFT) / sw;
+                else  sh_ups_tmp_buf[i] = (mask_line[i] << SHADOW_UPSCALE_SHIFT) / div;
             }
         }
 
         sh_ups_tmp_buf += size;
     }
-    lv_free(mask_line);
+    lv_draw_sw_scratch_free(draw_unit, mask_line);
 
     lv_draw_sw_mask_free_param(&mask_param);
 
@@ -620,7 +733,10 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_draw_corner_buf(const lv_area_t * coord
         return;
     }
 
-    shadow_blur_corner(size, sw, sh_buf);
+#if LV_DRAW_SW_SHADOW_BLUR_PASSES
+    shadow_box_blur_corner(draw_unit, size, sw, sh_buf);
+#else
+    shadow_blur_corner(draw_unit, size, sw, sh_buf);
 
 #if SHADOW_ENHANCE == 0
     /*The result is required in lv_opa_t not uint16_t*/
@@ -640,25 +756,27 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_draw_corner_buf(const lv_area_t * coord
             else  sh_buf[i] = (sh_buf[i] << SHADOW_UPSCALE_SHIFT) / sw;
         }
 
-        shadow_blur_corner(size, sw, sh_buf);
+        shadow_blur_corner(draw_unit, size, sw, sh_buf);
     }
     int32_t x;
     lv_opa_t * res_buf = (lv_opa_t *)sh_buf;
     for(x = 0; x < size * size; x++) {
         res_buf[x] = (lv_opa_t) sh_buf[x];
     }
-#endif
-
+#endif /*SHADOW_ENHANCE*/
+#endif /*LV_DRAW_SW_SHADOW_BLUR_PASSES*/
 }
 
-static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf)
+#if LV_DRAW_SW_SHADOW_BLUR_PASSES == 0
+static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(lv_draw_unit_t * draw_unit, int32_t size, int32_t sw,
+                                                     uint16_t * sh_ups_buf)
 {
     int32_t s_left = sw >> 1;
     int32_t s_right = (sw >> 1);
     if((sw & 1) == 0) s_left--;
 
     /*Horizontal blur*/
-    uint16_t * sh_ups_blur_buf = lv_malloc(size * sizeof(uint16_t));
+    uint16_t * sh_ups_blur_buf = lv_draw_sw_scratch_alloc(draw_unit, size * sizeof(uint16_t));
 
     int32_t x;
     int32_t y;
@@ -721,9 +839,185 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(int32_t size, int32_t sw, u
         }
     }
 
-    lv_free(sh_ups_blur_buf);
+    lv_draw_sw_scratch_free(draw_unit, sh_ups_blur_buf);
+}
+
+#else /*LV_DRAW_SW_SHADOW_BLUR_PASSES*/
+
+/**
+ * Blur a corner with `LV_DRAW_SW_SHADOW_BLUR_PASSES` box blurs approximating a Gaussian blur.
+ * The blur is separable so the passes are done on the columns, then on the columns of the transposed corner.
+ * @param draw_unit     the draw unit whose scratch buffer can be used
+ * @param size          width and height of the corner
+ * @param sw            shadow width, the total length of the box blurs
+ * @param sh_ups_buf    the coverage upscaled by `SHADOW_UPSCALE_SHIFT` as input.
+ *                      The result is written to its first `size * size` bytes as `lv_opa_t`.
+ *                      It's transparent if there is no memory for the blur.
+ */
+static void shadow_box_blur_corner(lv_draw_unit_t * draw_unit, int32_t size, int32_t sw, uint16_t * sh_ups_buf)
+{
+    uint16_t * tmp_buf = lv_draw_sw_scratch_alloc(draw_unit, size * size * sizeof(uint16_t));
+    uint32_t * sum_buf = lv_draw_sw_scratch_alloc(draw_unit, size * sizeof(uint32_t));
+    if(tmp_buf == NULL || sum_buf == NULL) {
+        /*Without the blur only the part below the rectangle would remain, so make the corner transparent*/
+        LV_LOG_WARN("couldn't allocate the blur buffers, the shadow is not drawn");
+        lv_memzero(sh_ups_buf, size * size);
+        lv_draw_sw_scratch_free(draw_unit, sum_buf);
+        lv_draw_sw_scratch_free(draw_unit, tmp_buf);
+        return;
+    }
+
+    /*Every step writes the other buffer*/
+    uint16_t * src = sh_ups_buf;
+    uint16_t * dest = tmp_buf;
+    uint16_t * swap_tmp;
+
+    int32_t dir;
+    for(dir = 0; dir < 2; dir++) {
+        int32_t p;
+        for(p = 0; p < LV_DRAW_SW_SHADOW_BLUR_PASSES; p++) {
+            /*Distribute the shadow width among the passes*/
+            int32_t len = sw / LV_DRAW_SW_SHADOW_BLUR_PASSES + (p < sw % LV_DRAW_SW_SHADOW_BLUR_PASSES ? 1 : 0);
+            if(len <= 1) continue;
+
+            /*Flip every second pass to keep the result centered with even lengths*/
+            shadow_box_blur_cols(src, dest, sum_buf, size, len, p & 1);
+            swap_tmp = src;
+            src = dest;
+            dest = swap_tmp;
+        }
+
+        shadow_transpose(src, dest, size);
+        swap_tmp = src;
+        src = dest;
+        dest = swap_tmp;
+    }
+
+    /*The result is required in lv_opa_t. If it's in `sh_ups_buf` it can be converted in place from the start*/
+    lv_opa_t * res_buf = (lv_opa_t *)sh_ups_buf;
+    int32_t i;
+    for(i = 0; i < size * size; i++) {
+        uint32_t v = (src[i] + (1 << (SHADOW_UPSCALE_SHIFT - 1))) >> SHADOW_UPSCALE_SHIFT;
+        res_buf[i] = v > LV_OPA_COVER ? LV_OPA_COVER : (lv_opa_t)v;
+    }
+
+    lv_draw_sw_scratch_free(draw_unit, sum_buf);
+    lv_draw_sw_scratch_free(draw_unit, tmp_buf);
 }
 
+/**
+ * Blur the columns of a buffer with a box filter using running sums.
+ * All columns are processed together row by row, so the inner loops are simple and vectorizable.
+ * Outside of the buffer the edge pixels are repeated.
+ * @param src       the source buffer with `size * size` values
+ * @param dest      the destination buffer with `size * size` values
+ * @param sum       a buffer for `size` running sums
+ * @param size      width and height of the buffers
+ * @param len       the height of the box
+ * @param flip      true: if `len` is even, take one more row from above instead of below
+ */
+static void LV_ATTRIBUTE_FAST_MEM shadow_box_blur_cols(const uint16_t * src, uint16_t * dest, uint32_t * sum,
+                                                       int32_t size, int32_t len, bool flip)
+{
+    int32_t above = (len - 1) / 2;
+    int32_t below = len - 1 - above;
+    if(flip) {
+        int32_t t = above;
+        above = below;
+        below = t;
+    }
+
+    /*Multiply by the reciprocal in 0.16 fixed point instead of dividing.
+     *The sums are at most `len * (255 << SHADOW_UPSCALE_SHIFT)` so the product fits into 32 bits*/
+    uint32_t recip = ((1 << 16) + len / 2) / len;
+
+    int32_t x;
+    int32_t y;
+
+    /*The window of the first row*/
+    for(x = 0; x < size; x++) sum[x] = (uint32_t)src[x] * (above + 1);
+    for(y = 1; y <= below; y++) {
+        const uint16_t * row = src + LV_MIN(y, size - 1) * size;
+        for(x = 0; x < size; x++) sum[x] += row[x];
+    }
+
+    for(y = 0; y < size; y++) {
+        uint16_t * dest_row = dest + y * size;
+        for(x = 0; x < size; x++) dest_row[x] = (uint16_t)((sum[x] * recip + 0x8000) >> 16);
+
+        /*Slide the window down by one row*/
+        const uint16_t * add_row = src + LV_MIN(y + below + 1, size - 1) * size;
+        const uint16_t * sub_row = src + LV_MAX(y - above, 0) * size;
+        for(x = 0; x < size; x++) sum[x] = sum[x] + add_row[x] - sub_row[x];
+    }
+}
+
+/**
+ * Transpose a square buffer
+ * @param src       the source buffer with `size * size` values
+ * @param dest      the destination buffer with `size * size` values
+ * @param size      width and height of the buffers
+ */
+static void shadow_transpose(const uint16_t * src, uint16_t * dest, int32_t size)
+{
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < size; y++) {
+        const uint16_t * src_row = src + y * size;
+        for(x = 0; x < size; x++) {
+            dest[x * size + y] = src_row[x];
+        }
+    }
+}
+#endif /*LV_DRAW_SW_SHADOW_BLUR_PASSES*/
+
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+static lv_cache_compare_res_t shadow_cache_compare_cb(const shadow_cache_data_t * lhs,
+                                                      const shadow_cache_data_t * rhs)
+{
+    if(lhs->sw != rhs->sw) return lhs->sw > rhs->sw ? 1 : -1;
+    if(lhs->r != rhs->r) return lhs->r > rhs->r ? 1 : -1;
+    if(lhs->core_w != rhs->core_w) return lhs->core_w > rhs->core_w ? 1 : -1;
+    if(lhs->core_h != rhs->core_h) return lhs->core_h > rhs->core_h ? 1 : -1;
+    return 0;
+}
+
+/**
+ * Calculate a corner which was not found in the cache. Called with the cache locked.
+ * @param data          the new cache entry, initialized from the search key
+ * @param user_data     the draw unit whose scratch buffer can be used for the calculation
+ * @return              true: success, false: couldn't allocate the corner
+ */
+static bool shadow_cache_create_cb(shadow_cache_data_t * data, void * user_data)
+{
+    lv_draw_unit_t * draw_unit = user_data;
+    int32_t size = data->sw + data->r;
+
+    data->buf = lv_malloc(size * size);
+    LV_ASSERT_MALLOC(data->buf);
+    if(data->buf == NULL) return false;
+
+    /*Only the size of the area matters*/
+    lv_area_t core_area = {0, 0, data->core_w - 1, data->core_h - 1};
+    uint16_t * tmp_buf = lv_draw_sw_scratch_alloc(draw_unit, size * size * sizeof(uint16_t));
+    if(tmp_buf == NULL) {
+        lv_free(data->buf);
+        return false;
+    }
+
+    shadow_draw_corner_buf(draw_unit, &core_area, tmp_buf, data->sw, data->r);
+    lv_memcpy(data->buf, tmp_buf, size * size);
+    lv_draw_sw_scratch_free(draw_unit, tmp_buf);
+    return true;
+}
+
+static void shadow_cache_free_cb(shadow_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(data->buf);
+}
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+
 #else /*LV_DRAW_SW_COMPLEX*/
 
 void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords)
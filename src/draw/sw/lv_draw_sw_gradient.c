@@ -11,6 +11,8 @@
 
 #include "../../misc/lv_types.h"
 #include "../../osal/lv_os.h"
+#include "../../core/lv_global.h"
+#include "../../misc/cache/lv_cache_private.h"
 
 /*********************
  *      DEFINES
@@ -18,6 +20,11 @@
 #define GRAD_CM(r,g,b) lv_color_make(r,g,b)
 #define GRAD_CONV(t, x) t = x
 
+#define CACHE_NAME  "SW_GRADIENT"
+
+#define grad_cache_p (LV_GLOBAL_DEFAULT()->sw_grad_cache)
+#define grad_cache_monitor (LV_GLOBAL_DEFAULT()->sw_grad_cache_monitor)
+
 #undef ALIGN
 #if defined(LV_ARCH_64)
     #define ALIGN(X)    (((X) + 7) & ~7)
@@ -26,35 +33,30 @@
 #endif
 
 /**********************
- *  STATIC PROTOTYPES
+ *      TYPEDEFS
  **********************/
-typedef lv_result_t (*op_cache_t)(lv_grad_t * c, void * ctx);
-static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h);
+typedef struct {
+    lv_cache_slot_size_t slot;  /**< Size of `grad` with its maps. Must be the first field*/
+    lv_grad_dsc_t dsc;          /**< Key: a copy of the gradient's descriptor*/
+    uint32_t size;              /**< Key: width or height of the gradient based on its direction*/
+    lv_grad_t * grad;           /**< The calculated gradient*/
+} grad_cache_data_t;
 
 /**********************
- *   STATIC VARIABLE
+ *  STATIC PROTOTYPES
  **********************/
+static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h);
+static size_t get_item_size(int32_t size);
+static void fill_item(const lv_grad_dsc_t * g, lv_grad_t * item);
+static lv_cache_compare_res_t grad_cache_compare_cb(const grad_cache_data_t * lhs, const grad_cache_data_t * rhs);
+static bool grad_cache_create_cb(grad_cache_data_t * data, void * user_data);
+static void grad_cache_free_cb(grad_cache_data_t * data, void * user_data);
+static void grad_cache_monitor_count(bool hit);
 
 /**********************
- *   STATIC FUNCTIONS
+ *   STATIC VARIABLE
  **********************/
 
-static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h)
-{
-    int32_t size = g->dir == LV_GRAD_DIR_HOR ? w : h;
-
-    size_t req_size = ALIGN(sizeof(lv_grad_t)) + ALIGN(size * sizeof(lv_color_t)) + ALIGN(size * sizeof(lv_opa_t));
-    lv_grad_t * item  = lv_malloc(req_size);
-    LV_ASSERT_MALLOC(item);
-    if(item == NULL) return NULL;
-
-    uint8_t * p = (uint8_t *)item;
-    item->color_map = (lv_color_t *)(p + ALIGN(sizeof(*item)));
-    item->opa_map = (lv_opa_t *)(p + ALIGN(sizeof(*item)) + ALIGN(size * sizeof(lv_color_t)));
-    item->size = size;
-    return item;
-}
-
 /**********************
  *     FUNCTIONS
  **********************/
@@ -65,6 +67,28 @@ lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, int32_t w, int32_t h)
     if(g->dir == LV_GRAD_DIR_NONE) return NULL;
 
     /* Step 1: Search cache for the given key */
+    int32_t size = g->dir == LV_GRAD_DIR_HOR ? w : h;
+    size_t req_size = get_item_size(size);
+    if(grad_cache_p && req_size <= lv_cache_get_max_size(grad_cache_p, NULL)) {
+        grad_cache_data_t search_key;
+        lv_memzero(&search_key, sizeof(search_key));
+        search_key.slot.size = req_size;
+        search_key.dsc = *g;
+        search_key.size = size;
+
+        /*Calculated in `grad_cache_create_cb` if not found, which counts the miss too*/
+        bool created = false;
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(grad_cache_p, &search_key, &created);
+        if(entry) {
+            if(!created) grad_cache_monitor_count(true);
+
+            grad_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+            return cached_data->grad;
+        }
+    }
+
+    /* Step 2: Not cacheable, allocate a temporary item */
+    grad_cache_monitor_count(false);
     lv_grad_t * item = allocate_item(g, w, h);
     if(item == NULL) {
         LV_LOG_WARN("Failed to allocate item for the gradient");
@@ -72,10 +96,7 @@ lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, int32_t w, int32_t h)
     }
 
     /* Step 3: Fill it with the gradient, as expected */
-    uint32_t i;
-    for(i = 0; i < item->size; i++) {
-        lv_gradient_color_calculate(g, item->size, i, &item->color_map[i], &item->opa_map[i]);
-    }
+    fill_item(g, item);
     return item;
 }
 
@@ -134,7 +155,158 @@ void LV_ATTRIBUTE_FAST_MEM lv_gradient_color_calculate(const lv_grad_dsc_t * dsc
 
 void lv_gradient_cleanup(lv_grad_t * grad)
 {
-    lv_free(grad);
+    if(grad->cache_entry) lv_cache_release(grad_cache_p, grad->cache_entry, NULL);
+    else lv_free(grad);
+}
+
+lv_result_t lv_gradient_cache_init(uint32_t size)
+{
+    if(grad_cache_p != NULL) {
+        return LV_RESULT_OK;
+    }
+
+    grad_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(grad_cache_data_t), size, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) grad_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) grad_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) grad_cache_free_cb,
+    });
+
+    lv_cache_set_name(grad_cache_p, CACHE_NAME);
+    return grad_cache_p != NULL ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+void lv_gradient_cache_deinit(void)
+{
+    if(grad_cache_p == NULL) return;
+
+    lv_cache_destroy(grad_cache_p, NULL);
+    grad_cache_p = NULL;
+}
+
+void lv_gradient_cache_resize(uint32_t new_size)
+{
+    lv_cache_set_max_size(grad_cache_p, new_size, NULL);
+    lv_cache_reserve(grad_cache_p, new_size, NULL);
+}
+
+void lv_gradient_cache_drop_all(void)
+{
+    lv_cache_drop_all(grad_cache_p, NULL);
+}
+
+void lv_gradient_cache_monitor(lv_gradient_cache_monitor_t * mon_p)
+{
+    if(grad_cache_p) lv_mutex_lock(&grad_cache_p->lock);
+    *mon_p = grad_cache_monitor;
+    if(grad_cache_p) lv_mutex_unlock(&grad_cache_p->lock);
+    mon_p->size = grad_cache_p ? lv_cache_get_size(grad_cache_p, NULL) : 0;
+    mon_p->max_size = grad_cache_p ? lv_cache_get_max_size(grad_cache_p, NULL) : 0;
+}
+
+void lv_gradient_cache_monitor_reset(void)
+{
+    if(grad_cache_p) lv_mutex_lock(&grad_cache_p->lock);
+    lv_memzero(&grad_cache_monitor, sizeof(grad_cache_monitor));
+    if(grad_cache_p) lv_mutex_unlock(&grad_cache_p->lock);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static size_t get_item_size(int32_t size)
+{
+    return ALIGN(sizeof(lv_grad_t)) + ALIGN(size * sizeof(lv_color_t)) + ALIGN(size * sizeof(lv_opa_t));
+}
+
+static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h)
+{
+    int32_t size = g->dir == LV_GRAD_DIR_HOR ? w : h;
+
+    size_t req_size = get_item_size(size);
+    lv_grad_t * item  = lv_malloc(req_size);
+    LV_ASSERT_MALLOC(item);
+    if(item == NULL) return NULL;
+
+    uint8_t * p = (uint8_t *)item;
+    item->color_map = (lv_color_t *)(p + ALIGN(sizeof(*item)));
+    item->opa_map = (lv_opa_t *)(p + ALIGN(sizeof(*item)) + ALIGN(size * sizeof(lv_color_t)));
+    item->size = size;
+    item->cache_entry = NULL;
+    return item;
+}
+
+static void fill_item(const lv_grad_dsc_t * g, lv_grad_t * item)
+{
+    uint32_t i;
+    for(i = 0; i < item->size; i++) {
+        lv_gradient_color_calculate(g, item->size, i, &item->color_map[i], &item->opa_map[i]);
+    }
+}
+
+/**
+ * Compare the size, the direction and the used stops of two gradients.
+ * The unused stops and the padding bytes are ignored.
+ */
+static lv_cache_compare_res_t grad_cache_compare_cb(const grad_cache_data_t * lhs, const grad_cache_data_t * rhs)
+{
+    if(lhs->size != rhs->size) return lhs->size > rhs->size ? 1 : -1;
+    if(lhs->dsc.dir != rhs->dsc.dir) return lhs->dsc.dir > rhs->dsc.dir ? 1 : -1;
+    if(lhs->dsc.stops_count != rhs->dsc.stops_count) return lhs->dsc.stops_count > rhs->dsc.stops_count ? 1 : -1;
+
+    uint32_t i;
+    for(i = 0; i < lhs->dsc.stops_count; i++) {
+        const lv_gradient_stop_t * l = &lhs->dsc.stops[i];
+        const lv_gradient_stop_t * r = &rhs->dsc.stops[i];
+        uint32_t l_color = lv_color_to_u32(l->color);
+        uint32_t r_color = lv_color_to_u32(r->color);
+        if(l_color != r_color) return l_color > r_color ? 1 : -1;
+        if(l->opa != r->opa) return l->opa > r->opa ? 1 : -1;
+        if(l->frac != r->frac) return l->frac > r->frac ? 1 : -1;
+    }
+
+    return 0;
+}
+
+/**
+ * Calculate a gradient which was not found in the cache. Called with the cache locked.
+ * @param data          the new cache entry, initialized from the search key
+ * @param user_data     pointer to a `bool`, set to true to indicate a cache miss
+ * @return              true: success, false: couldn't allocate the gradient
+ */
+static bool grad_cache_create_cb(grad_cache_data_t * data, void * user_data)
+{
+    lv_grad_t * item = allocate_item(&data->dsc, data->size, data->size);
+    if(item == NULL) return false;
+
+    fill_item(&data->dsc, item);
+    item->cache_entry = lv_cache_entry_get_entry(data, sizeof(grad_cache_data_t));
+    data->grad = item;
+
+    /*Runs under the cache lock, so the counter can't race with other draw units*/
+    grad_cache_monitor.miss_cnt++;
+    *(bool *)user_data = true;
+    return true;
+}
+
+static void grad_cache_free_cb(grad_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(data->grad);
+}
+
+/**
+ * Count a cache hit or a miss outside of the cache's callbacks.
+ * The draw units can get gradients in parallel so guard the counters with the cache lock.
+ * @param hit   true: count a hit, false: count a miss
+ */
+static void grad_cache_monitor_count(bool hit)
+{
+    if(grad_cache_p) lv_mutex_lock(&grad_cache_p->lock);
+    if(hit) grad_cache_monitor.hit_cnt++;
+    else grad_cache_monitor.miss_cnt++;
+    if(grad_cache_p) lv_mutex_unlock(&grad_cache_p->lock);
 }
 
 #endif /*LV_USE_DRAW_SW*/
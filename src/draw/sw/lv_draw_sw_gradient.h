@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 #include "../../misc/lv_color.h"
 #include "../../misc/lv_style.h"
+#include "../../misc/cache/lv_cache.h"
 
 #if LV_USE_DRAW_SW
 
@@ -34,8 +35,16 @@ typedef struct _lv_gradient_cache_t {
     lv_color_t   *  color_map;
     lv_opa_t   *  opa_map;
     uint32_t size;
+    lv_cache_entry_t * cache_entry;     /**< The entry in the gradient cache or NULL if not cached*/
 } lv_grad_t;
 
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of gradients found in the cache*/
+    uint32_t miss_cnt;      /**< Number of gradients which needed to be calculated*/
+    uint32_t size;          /**< Current size of the cached gradients in bytes*/
+    uint32_t max_size;      /**< Maximum size of the cache in bytes*/
+} lv_gradient_cache_monitor_t;
+
 /**********************
  *      PROTOTYPES
  **********************/
@@ -49,15 +58,59 @@ typedef struct _lv_gradient_cache_t {
 void /* LV_ATTRIBUTE_FAST_MEM */ lv_gradient_color_calculate(const lv_grad_dsc_t * dsc, int32_t range,
                                                              int32_t frac, lv_grad_color_t * color_out, lv_opa_t * opa_out);
 
-/** Get a gradient cache from the given parameters */
+/**
+ * Get the color and opacity map of a gradient. Take it from the gradient cache if possible
+ * or calculate it and add to the cache.
+ * @param gradient  the gradient descriptor
+ * @param w         width of the area to fill
+ * @param h         height of the area to fill
+ * @return          the gradient or NULL if there is no gradient or it couldn't be allocated
+ */
 lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * gradient, int32_t w, int32_t h);
 
 /**
- * Clean up the gradient item after it was get with `lv_grad_get_from_cache`.
+ * Clean up the gradient item after it was get with `lv_gradient_get`.
+ * Release it in the cache or free it if it's not cached.
  * @param grad      pointer to a gradient
  */
 void lv_gradient_cleanup(lv_grad_t * grad);
 
+/**
+ * Create the gradient cache. Called by `lv_draw_sw_init()`.
+ * @param size      size of the cache in bytes, 0: disable caching
+ * @return          LV_RESULT_OK: initialization succeeded, LV_RESULT_INVALID: failed.
+ */
+lv_result_t lv_gradient_cache_init(uint32_t size);
+
+/**
+ * Delete the gradient cache. Called by `lv_draw_sw_deinit()`.
+ */
+void lv_gradient_cache_deinit(void);
+
+/**
+ * Resize the gradient cache. The gradients used by draw tasks are freed only when they are released.
+ * @param new_size  new size of the cache in bytes, 0: disable caching
+ */
+void lv_gradient_cache_resize(uint32_t new_size);
+
+/**
+ * Remove all the gradients from the cache.
+ */
+void lv_gradient_cache_drop_all(void);
+
+/**
+ * Get the hit/miss statistics of the gradient cache
+ * @param mon_p     store the statistics here
+ * @note            The counters are updated without locking so they might be slightly lower
+ *                  than the real values if LV_DRAW_SW_DRAW_UNIT_CNT > 1
+ */
+void lv_gradient_cache_monitor(lv_gradient_cache_monitor_t * mon_p);
+
+/**
+ * Reset the hit and miss counters of the gradient cache
+ */
+void lv_gradient_cache_monitor_reset(void);
+
 #endif /*LV_USE_DRAW_SW*/
 
 #ifdef __cplusplus
@@ -270,7 +270,9 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
         if(decoder_res == LV_RESULT_OK) lv_image_decoder_close(&mask_decoder_dsc);
     }
     /* check whether it is possible to accelerate the operation in synchronouse mode */
-    else if(LV_RESULT_INVALID == LV_DRAW_SW_IMAGE(transformed,      /* whether require transform */
+    /* (the accelerators write the layer's buffer directly so they can't be used if it's rotated) */
+    else if(draw_unit->target_layer->rotation != LV_DISPLAY_ROTATION_0 ||
+            LV_RESULT_INVALID == LV_DRAW_SW_IMAGE(transformed,      /* whether require transform */
                                                   cf,               /* image format */
                                                   src_buf,          /* image buffer */
                                                   img_coords,       /* src_h, src_w, src_x1, src_y1 */
@@ -305,13 +307,13 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
             uint32_t buf_stride = blend_w * 3;
             buf_h = MAX_BUF_SIZE / buf_stride;
             if(buf_h > blend_h) buf_h = blend_h;
-            tmp_buf = lv_malloc(buf_stride * buf_h);
+            tmp_buf = lv_draw_sw_scratch_alloc(draw_unit, buf_stride * buf_h);
         }
         else {
             uint32_t buf_stride = blend_w * lv_color_format_get_size(cf_final);
             buf_h = MAX_BUF_SIZE / buf_stride;
             if(buf_h > blend_h) buf_h = blend_h;
-            tmp_buf = lv_malloc(buf_stride * buf_h);
+            tmp_buf = lv_draw_sw_scratch_alloc(draw_unit, buf_stride * buf_h);
         }
         LV_ASSERT_MALLOC(tmp_buf);
 
@@ -452,7 +454,7 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
             }
         }
 
-        lv_free(tmp_buf);
+        lv_draw_sw_scratch_free(draw_unit, tmp_buf);
     }
 }
 
@@ -0,0 +1,182 @@
+/**
+ * @file lv_draw_sw_kernels.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_kernels.h"
+#if LV_USE_DRAW_SW
+
+#include "../../core/lv_global.h"
+#include "../../stdlib/lv_string.h"
+#include "../../misc/lv_log.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+    #include "blend/x86/lv_blend_x86.h"
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define CPU_X86     1
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #elif defined(__GNUC__)
+        #include <cpuid.h>
+    #endif
+#elif defined(__arm__) && defined(__linux__)
+    #define CPU_ARM32_LINUX 1
+    #include <sys/auxv.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#define sw_kernels          LV_GLOBAL_DEFAULT()->draw_sw_kernels
+#define sw_cpu_features     LV_GLOBAL_DEFAULT()->draw_sw_cpu_features
+
+/*Same as HWCAP_NEON in <asm/hwcap.h> of 32 bit ARM Linux*/
+#define HWCAP_ARM_NEON      (1 << 12)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint32_t detect_cpu_features(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_sw_kernels_init(void)
+{
+    sw_cpu_features = detect_cpu_features();
+    LV_LOG_INFO("CPU features: SSE2: %d, AVX2: %d, NEON: %d",
+                (sw_cpu_features & LV_DRAW_SW_CPU_FEATURE_SSE2) ? 1 : 0,
+                (sw_cpu_features & LV_DRAW_SW_CPU_FEATURE_AVX2) ? 1 : 0,
+                (sw_cpu_features & LV_DRAW_SW_CPU_FEATURE_NEON) ? 1 : 0);
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_NEON
+    if((sw_cpu_features & LV_DRAW_SW_CPU_FEATURE_NEON) == 0) {
+        LV_LOG_WARN("LV_DRAW_SW_ASM_NEON is used but NEON was not detected on this CPU");
+    }
+#endif
+
+#if LV_DRAW_SW_FORCE_SCALAR
+    lv_draw_sw_set_kernel_features(LV_DRAW_SW_CPU_FEATURE_NONE);
+#else
+    lv_draw_sw_set_kernel_features(LV_DRAW_SW_CPU_FEATURE_ALL);
+#endif
+}
+
+uint32_t lv_draw_sw_get_cpu_features(void)
+{
+    return sw_cpu_features;
+}
+
+void lv_draw_sw_set_kernel_features(uint32_t features)
+{
+    features &= sw_cpu_features;
+    lv_memzero(&sw_kernels, sizeof(lv_draw_sw_kernels_t));
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+    lv_blend_x86_init_kernels(&sw_kernels, features);
+#else
+    LV_UNUSED(features);
+#endif
+}
+
+const lv_draw_sw_kernels_t * lv_draw_sw_get_kernels(void)
+{
+    return &sw_kernels;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if defined(CPU_X86) && (defined(_MSC_VER) || defined(__GNUC__))
+
+static void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4])
+{
+#if defined(_MSC_VER)
+    int r[4];
+    __cpuidex(r, (int)leaf, (int)subleaf);
+    regs[0] = (uint32_t)r[0];
+    regs[1] = (uint32_t)r[1];
+    regs[2] = (uint32_t)r[2];
+    regs[3] = (uint32_t)r[3];
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+/**
+ * Check if the OS saves the AVX (YMM) registers on context switches
+ */
+static bool os_saves_ymm(void)
+{
+    uint32_t xcr0;
+#if defined(_MSC_VER)
+    xcr0 = (uint32_t)_xgetbv(0);
+#else
+    uint32_t edx;
+    __asm__ volatile("xgetbv" : "=a"(xcr0), "=d"(edx) : "c"(0));
+    LV_UNUSED(edx);
+#endif
+    return (xcr0 & 0x6) == 0x6;
+}
+
+static uint32_t detect_cpu_features(void)
+{
+    uint32_t features = LV_DRAW_SW_CPU_FEATURE_NONE;
+    uint32_t regs[4];
+
+    cpuid(0, 0, regs);
+    uint32_t max_leaf = regs[0];
+    if(max_leaf < 1) return features;
+
+    cpuid(1, 0, regs);
+    if(regs[3] & (1 << 26)) features |= LV_DRAW_SW_CPU_FEATURE_SSE2;
+
+    /*AVX2 needs the AVX and OSXSAVE bits and the OS support of the YMM registers too*/
+    bool avx = (regs[2] & (1 << 28)) && (regs[2] & (1 << 27)) && os_saves_ymm();
+    if(avx && max_leaf >= 7) {
+        cpuid(7, 0, regs);
+        if(regs[1] & (1 << 5)) features |= LV_DRAW_SW_CPU_FEATURE_AVX2;
+    }
+
+    return features;
+}
+
+#else
+
+static uint32_t detect_cpu_features(void)
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+    /*Advanced SIMD is mandatory on 64 bit ARM*/
+    return LV_DRAW_SW_CPU_FEATURE_NEON;
+#elif defined(CPU_ARM32_LINUX)
+    return (getauxval(AT_HWCAP) & HWCAP_ARM_NEON) ? LV_DRAW_SW_CPU_FEATURE_NEON : LV_DRAW_SW_CPU_FEATURE_NONE;
+#elif defined(__ARM_NEON)
+    /*No way to detect it at run time, trust the compiler settings*/
+    return LV_DRAW_SW_CPU_FEATURE_NEON;
+#else
+    return LV_DRAW_SW_CPU_FEATURE_NONE;
+#endif
+}
+
+#endif
+
+#endif /*LV_USE_DRAW_SW*/
@@ -0,0 +1,138 @@
+/**
+ * @file lv_draw_sw_kernels.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_KERNELS_H
+#define LV_DRAW_SW_KERNELS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_draw.h"
+#if LV_USE_DRAW_SW
+
+#include "../../display/lv_display.h"
+#include "blend/lv_draw_sw_blend.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Instruction set extensions which can be used by the optimized kernels
+ */
+typedef enum {
+    LV_DRAW_SW_CPU_FEATURE_NONE = 0x00,
+    LV_DRAW_SW_CPU_FEATURE_SSE2 = 0x01,
+    LV_DRAW_SW_CPU_FEATURE_AVX2 = 0x02,
+    LV_DRAW_SW_CPU_FEATURE_NEON = 0x04,
+    LV_DRAW_SW_CPU_FEATURE_ALL  = 0xFF,
+} lv_draw_sw_cpu_feature_t;
+
+/**
+ * Optimized implementations of the hot loops of the software renderer.
+ * They are selected in `lv_draw_sw_init()` based on the features of the CPU the program runs on.
+ * If a member is `NULL` or it returns `LV_RESULT_INVALID` the C implementation is used.
+ */
+typedef struct {
+    /*Blending. The parameters are the same as the `LV_DRAW_SW_..._BLEND_...` hooks of the blend functions.
+     *Each kernel handles the simple, opa, mask and mix mask-opa cases.*/
+    lv_result_t (*color_blend_to_rgb565)(_lv_draw_sw_blend_fill_dsc_t * dsc);
+    lv_result_t (*rgb565_blend_normal_to_rgb565)(_lv_draw_sw_blend_image_dsc_t * dsc);
+    lv_result_t (*argb8888_blend_normal_to_rgb565)(_lv_draw_sw_blend_image_dsc_t * dsc);
+    lv_result_t (*color_blend_to_rgb888)(_lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dest_px_size);
+    lv_result_t (*rgb888_blend_normal_to_rgb888)(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dest_px_size,
+                                                 uint32_t src_px_size);
+    lv_result_t (*argb8888_blend_normal_to_rgb888)(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dest_px_size);
+    lv_result_t (*color_blend_to_argb8888)(_lv_draw_sw_blend_fill_dsc_t * dsc);
+    lv_result_t (*argb8888_blend_normal_to_argb8888)(_lv_draw_sw_blend_image_dsc_t * dsc);
+
+    /*Blend a row with `LV_BLEND_MODE_ADDITIVE/SUBTRACTIVE/MULTIPLY`.
+     *The alpha channel of `src` is the mix ratio with the opacity and the mask already applied.*/
+    lv_result_t (*blend_mode_row_to_rgb565)(uint16_t * dest, const lv_color32_t * src, int32_t len,
+                                            lv_blend_mode_t mode);
+    lv_result_t (*blend_mode_row_to_rgb888)(uint8_t * dest, const lv_color32_t * src, int32_t len,
+                                            lv_blend_mode_t mode, uint32_t dest_px_size);
+    lv_result_t (*blend_mode_row_to_argb8888)(lv_color32_t * dest, const lv_color32_t * src, int32_t len,
+                                              lv_blend_mode_t mode);
+
+    /*Same as `lv_draw_sw_rgb565_swap()`*/
+    lv_result_t (*rgb565_swap)(void * buf, uint32_t buf_size_px);
+
+    /*Same as `lv_draw_sw_rotate()` but with the pixel size in bytes instead of the color format*/
+    lv_result_t (*rotate)(const void * src, void * dest, int32_t src_width, int32_t src_height, int32_t src_stride,
+                          int32_t dest_stride, lv_display_rotation_t rotation, uint32_t px_size);
+
+    /*Transform one line of an image. The parameters are the same as in lv_draw_sw_transform.c*/
+    lv_result_t (*transform_rgb888)(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                    int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                    int32_t x_end, uint8_t * dest_buf, bool aa, uint32_t px_size);
+    lv_result_t (*transform_argb8888)(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                      int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                      int32_t x_end, uint8_t * dest_buf, bool aa);
+    lv_result_t (*transform_rgb565a8)(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                      int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                      int32_t x_end, uint16_t * cbuf, uint8_t * abuf, bool src_has_a8, bool aa);
+    lv_result_t (*transform_a8)(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                int32_t x_end, uint8_t * abuf, bool aa);
+} lv_draw_sw_kernels_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Detect the features of the CPU and select the kernels accordingly.
+ * Called by `lv_draw_sw_init()`.
+ */
+void lv_draw_sw_kernels_init(void);
+
+/**
+ * Get the features of the CPU detected in `lv_draw_sw_init()`
+ * @return          OR-ed values of `lv_draw_sw_cpu_feature_t`
+ */
+uint32_t lv_draw_sw_get_cpu_features(void);
+
+/**
+ * Select the kernels using only the given CPU features.
+ * Useful for debugging and comparing the optimized kernels with the C implementation.
+ * Shouldn't be called while rendering.
+ * @param features  OR-ed values of `lv_draw_sw_cpu_feature_t`. Features not supported by the CPU are ignored.
+ *                  `LV_DRAW_SW_CPU_FEATURE_NONE`: use only the C implementation
+ */
+void lv_draw_sw_set_kernel_features(uint32_t features);
+
+/**
+ * Get the currently used kernels
+ * @return          pointer to the kernel table
+ */
+const lv_draw_sw_kernels_t * lv_draw_sw_get_kernels(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**
+ * Call a kernel of the table if it's set.
+ * Evaluates to `LV_RESULT_INVALID` if the kernel is not available.
+ */
+#define LV_DRAW_SW_KERNEL(name, ...) \
+    (lv_draw_sw_get_kernels()->name ? lv_draw_sw_get_kernels()->name(__VA_ARGS__) : LV_RESULT_INVALID)
+
+#endif /*LV_USE_DRAW_SW*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_KERNELS_H*/
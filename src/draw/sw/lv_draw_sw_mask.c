@@ -20,14 +20,25 @@
 /*********************
  *      DEFINES
  *********************/
-#define CIRCLE_CACHE_LIFE_MAX           1000
-#define CIRCLE_CACHE_AGING(life, r)     life = LV_MIN(life + (r < 16 ? 1 : (r >> 4)), 1000)
-#define circle_cache_mutex              LV_GLOBAL_DEFAULT()->draw_info.circle_cache_mutex
-#define _circle_cache                   LV_GLOBAL_DEFAULT()->sw_circle_cache
+#define CACHE_NAME  "SW_CIRCLE"
+#define circle_cache_p (LV_GLOBAL_DEFAULT()->sw_circle_cache)
+
+/*Size of a circle with its buffers*/
+#define CIRCLE_ITEM_SIZE(r)     (sizeof(_lv_draw_sw_mask_radius_circle_dsc_t) + (r) * 6 + 6)
+
+#if LV_DRAW_SW_CIRCLE_CACHE_MEM_SIZE
+    #define CIRCLE_CACHE_MEM_SIZE LV_DRAW_SW_CIRCLE_CACHE_MEM_SIZE
+#else
+    #define CIRCLE_CACHE_MEM_SIZE (LV_DRAW_SW_CIRCLE_CACHE_SIZE * CIRCLE_ITEM_SIZE(64))
+#endif
 
 /**********************
  *      TYPEDEFS
  **********************/
+typedef struct {
+    lv_cache_slot_size_t slot;                  /**< Size of the circle with its buffers. Must be the first field*/
+    _lv_draw_sw_mask_radius_circle_dsc_t circle; /**< Key: `circle.radius`*/
+} circle_cache_data_t;
 
 /**********************
  *  STATIC PROTOTYPES
@@ -64,6 +75,11 @@ static void circ_calc_aa4(_lv_draw_sw_mask_radius_circle_dsc_t * c, int32_t radi
 static lv_opa_t * get_next_line(_lv_draw_sw_mask_radius_circle_dsc_t * c, int32_t y, int32_t * len,
                                 int32_t * x_start);
 static inline lv_opa_t /* LV_ATTRIBUTE_FAST_MEM */ mask_mix(lv_opa_t mask_act, lv_opa_t mask_new);
+static _lv_draw_sw_mask_radius_circle_dsc_t * circle_get(int32_t radius);
+static lv_cache_compare_res_t circle_cache_compare_cb(const circle_cache_data_t * lhs,
+                                                      const circle_cache_data_t * rhs);
+static bool circle_cache_create_cb(circle_cache_data_t * data, void * user_data);
+static void circle_cache_free_cb(circle_cache_data_t * data, void * user_data);
 
 /**********************
  *  STATIC VARIABLES
@@ -79,12 +95,25 @@ static inline lv_opa_t /* LV_ATTRIBUTE_FAST_MEM */ mask_mix(lv_opa_t mask_act, l
 
 void lv_draw_sw_mask_init(void)
 {
-    lv_mutex_init(&circle_cache_mutex);
+    if(LV_DRAW_SW_CIRCLE_CACHE_SIZE == 0 || circle_cache_p != NULL) return;
+
+    /*The cache has its own lock so the draw units can share the circles*/
+    circle_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(circle_cache_data_t), CIRCLE_CACHE_MEM_SIZE, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) circle_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) circle_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) circle_cache_free_cb,
+    });
+
+    lv_cache_set_name(circle_cache_p, CACHE_NAME);
 }
 
 void lv_draw_sw_mask_deinit(void)
 {
-    lv_mutex_delete(&circle_cache_mutex);
+    if(circle_cache_p == NULL) return;
+
+    lv_cache_destroy(circle_cache_p, NULL);
+    circle_cache_p = NULL;
 }
 
 lv_draw_sw_mask_res_t LV_ATTRIBUTE_FAST_MEM lv_draw_sw_mask_apply(void * masks[], lv_opa_t * mask_buf, int32_t abs_x,
@@ -108,33 +137,25 @@ lv_draw_sw_mask_res_t LV_ATTRIBUTE_FAST_MEM lv_draw_sw_mask_apply(void * masks[]
 
 void lv_draw_sw_mask_free_param(void * p)
 {
-    lv_mutex_lock(&circle_cache_mutex);
     _lv_draw_sw_mask_common_dsc_t * pdsc = p;
     if(pdsc->type == LV_DRAW_SW_MASK_TYPE_RADIUS) {
         lv_draw_sw_mask_radius_param_t * radius_p = (lv_draw_sw_mask_radius_param_t *) p;
         if(radius_p->circle) {
-            if(radius_p->circle->life < 0) {
-                lv_free(radius_p->circle->cir_opa);
-                lv_free(radius_p->circle);
+            if(radius_p->circle->cache_entry) {
+                lv_cache_release(circle_cache_p, radius_p->circle->cache_entry, NULL);
             }
             else {
-                radius_p->circle->used_cnt--;
+                lv_free(radius_p->circle->buf);
+                lv_free(radius_p->circle);
             }
+            radius_p->circle = NULL;
         }
     }
-
-    lv_mutex_unlock(&circle_cache_mutex);
 }
 
 void _lv_draw_sw_mask_cleanup(void)
 {
-    uint8_t i;
-    for(i = 0; i < LV_DRAW_SW_CIRCLE_CACHE_SIZE; i++) {
-        if(_circle_cache[i].buf) {
-            lv_free(_circle_cache[i].buf);
-        }
-        lv_memzero(&(_circle_cache[i]), sizeof(_circle_cache[i]));
-    }
+    if(circle_cache_p) lv_cache_drop_all(circle_cache_p, NULL);
 }
 
 void lv_draw_sw_mask_line_points_init(lv_draw_sw_mask_line_param_t * param, int32_t p1x, int32_t p1y,
@@ -310,47 +331,12 @@ void lv_draw_sw_mask_radius_init(lv_draw_sw_mask_radius_param_t * param, const l
         return;
     }
 
-    lv_mutex_lock(&circle_cache_mutex);
-
-    uint32_t i;
-
-    /*Try to reuse a circle cache entry*/
-    for(i = 0; i < LV_DRAW_SW_CIRCLE_CACHE_SIZE; i++) {
-        if(_circle_cache[i].radius == radius) {
-            _circle_cache[i].used_cnt++;
-            CIRCLE_CACHE_AGING(_circle_cache[i].life, radius);
-            param->circle = &(_circle_cache[i]);
-            lv_mutex_unlock(&circle_cache_mutex);
-            return;
-        }
-    }
-
-    /*If not cached use the free entry with lowest life*/
-    _lv_draw_sw_mask_radius_circle_dsc_t * entry = NULL;
-    for(i = 0; i < LV_DRAW_SW_CIRCLE_CACHE_SIZE; i++) {
-        if(_circle_cache[i].used_cnt == 0) {
-            if(!entry) entry = &(_circle_cache[i]);
-            else if(_circle_cache[i].life < entry->life) entry = &(_circle_cache[i]);
-        }
-    }
-
-    /*There is no unused entry. Allocate one temporarily*/
-    if(!entry) {
-        entry = lv_malloc_zeroed(sizeof(_lv_draw_sw_mask_radius_circle_dsc_t));
-        LV_ASSERT_MALLOC(entry);
-        entry->life = -1;
-    }
-    else {
-        entry->used_cnt++;
-        entry->life = 0;
-        CIRCLE_CACHE_AGING(entry->life, radius);
+    param->circle = circle_get(radius);
+    if(param->circle == NULL) {
+        /*Out of memory. With 0 radius the mask callback doesn't need the circle, the corners are just not rounded*/
+        LV_LOG_WARN("couldn't allocate the circle of radius %" LV_PRId32, radius);
+        param->cfg.radius = 0;
     }
-
-    param->circle = entry;
-
-    circ_calc_aa4(param->circle, radius);
-    lv_mutex_unlock(&circle_cache_mutex);
-
 }
 
 void lv_draw_sw_mask_fade_init(lv_draw_sw_mask_fade_param_t * param, const lv_area_t * coords, lv_opa_t opa_top,
@@ -1077,6 +1063,7 @@ static void circ_calc_aa4(_lv_draw_sw_mask_radius_circle_dsc_t * c, int32_t radi
 
     c->buf = lv_malloc(radius * 6 + 6);  /*Use uint16_t for opa_start_on_y and x_start_on_y*/
     LV_ASSERT_MALLOC(c->buf);
+    if(c->buf == NULL) return;
     c->cir_opa = c->buf;
     c->opa_start_on_y = (uint16_t *)(c->buf + 2 * radius + 2);
     c->x_start_on_y = (uint16_t *)(c->buf + 4 * radius + 4);
@@ -1232,4 +1219,71 @@ static inline lv_opa_t LV_ATTRIBUTE_FAST_MEM mask_mix(lv_opa_t mask_act, lv_opa_
     return LV_UDIV255(mask_act * mask_new);
 }
 
+/**
+ * Get a circle from the cache or calculate it if it's not cached.
+ * The circle needs to be released by `lv_draw_sw_mask_free_param`
+ * @param radius    radius of the circle
+ * @return          the circle or NULL if it couldn't be allocated
+ */
+static _lv_draw_sw_mask_radius_circle_dsc_t * circle_get(int32_t radius)
+{
+    size_t req_size = CIRCLE_ITEM_SIZE(radius);
+    if(circle_cache_p && req_size <= lv_cache_get_max_size(circle_cache_p, NULL)) {
+        circle_cache_data_t search_key;
+        lv_memzero(&search_key, sizeof(search_key));
+        search_key.slot.size = req_size;
+        search_key.circle.radius = radius;
+
+        /*Calculated in `circle_cache_create_cb` if not found*/
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(circle_cache_p, &search_key, NULL);
+        if(entry) {
+            circle_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+            return &cached_data->circle;
+        }
+    }
+
+    /*Not cacheable, calculate a temporary circle*/
+    _lv_draw_sw_mask_radius_circle_dsc_t * circle = lv_malloc_zeroed(sizeof(_lv_draw_sw_mask_radius_circle_dsc_t));
+    LV_ASSERT_MALLOC(circle);
+    if(circle == NULL) return NULL;
+
+    circ_calc_aa4(circle, radius);
+    if(circle->buf == NULL) {
+        lv_free(circle);
+        return NULL;
+    }
+
+    return circle;
+}
+
+static lv_cache_compare_res_t circle_cache_compare_cb(const circle_cache_data_t * lhs,
+                                                      const circle_cache_data_t * rhs)
+{
+    if(lhs->circle.radius != rhs->circle.radius) return lhs->circle.radius > rhs->circle.radius ? 1 : -1;
+    return 0;
+}
+
+/**
+ * Calculate a circle which was not found in the cache. Called with the cache locked.
+ * @param data          the new cache entry, initialized from the search key
+ * @param user_data     unused
+ * @return              true: success, false: couldn't allocate the circle's buffer
+ */
+static bool circle_cache_create_cb(circle_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    circ_calc_aa4(&data->circle, data->circle.radius);
+    if(data->circle.buf == NULL) return false;
+
+    data->circle.cache_entry = lv_cache_entry_get_entry(data, sizeof(circle_cache_data_t));
+    return true;
+}
+
+static void circle_cache_free_cb(circle_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(data->circle.buf);
+}
+
 #endif /*LV_DRAW_SW_COMPLEX*/
@@ -17,6 +17,7 @@ extern "C" {
 #include "../../misc/lv_color.h"
 #include "../../misc/lv_math.h"
 #include "../../misc/lv_types.h"
+#include "../../misc/cache/lv_cache.h"
 
 /*********************
  *      DEFINES
@@ -133,13 +134,10 @@ typedef struct  {
     lv_opa_t * cir_opa;         /*Opacity of values on the circumference of an 1/4 circle*/
     uint16_t * x_start_on_y;        /*The x coordinate of the circle for each y value*/
     uint16_t * opa_start_on_y;      /*The index of `cir_opa` for each y value*/
-    int32_t life;               /*How many times the entry way used*/
-    uint32_t used_cnt;          /*Like a semaphore to count the referencing masks*/
+    lv_cache_entry_t * cache_entry; /*The entry in the circle cache or NULL if the circle is not cached*/
     int32_t radius;          /*The radius of the entry*/
 } _lv_draw_sw_mask_radius_circle_dsc_t;
 
-typedef _lv_draw_sw_mask_radius_circle_dsc_t _lv_draw_sw_mask_radius_circle_dsc_arr_t[LV_DRAW_SW_CIRCLE_CACHE_SIZE];
-
 typedef struct {
     /*The first element must be the common descriptor*/
     _lv_draw_sw_mask_common_dsc_t dsc;
@@ -217,8 +215,9 @@ lv_draw_sw_mask_res_t /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_mask_apply(void * m
 void lv_draw_sw_mask_free_param(void * p);
 
 /**
- * Called by LVGL the rendering of a screen is ready to clean up
- * the temporal (cache) data of the masks
+ * Drop the cached circles of the radius masks to free their memory.
+ * The circles are kept across the refreshes and dropped only in `lv_draw_sw_mask_deinit`,
+ * so LVGL doesn't call it.
  */
 void _lv_draw_sw_mask_cleanup(void);
 
@@ -60,22 +60,26 @@ void lv_draw_sw_mask_rect(lv_draw_unit_t * draw_unit, const lv_draw_mask_rect_ds
     lv_area_set(&clear_area, draw_unit->clip_area->x1, draw_unit->clip_area->y1, draw_unit->clip_area->x2,
                 dsc->area.y1 - 1);
     lv_area_move(&clear_area, -buf_area->x1, -buf_area->y1);
+    lv_draw_layer_rotate_area(target_layer, &clear_area);
     lv_draw_buf_clear(draw_buf, &clear_area);
 
     /*Clear the bottom part*/
     lv_area_set(&clear_area, draw_unit->clip_area->x1, dsc->area.y2 + 1, draw_unit->clip_area->x2,
                 draw_unit->clip_area->y2);
     lv_area_move(&clear_area, -buf_area->x1, -buf_area->y1);
+    lv_draw_layer_rotate_area(target_layer, &clear_area);
     lv_draw_buf_clear(draw_buf, &clear_area);
 
     /*Clear the left part*/
     lv_area_set(&clear_area, draw_unit->clip_area->x1, dsc->area.y1, dsc->area.x1 - 1, dsc->area.y2);
     lv_area_move(&clear_area, -buf_area->x1, -buf_area->y1);
+    lv_draw_layer_rotate_area(target_layer, &clear_area);
     lv_draw_buf_clear(draw_buf, &clear_area);
 
     /*Clear the right part*/
     lv_area_set(&clear_area, dsc->area.x2 + 1, dsc->area.y1, draw_unit->clip_area->x2, dsc->area.y2);
     lv_area_move(&clear_area, -buf_area->x1, -buf_area->y1);
+    lv_draw_layer_rotate_area(target_layer, &clear_area);
     lv_draw_buf_clear(draw_buf, &clear_area);
 
     lv_draw_sw_mask_radius_param_t param;
@@ -85,7 +89,24 @@ void lv_draw_sw_mask_rect(lv_draw_unit_t * draw_unit, const lv_draw_mask_rect_ds
     masks[0] = &param;
 
     uint32_t area_w = lv_area_get_width(&draw_area);
-    lv_opa_t * mask_buf = lv_malloc(area_w);
+    lv_opa_t * mask_buf = lv_draw_sw_scratch_alloc(draw_unit, area_w);
+
+    /*Distance of the pixels of a row in the buffer. On a rotated layer they are not next to each other.*/
+    int32_t px_step;
+    switch(target_layer->rotation) {
+        case LV_DISPLAY_ROTATION_90:
+            px_step = -(int32_t)target_layer->draw_buf->header.stride;
+            break;
+        case LV_DISPLAY_ROTATION_180:
+            px_step = -(int32_t)sizeof(lv_color32_t);
+            break;
+        case LV_DISPLAY_ROTATION_270:
+            px_step = target_layer->draw_buf->header.stride;
+            break;
+        default:
+            px_step = sizeof(lv_color32_t);
+            break;
+    }
 
     int32_t y;
     for(y = draw_area.y1; y <= draw_area.y2; y++) {
@@ -93,23 +114,28 @@ void lv_draw_sw_mask_rect(lv_draw_unit_t * draw_unit, const lv_draw_mask_rect_ds
         lv_draw_sw_mask_res_t res = lv_draw_sw_mask_apply(masks, mask_buf, draw_area.x1, y, area_w);
         if(res == LV_DRAW_SW_MASK_RES_FULL_COVER) continue;
 
-        lv_color32_t * c32_buf = lv_draw_layer_go_to_xy(target_layer, draw_area.x1 - buf_area->x1,
-                                                        y - buf_area->y1);
+        lv_area_t px_area;
+        lv_area_set(&px_area, draw_area.x1 - buf_area->x1, y - buf_area->y1, draw_area.x1 - buf_area->x1,
+                    y - buf_area->y1);
+        lv_draw_layer_rotate_area(target_layer, &px_area);
+        uint8_t * px_buf = lv_draw_layer_go_to_xy(target_layer, px_area.x1, px_area.y1);
 
-        if(res == LV_DRAW_SW_MASK_RES_TRANSP) {
-            lv_memzero(c32_buf, area_w * sizeof(lv_color32_t));
+        if(res == LV_DRAW_SW_MASK_RES_TRANSP && px_step == (int32_t)sizeof(lv_color32_t)) {
+            lv_memzero(px_buf, area_w * sizeof(lv_color32_t));
         }
         else {
+            if(res == LV_DRAW_SW_MASK_RES_TRANSP) lv_memzero(mask_buf, area_w);
             uint32_t i;
             for(i = 0; i < area_w; i++) {
                 if(mask_buf[i] != LV_OPA_COVER) {
-                    c32_buf[i].alpha = LV_OPA_MIX2(c32_buf[i].alpha, mask_buf[i]);
+                    lv_color32_t * c32 = (lv_color32_t *)(px_buf + (int32_t)i * px_step);
+                    c32->alpha = LV_OPA_MIX2(c32->alpha, mask_buf[i]);
                 }
             }
         }
     }
 
-    lv_free(mask_buf);
+    lv_draw_sw_scratch_free(draw_unit, mask_buf);
     lv_draw_sw_mask_free_param(&param);
 }
 
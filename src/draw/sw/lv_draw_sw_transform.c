@@ -37,6 +37,14 @@ typedef struct {
     lv_point_t pivot;
 } point_transform_dsc_t;
 
+/*A coordinate on the source image and its neighbor to mix with*/
+typedef struct {
+    int32_t pos;        /**< Integer coordinate on the source image*/
+    int32_t next;       /**< Direction of the neighbor: -1 or 1*/
+    int32_t fract;      /**< Weight of the neighbor in 0x00..0x7F range*/
+    bool has_next;      /**< false: the neighbor is out of the image, i.e. the pixel is on the edge*/
+} transform_coord_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -51,6 +59,111 @@ typedef struct {
 static void transform_point_upscaled(point_transform_dsc_t * t, int32_t xin, int32_t yin, int32_t * xout,
                                      int32_t * yout);
 
+/**
+ * Rotate by exactly 90, 180 or 270 degrees without scaling. Each destination pixel is copied from exactly
+ * one source pixel so the rows can be rotated by `lv_draw_sw_rotate`. Only the alpha of the pixels
+ * on the right and bottom edge of the image (and with `aa` the alpha of ARGB8888 pixels next to a different pixel)
+ * is adjusted afterwards to give the same result as the generic bilinear transformation.
+ * @param t             pointer to an initialized `point_transform_dsc_t`
+ * @param dest_area     the area to render relative to the image
+ * @param src           the source image
+ * @param src_w         width of the source image in pixels
+ * @param src_h         height of the source image in pixels
+ * @param src_stride    stride of the source image in bytes
+ * @param src_cf        color format of the source image. L8 is not supported
+ * @param dest_buf      destination buffer as in `lv_draw_sw_transform`
+ * @param alpha_buf     the alpha plane of the destination buffer for RGB565 and RGB565A8, else NULL
+ * @param aa            true: mix the pixels with their neighbors
+ */
+static void transform_rotate_exact(const point_transform_dsc_t * t, const lv_area_t * dest_area, const uint8_t * src,
+                                   int32_t src_w, int32_t src_h, int32_t src_stride, lv_color_format_t src_cf,
+                                   uint8_t * dest_buf, uint8_t * alpha_buf, bool aa);
+
+/**
+ * Set the pixels which are fully out of the image in a row of the destination buffer
+ * @param dest_row      pointer to the first pixel of the row
+ * @param alpha_row     pointer to the alpha of the first pixel of the row (in the ARGB8888 pixel or in the alpha plane)
+ * @param x1            first pixel to set
+ * @param x2            last pixel to set. Nothing happens if smaller than `x1`
+ * @param src_cf        color format of the source image
+ */
+static void transform_clear_px(uint8_t * dest_row, uint8_t * alpha_row, int32_t x1, int32_t x2,
+                               lv_color_format_t src_cf);
+
+/**
+ * Scale without rotation using a table of the X coordinates as they are the same in every row.
+ * Used only for the color formats without a SIMD kernel as the kernels are faster.
+ * @param src           the source image
+ * @param src_w         width of the source image in pixels
+ * @param src_h         height of the source image in pixels
+ * @param src_stride    stride of the source image in bytes
+ * @param src_cf        color format of the source image. L8 is not supported
+ * @param xs_ups        upscaled X coordinate of the first column on the source image
+ * @param xs_step       upscaled step on the source image for one pixel step on the destination in X
+ * @param ys_ups        upscaled Y coordinate of the first row on the source image
+ * @param ys_step       upscaled step on the source image for one pixel step on the destination in Y
+ * @param dest_w        width of the destination area
+ * @param dest_h        height of the destination area
+ * @param dest_stride   stride of the destination buffer in bytes
+ * @param dest_buf      destination buffer as in `lv_draw_sw_transform`
+ * @param alpha_buf     the alpha plane of the destination buffer for RGB565 and RGB565A8, else NULL
+ * @param x_coords      an array of `dest_w` elements to store the X coordinates
+ * @param aa            true: mix the pixels with their neighbors
+ */
+static void transform_scale(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                            lv_color_format_t src_cf, int32_t xs_ups, int32_t xs_step, int32_t ys_ups, int32_t ys_step,
+                            int32_t dest_w, int32_t dest_h, int32_t dest_stride, uint8_t * dest_buf,
+                            uint8_t * alpha_buf, transform_coord_t * x_coords, bool aa);
+
+/**
+ * Scale without rotation by an integer ratio (e.g. 0.5x, or 1x in one direction) where every destination pixel
+ * is on the center of a source pixel. The neighbors are mixed with 0 weight then, so the pixels are simply copied.
+ * Only the pixels on the right and bottom edge of the image are processed as in the generic transformation.
+ * @param src           the source image
+ * @param src_w         width of the source image in pixels
+ * @param src_h         height of the source image in pixels
+ * @param src_stride    stride of the source image in bytes
+ * @param src_cf        color format of the source image. See `transform_scale_int_is_copy`
+ * @param xs_ups        upscaled X coordinate of the first column on the source image. Its fraction must be 0x80
+ * @param xs_step       step on the source image in X in 1/65536 pixel units. Must be whole pixels
+ * @param ys_ups        upscaled Y coordinate of the first row on the source image. Its fraction must be 0x80
+ * @param ys_step       step on the source image in Y in 1/65536 pixel units. Must be whole pixels
+ * @param dest_w        width of the destination area
+ * @param dest_h        height of the destination area
+ * @param dest_stride   stride of the destination buffer in bytes
+ * @param dest_buf      destination buffer as in `lv_draw_sw_transform`
+ * @param alpha_buf     the alpha plane of the destination buffer for RGB565 and RGB565A8, else NULL
+ * @param aa            true: mix the pixels with their neighbors
+ */
+static void transform_scale_int(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                lv_color_format_t src_cf, int32_t xs_ups, int32_t xs_step, int32_t ys_ups,
+                                int32_t ys_step, int32_t dest_w, int32_t dest_h, int32_t dest_stride,
+                                uint8_t * dest_buf, uint8_t * alpha_buf, bool aa);
+
+/**
+ * Check if `transform_scale_int` can copy the pixels
+ * @param src_cf        color format of the source image
+ * @param aa            true: mix the pixels with their neighbors
+ * @return              true: the generic transformation keeps the pixels unchanged with 0 weight neighbors.
+ *                      It's not the case for ARGB8888 with `aa` as the alpha is scaled by 255/256 there.
+ */
+static bool transform_scale_int_is_copy(lv_color_format_t src_cf, bool aa);
+
+/**
+ * Check if the scaling should be done by `transform_scale`
+ * @param src_cf        color format of the source image
+ * @return              true: `transform_scale` can handle `src_cf` and there is no SIMD kernel for it
+ */
+static bool transform_scale_is_faster(lv_color_format_t src_cf);
+
+/**
+ * Get the integer position, the neighbor and the neighbor's weight from an upscaled coordinate
+ * @param c             store the result here
+ * @param ups           an upscaled coordinate on the source image. Its integer part must be on the image
+ * @param size          width or height of the source image
+ */
+static inline void transform_coord_init(transform_coord_t * c, int32_t ups, int32_t size);
+
 static void transform_rgb888(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
                              int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                              int32_t x_end, uint8_t * dest_buf, bool aa, uint32_t px_size);
@@ -67,6 +180,22 @@ static void transform_a8(const uint8_t * src, int32_t src_w, int32_t src_h, int3
                          int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                          int32_t x_end, uint8_t * abuf, bool aa);
 
+/*Transform one pixel of the image. The pointers point to the source pixel and to the destination*/
+static inline void transform_rgb888_px(const uint8_t * src_u8, int32_t src_stride, const transform_coord_t * xc,
+                                       const transform_coord_t * yc, uint32_t px_size, bool aa, lv_color32_t * dest);
+
+static inline void transform_argb8888_px(const lv_color32_t * src_c32, int32_t src_stride,
+                                         const transform_coord_t * xc, const transform_coord_t * yc, bool aa,
+                                         lv_color32_t * dest);
+
+static inline void transform_rgb565a8_px(const uint16_t * src_tmp_u16, const lv_opa_t * src_alpha_tmp,
+                                         int32_t src_stride, int32_t alpha_stride,
+                                         const transform_coord_t * xc, const transform_coord_t * yc, bool aa,
+                                         uint16_t * cbuf, uint8_t * abuf);
+
+static inline void transform_a8_px(const uint8_t * src_tmp, int32_t src_stride, const transform_coord_t * xc,
+                                   const transform_coord_t * yc, bool aa, uint8_t * abuf);
+
 static void transform_l8_to_al88(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
                                  int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                                  int32_t x_end, uint8_t * abuf, bool aa);
@@ -91,7 +220,6 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
                           int32_t src_w, int32_t src_h, int32_t src_stride,
                           const lv_draw_image_dsc_t * draw_dsc, const lv_draw_image_sup_t * sup, lv_color_format_t src_cf, void * dest_buf)
 {
-    LV_UNUSED(draw_unit);
     LV_UNUSED(sup);
 
     point_transform_dsc_t tr_dsc;
@@ -147,6 +275,14 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
     bool aa = (bool) draw_dsc->antialias;
     bool is_rotated = draw_dsc->rotation;
 
+    /*Only the normalized angles to keep the generic path available with e.g. 900 + 3600*/
+    if((draw_dsc->rotation == 900 || draw_dsc->rotation == 1800 || draw_dsc->rotation == 2700) &&
+       tr_dsc.scale_x == LV_SCALE_NONE && tr_dsc.scale_y == LV_SCALE_NONE &&
+       src_cf != LV_COLOR_FORMAT_L8) {
+        transform_rotate_exact(&tr_dsc, dest_area, src_buf, src_w, src_h, src_stride, src_cf, dest_buf, alpha_buf, aa);
+        return;
+    }
+
     int32_t xs_ups = 0, ys_ups = 0, ys_ups_start = 0, ys_step_256_original = 0;
     int32_t xs_step_256 = 0, ys_step_256 = 0;
 
@@ -188,6 +324,26 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
 
         xs_ups = xs1_ups + 0x80;
         ys_ups_start = ys1_ups + 0x80;
+
+        /*With an integer ratio downscale (e.g. 0.5x) the pixels are only copied which is faster than any kernel.
+         *Upscales (e.g. 2x) sample between the source pixels so they are mixed by the SIMD kernels
+         *or by `transform_scale` if there is no kernel for `src_cf`*/
+        if((xs_step_256 & 0xFFFF) == 0 && (ys_step_256_original & 0xFFFF) == 0 &&
+           (xs_ups & 0xFF) == 0x80 && (ys_ups_start & 0xFF) == 0x80 && transform_scale_int_is_copy(src_cf, aa)) {
+            transform_scale_int(src_buf, src_w, src_h, src_stride, src_cf, xs_ups, xs_step_256, ys_ups_start,
+                                ys_step_256_original, dest_w, dest_h, dest_stride, dest_buf, alpha_buf, aa);
+            return;
+        }
+
+        if(transform_scale_is_faster(src_cf)) {
+            transform_coord_t * x_coords = lv_draw_sw_scratch_alloc(draw_unit, dest_w * sizeof(transform_coord_t));
+            if(x_coords) {
+                transform_scale(src_buf, src_w, src_h, src_stride, src_cf, xs_ups, xs_step_256, ys_ups_start,
+                                ys_step_256_original, dest_w, dest_h, dest_stride, dest_buf, alpha_buf, x_coords, aa);
+                lv_draw_sw_scratch_free(draw_unit, x_coords);
+                return;
+            }
+        }
     }
 
     int32_t y;
@@ -259,10 +415,368 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
  *   STATIC FUNCTIONS
  **********************/
 
+static void transform_rotate_exact(const point_transform_dsc_t * t, const lv_area_t * dest_area, const uint8_t * src,
+                                   int32_t src_w, int32_t src_h, int32_t src_stride, lv_color_format_t src_cf,
+                                   uint8_t * dest_buf, uint8_t * alpha_buf, bool aa)
+{
+    /*`sinma` and `cosma` are exactly 0 or +/-1024 here*/
+    int32_t c = t->cosma / 1024;
+    int32_t s = t->sinma / 1024;
+    int32_t px = t->pivot.x;
+    int32_t py = t->pivot.y;
+    lv_display_rotation_t rotation;
+    if(c < 0) rotation = LV_DISPLAY_ROTATION_180;
+    else if(s < 0) rotation = LV_DISPLAY_ROTATION_270;
+    else rotation = LV_DISPLAY_ROTATION_90;
+
+    int32_t dest_w = lv_area_get_width(dest_area);
+    int32_t dest_h = lv_area_get_height(dest_area);
+    bool dest_32 = src_cf == LV_COLOR_FORMAT_ARGB8888 || src_cf == LV_COLOR_FORMAT_XRGB8888 ||
+                   src_cf == LV_COLOR_FORMAT_RGB888;
+    uint32_t dest_px_size = dest_32 ? 4 : (src_cf == LV_COLOR_FORMAT_A8 ? 1 : 2);
+    int32_t dest_stride = dest_w * dest_px_size;
+    /*The alpha of the destination pixels: in an A8 plane or the alpha byte of the ARGB8888 pixels*/
+    uint8_t * dest_alpha = dest_32 ? dest_buf + 3 : (src_cf == LV_COLOR_FORMAT_A8 ? dest_buf : alpha_buf);
+    int32_t alpha_px_size = dest_32 ? 4 : 1;
+    int32_t alpha_stride = dest_w * alpha_px_size;
+
+    /*The source pixels sampled by the destination area. (x, y) is transformed to
+     *(c * (x - px) - s * (y - py) + px; s * (x - px) + c * (y - py) + py) on the source*/
+    int32_t xs1 = c * (dest_area->x1 - px) - s * (dest_area->y1 - py) + px;
+    int32_t ys1 = s * (dest_area->x1 - px) + c * (dest_area->y1 - py) + py;
+    int32_t xs2 = c * (dest_area->x2 - px) - s * (dest_area->y2 - py) + px;
+    int32_t ys2 = s * (dest_area->x2 - px) + c * (dest_area->y2 - py) + py;
+    lv_area_t src_area;
+    src_area.x1 = LV_MIN(xs1, xs2);
+    src_area.y1 = LV_MIN(ys1, ys2);
+    src_area.x2 = LV_MAX(xs1, xs2);
+    src_area.y2 = LV_MAX(ys1, ys2);
+
+    lv_area_t img_area = {0, 0, src_w - 1, src_h - 1};
+    lv_area_t copy_area = {0, -1, 0, -1}; /*No rows by default*/
+    bool has_src = _lv_area_intersect(&src_area, &src_area, &img_area);
+    if(has_src) {
+        /*The destination of the sampled source pixels relative to `dest_area` (inverse transformation)*/
+        int32_t x1 = c * (src_area.x1 - px) + s * (src_area.y1 - py) + px;
+        int32_t y1 = -s * (src_area.x1 - px) + c * (src_area.y1 - py) + py;
+        int32_t x2 = c * (src_area.x2 - px) + s * (src_area.y2 - py) + px;
+        int32_t y2 = -s * (src_area.x2 - px) + c * (src_area.y2 - py) + py;
+        copy_area.x1 = LV_MIN(x1, x2) - dest_area->x1;
+        copy_area.y1 = LV_MIN(y1, y2) - dest_area->y1;
+        copy_area.x2 = LV_MAX(x1, x2) - dest_area->x1;
+        copy_area.y2 = LV_MAX(y1, y2) - dest_area->y1;
+    }
+
+    /*Clear the pixels which are fully out of the image the same way the generic transformation does*/
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < dest_h; y++) {
+        uint8_t * dest_row = dest_buf + y * dest_stride;
+        uint8_t * alpha_row = dest_alpha + y * alpha_stride;
+        if(y < copy_area.y1 || y > copy_area.y2) {
+            transform_clear_px(dest_row, alpha_row, 0, dest_w - 1, src_cf);
+        }
+        else {
+            transform_clear_px(dest_row, alpha_row, 0, copy_area.x1 - 1, src_cf);
+            transform_clear_px(dest_row, alpha_row, copy_area.x2 + 1, dest_w - 1, src_cf);
+        }
+    }
+
+    if(!has_src) return;
+
+    int32_t copy_w = lv_area_get_width(&src_area);
+    int32_t copy_h = lv_area_get_height(&src_area);
+    uint32_t src_px_size = lv_color_format_get_size(src_cf);
+    if(src_cf == LV_COLOR_FORMAT_RGB565A8) src_px_size = 2;
+    const uint8_t * src_start = src + src_area.y1 * src_stride + src_area.x1 * src_px_size;
+    uint8_t * dest_start = dest_buf + copy_area.y1 * dest_stride + copy_area.x1 * dest_px_size;
+    uint8_t * alpha_start = dest_alpha + copy_area.y1 * alpha_stride + copy_area.x1 * alpha_px_size;
+
+    /*Step on the destination when stepping right or down on the source*/
+    int32_t alpha_step_x = c * alpha_px_size - s * alpha_stride;
+    int32_t alpha_step_y = s * alpha_px_size + c * alpha_stride;
+    /*The destination of the first pixel of `src_area`*/
+    uint8_t * alpha_first = dest_alpha +
+                            (-s * (src_area.x1 - px) + c * (src_area.y1 - py) + py - dest_area->y1) * alpha_stride +
+                            (c * (src_area.x1 - px) + s * (src_area.y1 - py) + px - dest_area->x1) * alpha_px_size;
+
+    if(src_cf == LV_COLOR_FORMAT_RGB888) {
+        int32_t dest_step_x = c * 4 - s * dest_stride;
+        int32_t dest_step_y = s * 4 + c * dest_stride;
+        uint8_t * dest_row = alpha_first - 3;
+        for(y = 0; y < copy_h; y++) {
+            const uint8_t * src_px = src_start + y * src_stride;
+            uint8_t * dest_px = dest_row;
+            for(x = 0; x < copy_w; x++) {
+                dest_px[0] = src_px[0];
+                dest_px[1] = src_px[1];
+                dest_px[2] = src_px[2];
+                dest_px[3] = 0xff;
+                src_px += 3;
+                dest_px += dest_step_x;
+            }
+            dest_row += dest_step_y;
+        }
+    }
+    else {
+        lv_color_format_t rotate_cf = src_cf == LV_COLOR_FORMAT_RGB565A8 ? LV_COLOR_FORMAT_RGB565 : src_cf;
+        lv_draw_sw_rotate(src_start, dest_start, copy_w, copy_h, src_stride, dest_stride, rotation, rotate_cf);
+    }
+
+    if(src_cf == LV_COLOR_FORMAT_RGB565A8) {
+        const uint8_t * src_alpha = src + src_stride * src_h + src_area.y1 * (src_stride / 2) + src_area.x1;
+        lv_draw_sw_rotate(src_alpha, alpha_start, copy_w, copy_h, src_stride / 2, alpha_stride, rotation,
+                          LV_COLOR_FORMAT_A8);
+    }
+    else if(src_cf == LV_COLOR_FORMAT_RGB565 || src_cf == LV_COLOR_FORMAT_XRGB8888) {
+        int32_t copy_dest_w = lv_area_get_width(&copy_area);
+        int32_t copy_dest_h = lv_area_get_height(&copy_area);
+        for(y = 0; y < copy_dest_h; y++) {
+            uint8_t * a = alpha_start + y * alpha_stride;
+            for(x = 0; x < copy_dest_w; x++) {
+                *a = 0xff;
+                a += alpha_px_size;
+            }
+        }
+    }
+
+    /*The generic transformation samples the middle of the source pixels.
+     *In this case it mixes the right and bottom neighbors with 0 weight which can change only the alpha*/
+    int32_t x_last = src_area.x2 == src_w - 1 ? copy_w - 1 : copy_w;
+    int32_t y_last = src_area.y2 == src_h - 1 ? copy_h - 1 : copy_h;
+    if(src_cf == LV_COLOR_FORMAT_ARGB8888 && aa) {
+        for(y = 0; y < y_last; y++) {
+            const lv_color32_t * src_c32 = (const lv_color32_t *)(src_start + y * src_stride);
+            uint8_t * a = alpha_first + y * alpha_step_y;
+            for(x = 0; x < x_last; x++) {
+                lv_color32_t px_c = src_c32[x];
+                lv_color32_t px_ver = *(const lv_color32_t *)((const uint8_t *)&src_c32[x] + src_stride);
+                lv_color32_t px_hor = src_c32[x + 1];
+                if(px_ver.alpha == 0 || !lv_color32_eq(px_c, px_ver)) px_c.alpha = (px_c.alpha * 0xFF) >> 8;
+                if(px_hor.alpha == 0 || !lv_color32_eq(px_c, px_hor)) px_c.alpha = (px_c.alpha * 0xFF) >> 8;
+                *a = px_c.alpha;
+                a += alpha_step_x;
+            }
+        }
+    }
+
+    /*The pixels in the last column and row of the image are on the edge*/
+    if(x_last != copy_w) {
+        uint8_t * a = alpha_first + x_last * alpha_step_x;
+        for(y = 0; y < copy_h; y++) {
+            *a = src_cf == LV_COLOR_FORMAT_ARGB8888 ? (*a * 0x7F) >> 7 : (*a * 0xFF) >> 8;
+            a += alpha_step_y;
+        }
+    }
+    if(y_last != copy_h) {
+        uint8_t * a = alpha_first + y_last * alpha_step_y;
+        for(x = 0; x < x_last; x++) {
+            *a = src_cf == LV_COLOR_FORMAT_ARGB8888 ? (*a * 0x7F) >> 7 : (*a * 0xFF) >> 8;
+            a += alpha_step_x;
+        }
+    }
+}
+
+static void transform_clear_px(uint8_t * dest_row, uint8_t * alpha_row, int32_t x1, int32_t x2,
+                               lv_color_format_t src_cf)
+{
+    if(x1 > x2) return;
+
+    if(src_cf == LV_COLOR_FORMAT_ARGB8888) {
+        lv_memzero(dest_row + x1 * 4, (x2 - x1 + 1) * 4);
+    }
+    else if(src_cf == LV_COLOR_FORMAT_XRGB8888 || src_cf == LV_COLOR_FORMAT_RGB888) {
+        int32_t x;
+        for(x = x1; x <= x2; x++) alpha_row[x * 4] = 0x00;
+    }
+    else {
+        lv_memzero(alpha_row + x1, x2 - x1 + 1);
+    }
+}
+
+static void transform_scale(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                            lv_color_format_t src_cf, int32_t xs_ups, int32_t xs_step, int32_t ys_ups, int32_t ys_step,
+                            int32_t dest_w, int32_t dest_h, int32_t dest_stride, uint8_t * dest_buf,
+                            uint8_t * alpha_buf, transform_coord_t * x_coords, bool aa)
+{
+    /*The X coordinates are the same in every row*/
+    int32_t x;
+    for(x = 0; x < dest_w; x++) {
+        int32_t ups = xs_ups + ((xs_step * x) >> 8);
+        if((ups >> 8) < 0 || (ups >> 8) >= src_w) {
+            x_coords[x].pos = -1;
+            continue;
+        }
+        transform_coord_init(&x_coords[x], ups, src_w);
+    }
+
+    uint32_t px_size = lv_color_format_get_size(src_cf);
+    if(src_cf == LV_COLOR_FORMAT_RGB565A8) px_size = 2;
+    int32_t alpha_stride = src_stride / 2;
+    const lv_opa_t * src_alpha = src_cf == LV_COLOR_FORMAT_RGB565A8 ? src + src_stride * src_h : NULL;
+
+    int32_t y;
+    for(y = 0; y < dest_h; y++) {
+        int32_t ys = ys_ups + ((ys_step * y) >> 8);
+        int32_t ys_int = ys >> 8;
+        bool row_out = ys_int < 0 || ys_int >= src_h;
+        transform_coord_t yc;
+        if(!row_out) transform_coord_init(&yc, ys, src_h);
+        const uint8_t * src_row = src + ys_int * src_stride;
+
+        lv_color32_t * dest_c32 = (lv_color32_t *)dest_buf;
+        switch(src_cf) {
+            case LV_COLOR_FORMAT_ARGB8888:
+                for(x = 0; x < dest_w; x++) {
+                    if(row_out || x_coords[x].pos < 0) {
+                        ((uint32_t *)dest_buf)[x] = 0x00000000;
+                        continue;
+                    }
+                    transform_argb8888_px((const lv_color32_t *)src_row + x_coords[x].pos, src_stride, &x_coords[x],
+                                          &yc, aa, &dest_c32[x]);
+                }
+                break;
+            case LV_COLOR_FORMAT_XRGB8888:
+            case LV_COLOR_FORMAT_RGB888:
+                for(x = 0; x < dest_w; x++) {
+                    if(row_out || x_coords[x].pos < 0) {
+                        dest_c32[x].alpha = 0x00;
+                        continue;
+                    }
+                    transform_rgb888_px(src_row + x_coords[x].pos * px_size, src_stride, &x_coords[x], &yc, px_size, aa,
+                                        &dest_c32[x]);
+                }
+                break;
+            case LV_COLOR_FORMAT_RGB565:
+            case LV_COLOR_FORMAT_RGB565A8:
+                for(x = 0; x < dest_w; x++) {
+                    if(row_out || x_coords[x].pos < 0) {
+                        alpha_buf[x] = 0x00;
+                        continue;
+                    }
+                    transform_rgb565a8_px((const uint16_t *)src_row + x_coords[x].pos,
+                                          src_alpha ? src_alpha + ys_int * alpha_stride + x_coords[x].pos : NULL,
+                                          src_stride, alpha_stride, &x_coords[x], &yc, aa, &((uint16_t *)dest_buf)[x],
+                                          &alpha_buf[x]);
+                }
+                break;
+            case LV_COLOR_FORMAT_A8:
+                for(x = 0; x < dest_w; x++) {
+                    if(row_out || x_coords[x].pos < 0) {
+                        dest_buf[x] = 0x00;
+                        continue;
+                    }
+                    transform_a8_px(src_row + x_coords[x].pos, src_stride, &x_coords[x], &yc, aa, &dest_buf[x]);
+                }
+                break;
+            default:
+                break;
+        }
+
+        dest_buf += dest_stride;
+        if(alpha_buf) alpha_buf += dest_w;
+    }
+}
+
+static void transform_scale_int(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                lv_color_format_t src_cf, int32_t xs_ups, int32_t xs_step, int32_t ys_ups,
+                                int32_t ys_step, int32_t dest_w, int32_t dest_h, int32_t dest_stride,
+                                uint8_t * dest_buf, uint8_t * alpha_buf, bool aa)
+{
+    int32_t xs_int = xs_ups >> 8;
+    int32_t xs_step_int = xs_step >> 16;
+    int32_t ys_step_int = ys_step >> 16;
+    uint32_t px_size = lv_color_format_get_size(src_cf);
+    if(src_cf == LV_COLOR_FORMAT_RGB565A8) px_size = 2;
+    int32_t alpha_stride = src_stride / 2;
+    const lv_opa_t * src_alpha = src_cf == LV_COLOR_FORMAT_RGB565A8 ? src + src_stride * src_h : NULL;
+
+    int32_t y;
+    for(y = 0; y < dest_h; y++) {
+        int32_t ys_int = (ys_ups >> 8) + ys_step_int * y;
+        bool row_out = ys_int < 0 || ys_int >= src_h;
+        transform_coord_t yc;
+        if(!row_out) transform_coord_init(&yc, (ys_int << 8) + 0x80, src_h);
+        const uint8_t * src_row = src + ys_int * src_stride;
+        lv_color32_t * dest_c32 = (lv_color32_t *)dest_buf;
+        uint8_t * alpha_row = alpha_buf ? alpha_buf : (src_cf == LV_COLOR_FORMAT_A8 ? dest_buf : dest_buf + 3);
+
+        int32_t x;
+        for(x = 0; x < dest_w; x++) {
+            int32_t pos = xs_int + xs_step_int * x;
+            if(row_out || pos < 0 || pos >= src_w) {
+                transform_clear_px(dest_buf, alpha_row, x, x, src_cf);
+                continue;
+            }
+
+            const uint8_t * src_px = src_row + pos * px_size;
+
+            /*On the edge the neighbor is out of the image which makes the pixel more transparent*/
+            if(pos == src_w - 1 || !yc.has_next) {
+                transform_coord_t xc;
+                transform_coord_init(&xc, (pos << 8) + 0x80, src_w);
+                switch(src_cf) {
+                    case LV_COLOR_FORMAT_ARGB8888:
+                        transform_argb8888_px((const lv_color32_t *)src_px, src_stride, &xc, &yc, aa, &dest_c32[x]);
+                        break;
+                    case LV_COLOR_FORMAT_XRGB8888:
+                    case LV_COLOR_FORMAT_RGB888:
+                        transform_rgb888_px(src_px, src_stride, &xc, &yc, px_size, aa, &dest_c32[x]);
+                        break;
+                    case LV_COLOR_FORMAT_RGB565:
+                    case LV_COLOR_FORMAT_RGB565A8:
+                        transform_rgb565a8_px((const uint16_t *)src_px,
+                                              src_alpha ? src_alpha + ys_int * alpha_stride + pos : NULL,
+                                              src_stride, alpha_stride, &xc, &yc, aa, &((uint16_t *)dest_buf)[x],
+                                              &alpha_buf[x]);
+                        break;
+                    case LV_COLOR_FORMAT_A8:
+                        transform_a8_px(src_px, src_stride, &xc, &yc, aa, &dest_buf[x]);
+                        break;
+                    default:
+                        break;
+                }
+                continue;
+            }
+
+            switch(src_cf) {
+                case LV_COLOR_FORMAT_ARGB8888:
+                    dest_c32[x] = *(const lv_color32_t *)src_px;
+                    break;
+                case LV_COLOR_FORMAT_XRGB8888:
+                case LV_COLOR_FORMAT_RGB888:
+                    dest_c32[x].blue = src_px[0];
+                    dest_c32[x].green = src_px[1];
+                    dest_c32[x].red = src_px[2];
+                    dest_c32[x].alpha = 0xff;
+                    break;
+                case LV_COLOR_FORMAT_RGB565:
+                case LV_COLOR_FORMAT_RGB565A8:
+                    ((uint16_t *)dest_buf)[x] = *(const uint16_t *)src_px;
+                    alpha_buf[x] = src_alpha ? src_alpha[ys_int * alpha_stride + pos] : 0xff;
+                    break;
+                case LV_COLOR_FORMAT_A8:
+                    dest_buf[x] = src_px[0];
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        dest_buf += dest_stride;
+        if(alpha_buf) alpha_buf += dest_w;
+    }
+}
+
 static void transform_rgb888(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
                              int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                              int32_t x_end, uint8_t * dest_buf, bool aa, uint32_t px_size)
 {
+    if(LV_DRAW_SW_KERNEL(transform_rgb888, src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, ys_step,
+                         x_end, dest_buf, aa, px_size) == LV_RESULT_OK) {
+        return;
+    }
+
     int32_t xs_ups_start = xs_ups;
     int32_t ys_ups_start = ys_ups;
     lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
@@ -281,76 +795,57 @@ static void transform_rgb888(const uint8_t * src, int32_t src_w, int32_t src_h,
             continue;
         }
 
-        /*Get the direction the hor and ver neighbor
-         *`fract` will be in range of 0x00..0xFF and `next` (+/-1) indicates the direction*/
-        int32_t xs_fract = xs_ups & 0xFF;
-        int32_t ys_fract = ys_ups & 0xFF;
+        transform_coord_t xc;
+        transform_coord_t yc;
+        transform_coord_init(&xc, xs_ups, src_w);
+        transform_coord_init(&yc, ys_ups, src_h);
+        transform_rgb888_px(&src[ys_int * src_stride + xs_int * px_size], src_stride, &xc, &yc, px_size, aa,
+                            &dest_c32[x]);
+    }
+}
 
-        int32_t x_next;
-        int32_t y_next;
-        if(xs_fract < 0x80) {
-            x_next = -1;
-            xs_fract = 0x7F - xs_fract;
-        }
-        else {
-            x_next = 1;
-            xs_fract = xs_fract - 0x80;
-        }
-        if(ys_fract < 0x80) {
-            y_next = -1;
-            ys_fract = 0x7F - ys_fract;
-        }
-        else {
-            y_next = 1;
-            ys_fract = ys_fract - 0x80;
+static inline void transform_rgb888_px(const uint8_t * src_u8, int32_t src_stride, const transform_coord_t * xc,
+                                       const transform_coord_t * yc, uint32_t px_size, bool aa, lv_color32_t * dest)
+{
+    dest->red = src_u8[2];
+    dest->green = src_u8[1];
+    dest->blue = src_u8[0];
+    dest->alpha = 0xff;
+
+    if(aa && xc->has_next && yc->has_next) {
+        const uint8_t * px_hor_u8 = src_u8 + (int32_t)(xc->next * px_size);
+        lv_color32_t px_hor;
+        px_hor.red = px_hor_u8[2];
+        px_hor.green = px_hor_u8[1];
+        px_hor.blue = px_hor_u8[0];
+        px_hor.alpha = 0xff;
+
+        const uint8_t * px_ver_u8 = src_u8 + (int32_t)(yc->next * src_stride);
+        lv_color32_t px_ver;
+        px_ver.red = px_ver_u8[2];
+        px_ver.green = px_ver_u8[1];
+        px_ver.blue = px_ver_u8[0];
+        px_ver.alpha = 0xff;
+
+        if(!lv_color32_eq(*dest, px_ver)) {
+            px_ver.alpha = yc->fract;
+            *dest = lv_color_mix32(px_ver, *dest);
         }
 
-        const uint8_t * src_u8 = &src[ys_int * src_stride + xs_int * px_size];
-
-        dest_c32[x].red = src_u8[2];
-        dest_c32[x].green = src_u8[1];
-        dest_c32[x].blue = src_u8[0];
-        dest_c32[x].alpha = 0xff;
-
-        if(aa &&
-           xs_int + x_next >= 0 &&
-           xs_int + x_next <= src_w - 1 &&
-           ys_int + y_next >= 0 &&
-           ys_int + y_next <= src_h - 1) {
-            const uint8_t * px_hor_u8 = src_u8 + (int32_t)(x_next * px_size);
-            lv_color32_t px_hor;
-            px_hor.red = px_hor_u8[2];
-            px_hor.green = px_hor_u8[1];
-            px_hor.blue = px_hor_u8[0];
-            px_hor.alpha = 0xff;
-
-            const uint8_t * px_ver_u8 = src_u8 + (int32_t)(y_next * src_stride);
-            lv_color32_t px_ver;
-            px_ver.red = px_ver_u8[2];
-            px_ver.green = px_ver_u8[1];
-            px_ver.blue = px_ver_u8[0];
-            px_ver.alpha = 0xff;
-
-            if(!lv_color32_eq(dest_c32[x], px_ver)) {
-                px_ver.alpha = ys_fract;
-                dest_c32[x] = lv_color_mix32(px_ver, dest_c32[x]);
-            }
-
-            if(!lv_color32_eq(dest_c32[x], px_hor)) {
-                px_hor.alpha = xs_fract;
-                dest_c32[x] = lv_color_mix32(px_hor, dest_c32[x]);
-            }
+        if(!lv_color32_eq(*dest, px_hor)) {
+            px_hor.alpha = xc->fract;
+            *dest = lv_color_mix32(px_hor, *dest);
         }
-        /*Partially out of the image*/
-        else {
-            lv_opa_t a = 0xff;
+    }
+    /*Partially out of the image*/
+    else {
+        lv_opa_t a = 0xff;
 
-            if((xs_int == 0 && x_next < 0) || (xs_int == src_w - 1 && x_next > 0))  {
-                dest_c32[x].alpha = (a * (0xFF - xs_fract)) >> 8;
-            }
-            else if((ys_int == 0 && y_next < 0) || (ys_int == src_h - 1 && y_next > 0))  {
-                dest_c32[x].alpha = (a * (0xFF - ys_fract)) >> 8;
-            }
+        if(!xc->has_next)  {
+            dest->alpha = (a * (0xFF - xc->fract)) >> 8;
+        }
+        else if(!yc->has_next)  {
+            dest->alpha = (a * (0xFF - yc->fract)) >> 8;
         }
     }
 }
@@ -359,6 +854,11 @@ static void transform_argb8888(const uint8_t * src, int32_t src_w, int32_t src_h
                                int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                                int32_t x_end, uint8_t * dest_buf, bool aa)
 {
+    if(LV_DRAW_SW_KERNEL(transform_argb8888, src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, ys_step,
+                         x_end, dest_buf, aa) == LV_RESULT_OK) {
+        return;
+    }
+
     int32_t xs_ups_start = xs_ups;
     int32_t ys_ups_start = ys_ups;
     lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
@@ -377,69 +877,52 @@ static void transform_argb8888(const uint8_t * src, int32_t src_w, int32_t src_h
             continue;
         }
 
-        /*Get the direction the hor and ver neighbor
-         *`fract` will be in range of 0x00..0xFF and `next` (+/-1) indicates the direction*/
-        int32_t xs_fract = xs_ups & 0xFF;
-        int32_t ys_fract = ys_ups & 0xFF;
+        transform_coord_t xc;
+        transform_coord_t yc;
+        transform_coord_init(&xc, xs_ups, src_w);
+        transform_coord_init(&yc, ys_ups, src_h);
+        transform_argb8888_px((const lv_color32_t *)(src + ys_int * src_stride + xs_int * 4), src_stride, &xc, &yc, aa,
+                              &dest_c32[x]);
+    }
+}
 
-        int32_t x_next;
-        int32_t y_next;
-        if(xs_fract < 0x80) {
-            x_next = -1;
-            xs_fract = 0x7F - xs_fract;
+static inline void transform_argb8888_px(const lv_color32_t * src_c32, int32_t src_stride,
+                                         const transform_coord_t * xc, const transform_coord_t * yc, bool aa,
+                                         lv_color32_t * dest)
+{
+    *dest = src_c32[0];
+
+    if(aa && xc->has_next && yc->has_next) {
+        int32_t xs_fract = xc->fract;
+        int32_t ys_fract = yc->fract;
+        lv_color32_t px_hor = src_c32[xc->next];
+        lv_color32_t px_ver = *(const lv_color32_t *)((uint8_t *)src_c32 + yc->next * src_stride);
+
+        if(px_ver.alpha == 0) {
+            dest->alpha = (dest->alpha * (0xFF - ys_fract)) >> 8;
         }
-        else {
-            x_next = 1;
-            xs_fract = xs_fract - 0x80;
+        else if(!lv_color32_eq(*dest, px_ver)) {
+            dest->alpha = ((px_ver.alpha * ys_fract) + (dest->alpha * (0xFF - ys_fract))) >> 8;
+            px_ver.alpha = ys_fract;
+            *dest = lv_color_mix32(px_ver, *dest);
         }
-        if(ys_fract < 0x80) {
-            y_next = -1;
-            ys_fract = 0x7F - ys_fract;
+
+        if(px_hor.alpha == 0) {
+            dest->alpha = (dest->alpha * (0xFF - xs_fract)) >> 8;
         }
-        else {
-            y_next = 1;
-            ys_fract = ys_fract - 0x80;
+        else if(!lv_color32_eq(*dest, px_hor)) {
+            dest->alpha = ((px_hor.alpha * xs_fract) + (dest->alpha * (0xFF - xs_fract))) >> 8;
+            px_hor.alpha = xs_fract;
+            *dest = lv_color_mix32(px_hor, *dest);
         }
-
-        const lv_color32_t * src_c32 = (const lv_color32_t *)(src + ys_int * src_stride + xs_int * 4);
-
-        dest_c32[x] = src_c32[0];
-
-        if(aa &&
-           xs_int + x_next >= 0 &&
-           xs_int + x_next <= src_w - 1 &&
-           ys_int + y_next >= 0 &&
-           ys_int + y_next <= src_h - 1) {
-
-            lv_color32_t px_hor = src_c32[x_next];
-            lv_color32_t px_ver = *(const lv_color32_t *)((uint8_t *)src_c32 + y_next * src_stride);
-
-            if(px_ver.alpha == 0) {
-                dest_c32[x].alpha = (dest_c32[x].alpha * (0xFF - ys_fract)) >> 8;
-            }
-            else if(!lv_color32_eq(dest_c32[x], px_ver)) {
-                dest_c32[x].alpha = ((px_ver.alpha * ys_fract) + (dest_c32[x].alpha * (0xFF - ys_fract))) >> 8;
-                px_ver.alpha = ys_fract;
-                dest_c32[x] = lv_color_mix32(px_ver, dest_c32[x]);
-            }
-
-            if(px_hor.alpha == 0) {
-                dest_c32[x].alpha = (dest_c32[x].alpha * (0xFF - xs_fract)) >> 8;
-            }
-            else if(!lv_color32_eq(dest_c32[x], px_hor)) {
-                dest_c32[x].alpha = ((px_hor.alpha * xs_fract) + (dest_c32[x].alpha * (0xFF - xs_fract))) >> 8;
-                px_hor.alpha = xs_fract;
-                dest_c32[x] = lv_color_mix32(px_hor, dest_c32[x]);
-            }
+    }
+    /*Partially out of the image*/
+    else {
+        if(!xc->has_next)  {
+            dest->alpha = (dest->alpha * (0x7F - xc->fract)) >> 7;
         }
-        /*Partially out of the image*/
-        else {
-            if((xs_int == 0 && x_next < 0) || (xs_int == src_w - 1 && x_next > 0))  {
-                dest_c32[x].alpha = (dest_c32[x].alpha * (0x7F - xs_fract)) >> 7;
-            }
-            else if((ys_int == 0 && y_next < 0) || (ys_int == src_h - 1 && y_next > 0))  {
-                dest_c32[x].alpha = (dest_c32[x].alpha * (0x7F - ys_fract)) >> 7;
-            }
+        else if(!yc->has_next)  {
+            dest->alpha = (dest->alpha * (0x7F - yc->fract)) >> 7;
         }
     }
 }
@@ -448,6 +931,11 @@ static void transform_rgb565a8(const uint8_t * src, int32_t src_w, int32_t src_h
                                int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                                int32_t x_end, uint16_t * cbuf, uint8_t * abuf, bool src_has_a8, bool aa)
 {
+    if(LV_DRAW_SW_KERNEL(transform_rgb565a8, src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, ys_step,
+                         x_end, cbuf, abuf, src_has_a8, aa) == LV_RESULT_OK) {
+        return;
+    }
+
     int32_t xs_ups_start = xs_ups;
     int32_t ys_ups_start = ys_ups;
 
@@ -470,87 +958,64 @@ static void transform_rgb565a8(const uint8_t * src, int32_t src_w, int32_t src_h
             continue;
         }
 
-        /*Get the direction the hor and ver neighbor
-         *`fract` will be in range of 0x00..0xFF and `next` (+/-1) indicates the direction*/
-        int32_t xs_fract = xs_ups & 0xFF;
-        int32_t ys_fract = ys_ups & 0xFF;
+        transform_coord_t xc;
+        transform_coord_t yc;
+        transform_coord_init(&xc, xs_ups, src_w);
+        transform_coord_init(&yc, ys_ups, src_h);
+        transform_rgb565a8_px((const uint16_t *)(src + (ys_int * src_stride) + xs_int * 2),
+                              src_has_a8 ? src_alpha + (ys_int * alpha_stride) + xs_int : NULL,
+                              src_stride, alpha_stride, &xc, &yc, aa, &cbuf[x], &abuf[x]);
+    }
+}
 
-        int32_t x_next;
-        int32_t y_next;
-        if(xs_fract < 0x80) {
-            x_next = -1;
-            xs_fract = (0x7F - xs_fract) * 2;
-        }
-        else {
-            x_next = 1;
-            xs_fract = (xs_fract - 0x80) * 2;
-        }
-        if(ys_fract < 0x80) {
-            y_next = -1;
-            ys_fract = (0x7F - ys_fract) * 2;
-        }
-        else {
-            y_next = 1;
-            ys_fract = (ys_fract - 0x80) * 2;
-        }
+static inline void transform_rgb565a8_px(const uint16_t * src_tmp_u16, const lv_opa_t * src_alpha_tmp,
+                                         int32_t src_stride, int32_t alpha_stride,
+                                         const transform_coord_t * xc, const transform_coord_t * yc, bool aa,
+                                         uint16_t * cbuf, uint8_t * abuf)
+{
+    int32_t xs_fract = xc->fract * 2;
+    int32_t ys_fract = yc->fract * 2;
 
-        const uint16_t * src_tmp_u16 = (const uint16_t *)(src + (ys_int * src_stride) + xs_int * 2);
-        cbuf[x] = src_tmp_u16[0];
+    *cbuf = src_tmp_u16[0];
 
-        if(aa &&
-           xs_int + x_next >= 0 &&
-           xs_int + x_next <= src_w - 1 &&
-           ys_int + y_next >= 0 &&
-           ys_int + y_next <= src_h - 1) {
+    if(aa && xc->has_next && yc->has_next) {
+        uint16_t px_hor = src_tmp_u16[xc->next];
+        uint16_t px_ver = *(const uint16_t *)((uint8_t *)src_tmp_u16 + (yc->next * src_stride));
 
-            uint16_t px_hor = src_tmp_u16[x_next];
-            uint16_t px_ver = *(const uint16_t *)((uint8_t *)src_tmp_u16 + (y_next * src_stride));
+        if(src_alpha_tmp) {
+            *abuf = src_alpha_tmp[0];
 
-            if(src_has_a8) {
-                const lv_opa_t * src_alpha_tmp = src_alpha;
-                src_alpha_tmp += (ys_int * alpha_stride) + xs_int;
-                abuf[x] = src_alpha_tmp[0];
+            lv_opa_t a_hor = src_alpha_tmp[xc->next];
+            lv_opa_t a_ver = src_alpha_tmp[yc->next * alpha_stride];
 
-                lv_opa_t a_hor = src_alpha_tmp[x_next];
-                lv_opa_t a_ver = src_alpha_tmp[y_next * alpha_stride];
+            if(a_ver != *abuf) a_ver = ((a_ver * ys_fract) + (*abuf * (0x100 - ys_fract))) >> 8;
+            if(a_hor != *abuf) a_hor = ((a_hor * xs_fract) + (*abuf * (0x100 - xs_fract))) >> 8;
+            *abuf = (a_ver + a_hor) >> 1;
 
-                if(a_ver != abuf[x]) a_ver = ((a_ver * ys_fract) + (abuf[x] * (0x100 - ys_fract))) >> 8;
-                if(a_hor != abuf[x]) a_hor = ((a_hor * xs_fract) + (abuf[x] * (0x100 - xs_fract))) >> 8;
-                abuf[x] = (a_ver + a_hor) >> 1;
+            if(*abuf == 0x00) return;
+        }
+        else {
+            *abuf = 0xff;
+        }
 
-                if(abuf[x] == 0x00) continue;
-            }
-            else {
-                abuf[x] = 0xff;
-            }
+        if(*cbuf != px_ver || *cbuf != px_hor) {
+            uint16_t v = lv_color_16_16_mix(px_ver, *cbuf, ys_fract);
+            uint16_t h = lv_color_16_16_mix(px_hor, *cbuf, xs_fract);
+            *cbuf = lv_color_16_16_mix(h, v, LV_OPA_50);
+        }
+    }
+    /*Partially out of the image*/
+    else {
+        lv_opa_t a = src_alpha_tmp ? src_alpha_tmp[0] : 0xff;
 
-            if(cbuf[x] != px_ver || cbuf[x] != px_hor) {
-                uint16_t v = lv_color_16_16_mix(px_ver, cbuf[x], ys_fract);
-                uint16_t h = lv_color_16_16_mix(px_hor, cbuf[x], xs_fract);
-                cbuf[x] = lv_color_16_16_mix(h, v, LV_OPA_50);
-            }
+        if(!xc->has_next)  {
+            *abuf = (a * (0xFF - xs_fract)) >> 8;
+        }
+        else if(!yc->has_next)  {
+            *abuf = (a * (0xFF - ys_fract)) >> 8;
         }
-        /*Partially out of the image*/
         else {
-            lv_opa_t a;
-            if(src_has_a8) {
-                const lv_opa_t * src_alpha_tmp = src_alpha;
-                src_alpha_tmp += (ys_int * alpha_stride) + xs_int;
-                a = src_alpha_tmp[0];
-            }
-            else {
-                a = 0xff;
-            }
-
-            if((xs_int == 0 && x_next < 0) || (xs_int == src_w - 1 && x_next > 0))  {
-                abuf[x] = (a * (0xFF - xs_fract)) >> 8;
-            }
-            else if((ys_int == 0 && y_next < 0) || (ys_int == src_h - 1 && y_next > 0))  {
-                abuf[x] = (a * (0xFF - ys_fract)) >> 8;
-            }
-            else {
-                abuf[x] = a;
-            }
+            *abuf = a;
         }
     }
 }
@@ -559,6 +1024,11 @@ static void transform_a8(const uint8_t * src, int32_t src_w, int32_t src_h, int3
                          int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                          int32_t x_end, uint8_t * abuf, bool aa)
 {
+    if(LV_DRAW_SW_KERNEL(transform_a8, src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, ys_step,
+                         x_end, abuf, aa) == LV_RESULT_OK) {
+        return;
+    }
+
     int32_t xs_ups_start = xs_ups;
     int32_t ys_ups_start = ys_ups;
 
@@ -576,55 +1046,37 @@ static void transform_a8(const uint8_t * src, int32_t src_w, int32_t src_h, int3
             continue;
         }
 
-        /*Get the direction the hor and ver neighbor
-         *`fract` will be in range of 0x00..0xFF and `next` (+/-1) indicates the direction*/
-        int32_t xs_fract = xs_ups & 0xFF;
-        int32_t ys_fract = ys_ups & 0xFF;
-
-        int32_t x_next;
-        int32_t y_next;
-        if(xs_fract < 0x80) {
-            x_next = -1;
-            xs_fract = (0x7F - xs_fract) * 2;
-        }
-        else {
-            x_next = 1;
-            xs_fract = (xs_fract - 0x80) * 2;
-        }
-        if(ys_fract < 0x80) {
-            y_next = -1;
-            ys_fract = (0x7F - ys_fract) * 2;
-        }
-        else {
-            y_next = 1;
-            ys_fract = (ys_fract - 0x80) * 2;
-        }
+        transform_coord_t xc;
+        transform_coord_t yc;
+        transform_coord_init(&xc, xs_ups, src_w);
+        transform_coord_init(&yc, ys_ups, src_h);
+        transform_a8_px(src + ys_int * src_stride + xs_int, src_stride, &xc, &yc, aa, &abuf[x]);
+    }
+}
 
-        const uint8_t * src_tmp = src;
-        src_tmp += ys_int * src_stride + xs_int;
-        abuf[x] = src_tmp[0];
+static inline void transform_a8_px(const uint8_t * src_tmp, int32_t src_stride, const transform_coord_t * xc,
+                                   const transform_coord_t * yc, bool aa, uint8_t * abuf)
+{
+    int32_t xs_fract = xc->fract * 2;
+    int32_t ys_fract = yc->fract * 2;
 
-        if(aa &&
-           xs_int + x_next >= 0 &&
-           xs_int + x_next <= src_w - 1 &&
-           ys_int + y_next >= 0 &&
-           ys_int + y_next <= src_h - 1) {
+    *abuf = src_tmp[0];
 
-            lv_opa_t a_ver = src_tmp[x_next];
-            lv_opa_t a_hor = src_tmp[y_next * src_stride];
+    if(aa && xc->has_next && yc->has_next) {
+        lv_opa_t a_ver = src_tmp[xc->next];
+        lv_opa_t a_hor = src_tmp[yc->next * src_stride];
 
-            if(a_ver != abuf[x]) a_ver = ((a_ver * ys_fract) + (abuf[x] * (0x100 - ys_fract))) >> 8;
-            if(a_hor != abuf[x]) a_hor = ((a_hor * xs_fract) + (abuf[x] * (0x100 - xs_fract))) >> 8;
-            abuf[x] = (a_ver + a_hor) >> 1;
+        if(a_ver != *abuf) a_ver = ((a_ver * ys_fract) + (*abuf * (0x100 - ys_fract))) >> 8;
+        if(a_hor != *abuf) a_hor = ((a_hor * xs_fract) + (*abuf * (0x100 - xs_fract))) >> 8;
+        *abuf = (a_ver + a_hor) >> 1;
+    }
+    else {
+        /*Partially out of the image*/
+        if(!xc->has_next)  {
+            *abuf = (src_tmp[0] * (0xFF - xs_fract)) >> 8;
         }
-        else {
-            /*Partially out of the image*/
-            if((xs_int == 0 && x_next < 0) || (xs_int == src_w - 1 && x_next > 0))  {
-                abuf[x] = (src_tmp[0] * (0xFF - xs_fract)) >> 8;
-            }
-            else if((ys_int == 0 && y_next < 0) || (ys_int == src_h - 1 && y_next > 0))  {
-                abuf[x] = (src_tmp[0] * (0xFF - ys_fract)) >> 8;
-            }
+        else if(!yc->has_next)  {
+            *abuf = (src_tmp[0] * (0xFF - ys_fract)) >> 8;
         }
     }
 }
@@ -782,6 +1234,58 @@ static void transform_l8_to_argb8888(const uint8_t * src, int32_t src_w, int32_t
     }
 }
 
+static bool transform_scale_int_is_copy(lv_color_format_t src_cf, bool aa)
+{
+    switch(src_cf) {
+        case LV_COLOR_FORMAT_ARGB8888:
+            return !aa;
+        case LV_COLOR_FORMAT_XRGB8888:
+        case LV_COLOR_FORMAT_RGB888:
+        case LV_COLOR_FORMAT_RGB565:
+        case LV_COLOR_FORMAT_RGB565A8:
+        case LV_COLOR_FORMAT_A8:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool transform_scale_is_faster(lv_color_format_t src_cf)
+{
+    /*The SIMD kernels are faster as they transform several pixels at once*/
+    const lv_draw_sw_kernels_t * kernels = lv_draw_sw_get_kernels();
+    switch(src_cf) {
+        case LV_COLOR_FORMAT_ARGB8888:
+            return kernels->transform_argb8888 == NULL;
+        case LV_COLOR_FORMAT_XRGB8888:
+        case LV_COLOR_FORMAT_RGB888:
+            return kernels->transform_rgb888 == NULL;
+        case LV_COLOR_FORMAT_RGB565:
+        case LV_COLOR_FORMAT_RGB565A8:
+            return kernels->transform_rgb565a8 == NULL;
+        case LV_COLOR_FORMAT_A8:
+            return kernels->transform_a8 == NULL;
+        default:
+            return false;
+    }
+}
+
+static inline void transform_coord_init(transform_coord_t * c, int32_t ups, int32_t size)
+{
+    /*`fract` will be in range of 0x00..0x7F and `next` (+/-1) indicates the direction*/
+    int32_t fract = ups & 0xFF;
+    c->pos = ups >> 8;
+    if(fract < 0x80) {
+        c->next = -1;
+        c->fract = 0x7F - fract;
+    }
+    else {
+        c->next = 1;
+        c->fract = fract - 0x80;
+    }
+    c->has_next = c->pos + c->next >= 0 && c->pos + c->next <= size - 1;
+}
+
 static void transform_point_upscaled(point_transform_dsc_t * t, int32_t xin, int32_t yin, int32_t * xout,
                                      int32_t * yout)
 {
@@ -118,7 +118,7 @@ void lv_draw_sw_triangle(lv_draw_unit_t * draw_unit, const lv_draw_triangle_dsc_
     masks[1] = &mask_right;
     masks[2] = &mask_bottom;
     int32_t area_w = lv_area_get_width(&draw_area);
-    lv_opa_t * mask_buf = lv_malloc(area_w);
+    lv_opa_t * mask_buf = lv_draw_sw_scratch_alloc(draw_unit, area_w);
 
     lv_area_t blend_area = draw_area;
     blend_area.y2 = blend_area.y1;
@@ -174,7 +174,7 @@ void lv_draw_sw_triangle(lv_draw_unit_t * draw_unit, const lv_draw_triangle_dsc_
         lv_draw_sw_blend(draw_unit, &blend_dsc);
     }
 
-    lv_free(mask_buf);
+    lv_draw_sw_scratch_free(draw_unit, mask_buf);
     lv_draw_sw_mask_free_param(&mask_bottom);
     lv_draw_sw_mask_free_param(&mask_left);
     lv_draw_sw_mask_free_param(&mask_right);
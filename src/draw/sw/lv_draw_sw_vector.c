@@ -37,6 +37,11 @@ typedef struct {
     uint8_t a;
 } _tvg_color;
 
+typedef struct {
+    Tvg_Canvas * canvas;
+    Tvg_Paint * scene;  /**< If not NULL the paints are added to this scene which rotates them like the layer*/
+} _tvg_target;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -49,6 +54,12 @@ typedef struct {
  *      MACROS
  **********************/
 
+static void _push_paint(_tvg_target * target, Tvg_Paint * paint)
+{
+    if(target->scene) tvg_scene_push(target->scene, paint);
+    else tvg_canvas_push(target->canvas, paint);
+}
+
 static void _lv_area_to_tvg(_tvg_rect * rect, const lv_area_t * area)
 {
     rect->x = area->x1;
@@ -288,7 +299,7 @@ static void _set_paint_fill_gradient(Tvg_Paint * obj, const lv_vector_gradient_t
     }
 }
 
-static void _set_paint_fill_pattern(Tvg_Paint * obj, Tvg_Canvas * canvas, const lv_draw_image_dsc_t * p,
+static void _set_paint_fill_pattern(Tvg_Paint * obj, _tvg_target * target, const lv_draw_image_dsc_t * p,
                                     const lv_matrix_t * m)
 {
     lv_image_decoder_dsc_t decoder_dsc;
@@ -324,11 +335,11 @@ static void _set_paint_fill_pattern(Tvg_Paint * obj, Tvg_Canvas * canvas, const
     Tvg_Matrix mtx;
     _lv_matrix_to_tvg(&mtx, m);
     tvg_paint_set_transform(img, &mtx);
-    tvg_canvas_push(canvas, img);
+    _push_paint(target, img);
     lv_image_decoder_close(&decoder_dsc);
 }
 
-static void _set_paint_fill(Tvg_Paint * obj, Tvg_Canvas * canvas, const lv_vector_fill_dsc_t * dsc,
+static void _set_paint_fill(Tvg_Paint * obj, _tvg_target * target, const lv_vector_fill_dsc_t * dsc,
                             const lv_matrix_t * matrix)
 {
     tvg_shape_set_fill_rule(obj, _lv_fill_rule_to_tvg(dsc->fill_rule));
@@ -346,7 +357,7 @@ static void _set_paint_fill(Tvg_Paint * obj, Tvg_Canvas * canvas, const lv_vecto
         lv_memcpy(&imx, matrix, sizeof(lv_matrix_t));
         lv_matrix_translate(&imx, x, y);
         lv_matrix_multiply(&imx, &dsc->matrix);
-        _set_paint_fill_pattern(obj, canvas, &dsc->img_dsc, &imx);
+        _set_paint_fill_pattern(obj, target, &dsc->img_dsc, &imx);
     }
     else if(dsc->style == LV_VECTOR_DRAW_STYLE_GRADIENT) {
         _set_paint_fill_gradient(obj, &dsc->gradient, &dsc->matrix);
@@ -383,7 +394,7 @@ static void _set_paint_blend_mode(Tvg_Paint * obj, lv_vector_blend_t blend)
 
 static void _task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_vector_draw_dsc_t * dsc)
 {
-    Tvg_Canvas * canvas = (Tvg_Canvas *)ctx;
+    _tvg_target * target = (_tvg_target *)ctx;
 
     Tvg_Paint * obj = tvg_shape_new();
 
@@ -410,12 +421,12 @@ static void _task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_ve
 
         _set_paint_shape(obj, path);
 
-        _set_paint_fill(obj, canvas, &dsc->fill_dsc, &dsc->matrix);
+        _set_paint_fill(obj, target, &dsc->fill_dsc, &dsc->matrix);
         _set_paint_stroke(obj, &dsc->stroke_dsc);
         _set_paint_blend_mode(obj, dsc->blend_mode);
     }
 
-    tvg_canvas_push(canvas, obj);
+    _push_paint(target, obj);
 }
 
 /**********************
@@ -445,17 +456,54 @@ void lv_draw_sw_vector(lv_draw_unit_t * draw_unit, const lv_draw_vector_task_dsc
     int32_t width = lv_area_get_width(&layer->buf_area);
     int32_t height = lv_area_get_height(&layer->buf_area);
     uint32_t stride = draw_buf->header.stride;
-    Tvg_Canvas * canvas = tvg_swcanvas_create();
-    tvg_swcanvas_set_target(canvas, buf, stride / 4, width, height, TVG_COLORSPACE_ARGB8888);
+    _tvg_target target = {0};
+    target.canvas = tvg_swcanvas_create();
+
+    /*Draw in a scene which rotates the paints to the orientation of the layer's buffer*/
+    Tvg_Matrix rot_mtx = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+    switch(layer->rotation) {
+        case LV_DISPLAY_ROTATION_90:
+            rot_mtx.e12 = 1.0f;
+            rot_mtx.e21 = -1.0f;
+            rot_mtx.e23 = (float)width;
+            break;
+        case LV_DISPLAY_ROTATION_180:
+            rot_mtx.e11 = -1.0f;
+            rot_mtx.e13 = (float)width;
+            rot_mtx.e22 = -1.0f;
+            rot_mtx.e23 = (float)height;
+            break;
+        case LV_DISPLAY_ROTATION_270:
+            rot_mtx.e12 = -1.0f;
+            rot_mtx.e13 = (float)height;
+            rot_mtx.e21 = 1.0f;
+            break;
+        default:
+            break;
+    }
+
+    if(layer->rotation != LV_DISPLAY_ROTATION_0) {
+        target.scene = tvg_scene_new();
+        tvg_paint_set_transform(target.scene, &rot_mtx);
+    }
+
+    if(layer->rotation == LV_DISPLAY_ROTATION_90 || layer->rotation == LV_DISPLAY_ROTATION_270) {
+        tvg_swcanvas_set_target(target.canvas, buf, stride / 4, height, width, TVG_COLORSPACE_ARGB8888);
+    }
+    else {
+        tvg_swcanvas_set_target(target.canvas, buf, stride / 4, width, height, TVG_COLORSPACE_ARGB8888);
+    }
 
     lv_ll_t * task_list = dsc->task_list;
-    _lv_vector_for_each_destroy_tasks(task_list, _task_draw_cb, canvas);
+    _lv_vector_for_each_destroy_tasks(task_list, _task_draw_cb, &target);
+
+    if(target.scene) tvg_canvas_push(target.canvas, target.scene);
 
-    if(tvg_canvas_draw(canvas) == TVG_RESULT_SUCCESS) {
-        tvg_canvas_sync(canvas);
+    if(tvg_canvas_draw(target.canvas) == TVG_RESULT_SUCCESS) {
+        tvg_canvas_sync(target.canvas);
     }
 
-    tvg_canvas_destroy(canvas);
+    tvg_canvas_destroy(target.canvas);
 }
 
 /**********************
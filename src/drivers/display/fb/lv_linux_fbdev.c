@@ -270,8 +270,10 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * colo
 
     lv_display_rotation_t rotation = lv_display_get_rotation(disp);
 
-    /* Not all framebuffer kernel drivers support hardware rotation, so we need to handle it in software here */
-    if(rotation != LV_DISPLAY_ROTATION_0 && LV_LINUX_FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_PARTIAL) {
+    /* Not all framebuffer kernel drivers support hardware rotation, so we need to handle it in software here
+     * unless LVGL has already rendered it rotated */
+    if(rotation != LV_DISPLAY_ROTATION_0 && LV_LINUX_FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_PARTIAL &&
+       !lv_display_get_render_rotated(disp)) {
         /* (Re)allocate temporary buffer if needed */
         size_t buf_size = w * h * px_size;
         if(!dsc->rotated_buf || dsc->rotated_buf_size != buf_size) {
@@ -223,7 +223,8 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_m
         lv_display_rotation_t rotation = lv_display_get_rotation(disp);
         uint32_t px_size = lv_color_format_get_size(cf);
 
-        if(rotation != LV_DISPLAY_ROTATION_0) {
+        /*Nothing to do if LVGL has already rendered it rotated*/
+        if(rotation != LV_DISPLAY_ROTATION_0 && !lv_display_get_render_rotated(disp)) {
             int32_t w = lv_area_get_width(area);
             int32_t h = lv_area_get_height(area);
             uint32_t w_stride = lv_draw_buf_width_to_stride(w, cf);
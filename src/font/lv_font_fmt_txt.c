@@ -13,7 +13,9 @@
 #include "../misc/lv_types.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_utils.h"
+#include "../misc/cache/lv_cache.h"
 #include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
 
 /*********************
  *      DEFINES
@@ -22,6 +24,12 @@
     #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#define font_glyph_cache LV_GLOBAL_DEFAULT()->font_fmt_txt_cache
+#define font_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->font_draw_buf_handlers)
+
+/*Size of a cached glyph with its bitmap*/
+#define GLYPH_ITEM_SIZE(w, h)   (sizeof(lv_draw_buf_t) + lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_A8) * (h))
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -30,6 +38,13 @@ typedef struct {
     uint32_t gid_right;
 } kern_pair_ref_t;
 
+typedef struct {
+    lv_cache_slot_size_t slot;              /**< Size of the glyph with its bitmap. Must be the first field*/
+    const lv_font_fmt_txt_dsc_t * fdsc;     /**< Key 1. Not the font as the copies of a font share it*/
+    uint32_t gid;                           /**< Key 2*/
+    lv_draw_buf_t * draw_buf;               /**< The A8 bitmap of the glyph*/
+} glyph_cache_data_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -38,6 +53,11 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
 static int32_t unicode_list_compare(const void * ref, const void * element);
 static int32_t kern_pair_8_compare(const void * ref, const void * element);
 static int32_t kern_pair_16_compare(const void * ref, const void * element);
+static void unpack_glyph(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                         uint8_t * bitmap_out);
+static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs);
+static bool glyph_cache_create_cb(glyph_cache_data_t * data, void * user_data);
+static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data);
 
 #if LV_USE_FONT_COMPRESSED
     static void decompress(const uint8_t * in, uint8_t * out, int32_t w, int32_t h, uint8_t bpp, bool prefilter);
@@ -75,10 +95,60 @@ static const uint8_t opa2_table[4] = {0, 85, 170, 255};
  *   GLOBAL FUNCTIONS
  **********************/
 
+void _lv_font_fmt_txt_init(void)
+{
+    if(LV_FONT_FMT_TXT_CACHE_SIZE == 0 || font_glyph_cache != NULL) return;
+
+    /*Limited by the size of the unpacked bitmaps as a large glyph needs many times more memory than a small one*/
+    font_glyph_cache = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(glyph_cache_data_t), LV_FONT_FMT_TXT_CACHE_SIZE, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) glyph_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) glyph_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) glyph_cache_free_cb,
+    });
+
+    lv_cache_set_name(font_glyph_cache, "FONT_FMT_TXT");
+}
+
+void _lv_font_fmt_txt_deinit(void)
+{
+    if(font_glyph_cache == NULL) return;
+
+    lv_cache_destroy(font_glyph_cache, NULL);
+    font_glyph_cache = NULL;
+}
+
+void lv_font_fmt_txt_cache_drop(const lv_font_t * font)
+{
+    if(font_glyph_cache == NULL) return;
+
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    glyph_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.fdsc = fdsc;
+
+    /*Drop the glyphs which can be reached via the character maps*/
+    uint16_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        bool sparse = cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY || cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL;
+        uint32_t cnt = sparse ? cmap->list_length : cmap->range_length;
+        uint32_t j;
+        for(j = 0; j < cnt; j++) {
+            const void * ofs_list = cmap->glyph_id_ofs_list;
+            uint32_t ofs = j;
+            if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) ofs = ((const uint8_t *)ofs_list)[j];
+            else if(cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) ofs = ((const uint16_t *)ofs_list)[j];
+
+            search_key.gid = cmap->glyph_id_start + ofs;
+            lv_cache_drop(font_glyph_cache, &search_key, NULL);
+        }
+    }
+}
+
 const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf)
 {
     const lv_font_t * font = g_dsc->resolved_font;
-    uint8_t * bitmap_out = draw_buf->data;
 
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
     uint32_t gid = g_dsc->gid.index;
@@ -89,6 +159,104 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
     int32_t gsize = (int32_t) gdsc->box_w * gdsc->box_h;
     if(gsize == 0) return NULL;
 
+#if !LV_USE_FONT_COMPRESSED
+    if(fdsc->bitmap_format != LV_FONT_FMT_TXT_PLAIN) {
+        LV_LOG_WARN("Compressed fonts is used but LV_USE_FONT_COMPRESSED is not enabled in lv_conf.h");
+        return NULL;
+    }
+#endif
+
+    /*A tab is drawn wider than the bitmap of the space, so it's not cached*/
+    size_t req_size = GLYPH_ITEM_SIZE(gdsc->box_w, gdsc->box_h);
+    if(font_glyph_cache && g_dsc->box_w == gdsc->box_w && req_size <= lv_cache_get_max_size(font_glyph_cache, NULL)) {
+        glyph_cache_data_t search_key;
+        lv_memzero(&search_key, sizeof(search_key));
+        search_key.slot.size = req_size;
+        search_key.fdsc = fdsc;
+        search_key.gid = gid;
+
+        /*Unpacked in `glyph_cache_create_cb` if not found*/
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(font_glyph_cache, &search_key, NULL);
+        if(entry) {
+            g_dsc->entry = entry;
+            return ((glyph_cache_data_t *)lv_cache_entry_get_data(entry))->draw_buf;
+        }
+    }
+
+    /*Not cached, unpack to the provided draw buffer*/
+    unpack_glyph(fdsc, gdsc, draw_buf->data);
+    return draw_buf;
+}
+
+void lv_font_fmt_txt_release_glyph(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc)
+{
+    LV_UNUSED(font);
+
+    if(g_dsc->entry == NULL) return;
+
+    lv_cache_release(font_glyph_cache, g_dsc->entry, NULL);
+    g_dsc->entry = NULL;
+}
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
+                                   uint32_t unicode_letter_next)
+{
+    /*It fixes a strange compiler optimization issue: https://github.com/lvgl/lvgl/issues/4370*/
+    bool is_tab = unicode_letter == '\t';
+    if(is_tab) {
+        unicode_letter = ' ';
+    }
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
+    if(!gid) return false;
+
+    int8_t kvalue = 0;
+    if(fdsc->kern_dsc) {
+        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
+        if(gid_next) {
+            kvalue = get_kern_value(font, gid, gid_next);
+        }
+    }
+
+    /*Put together a glyph dsc*/
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+
+    int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
+
+    uint32_t adv_w = gdsc->adv_w;
+    if(is_tab) adv_w *= 2;
+
+    adv_w += kv;
+    adv_w  = (adv_w + (1 << 3)) >> 4;
+
+    dsc_out->adv_w = adv_w;
+    dsc_out->box_h = gdsc->box_h;
+    dsc_out->box_w = gdsc->box_w;
+    dsc_out->ofs_x = gdsc->ofs_x;
+    dsc_out->ofs_y = gdsc->ofs_y;
+    dsc_out->format = (uint8_t)fdsc->bpp;
+    dsc_out->is_placeholder = false;
+    dsc_out->gid.index = gid;
+    dsc_out->entry = NULL;
+
+    if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
+
+    return true;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Convert the bitmap of a glyph to A8
+ * @param fdsc          the font's descriptor
+ * @param gdsc          the glyph's descriptor
+ * @param bitmap_out    store the A8 bitmap here. Its stride is the A8 stride of `gdsc->box_w`
+ */
+static void unpack_glyph(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                         uint8_t * bitmap_out)
+{
     if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
         const uint8_t * bitmap_in = &fdsc->glyph_bitmap[gdsc->bitmap_index];
         uint8_t * bitmap_out_tmp = bitmap_out;
@@ -146,7 +314,6 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
                 bitmap_out_tmp += stride;
             }
         }
-        return draw_buf;
     }
     /*Handle compressed bitmap*/
     else {
@@ -154,65 +321,45 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
         bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED;
         decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], bitmap_out, gdsc->box_w, gdsc->box_h,
                    (uint8_t)fdsc->bpp, prefilter);
-        return draw_buf;
-#else /*!LV_USE_FONT_COMPRESSED*/
-        LV_LOG_WARN("Compressed fonts is used but LV_USE_FONT_COMPRESSED is not enabled in lv_conf.h");
-        return NULL;
 #endif
     }
-
-    /*If not returned earlier then the letter is not found in this font*/
-    return NULL;
 }
 
-bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
-                                   uint32_t unicode_letter_next)
+static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs)
 {
-    /*It fixes a strange compiler optimization issue: https://github.com/lvgl/lvgl/issues/4370*/
-    bool is_tab = unicode_letter == '\t';
-    if(is_tab) {
-        unicode_letter = ' ';
-    }
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
-    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
-    if(!gid) return false;
-
-    int8_t kvalue = 0;
-    if(fdsc->kern_dsc) {
-        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
-        if(gid_next) {
-            kvalue = get_kern_value(font, gid, gid_next);
-        }
-    }
-
-    /*Put together a glyph dsc*/
-    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
-
-    int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
-
-    uint32_t adv_w = gdsc->adv_w;
-    if(is_tab) adv_w *= 2;
+    if(lhs->fdsc != rhs->fdsc) return lhs->fdsc > rhs->fdsc ? 1 : -1;
+    if(lhs->gid != rhs->gid) return lhs->gid > rhs->gid ? 1 : -1;
+    return 0;
+}
 
-    adv_w += kv;
-    adv_w  = (adv_w + (1 << 3)) >> 4;
+/**
+ * Unpack a glyph which was not found in the cache. Called with the cache locked,
+ * which also protects the global state of the RLE decompression.
+ * @param data          the new cache entry, initialized from the search key
+ * @param user_data     unused
+ * @return              true: success, false: couldn't allocate the bitmap
+ */
+static bool glyph_cache_create_cb(glyph_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
 
-    dsc_out->adv_w = adv_w;
-    dsc_out->box_h = gdsc->box_h;
-    dsc_out->box_w = gdsc->box_w;
-    dsc_out->ofs_x = gdsc->ofs_x;
-    dsc_out->ofs_y = gdsc->ofs_y;
-    dsc_out->format = (uint8_t)fdsc->bpp;
-    dsc_out->is_placeholder = false;
-    dsc_out->gid.index = gid;
+    const lv_font_fmt_txt_dsc_t * fdsc = data->fdsc;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[data->gid];
+    uint32_t stride = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8);
 
-    if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
+    data->draw_buf = lv_draw_buf_create_user(font_draw_buf_handlers, gdsc->box_w, gdsc->box_h, LV_COLOR_FORMAT_A8,
+                                             stride);
+    if(data->draw_buf == NULL) return false;
 
+    unpack_glyph(fdsc, gdsc, data->draw_buf->data);
     return true;
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_draw_buf_destroy_user(font_draw_buf_handlers, data->draw_buf);
+}
 
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 {
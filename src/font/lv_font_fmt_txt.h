@@ -212,6 +212,23 @@ typedef struct {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Create the cache of the unpacked glyph bitmaps. Called by `lv_init`.
+ */
+void _lv_font_fmt_txt_init(void);
+
+/**
+ * Free the cache of the unpacked glyph bitmaps. Called by `lv_deinit`.
+ */
+void _lv_font_fmt_txt_deinit(void);
+
+/**
+ * Drop the cached glyph bitmaps of a font. Needs to be called before the descriptor of a font is freed,
+ * as its glyphs are identified by the descriptor's address. `lv_binfont_destroy` calls it.
+ * @param font      pointer to a font in lvgl's native format
+ */
+void lv_font_fmt_txt_cache_drop(const lv_font_t * font);
+
 /**
  * Used as `get_glyph_bitmap` callback in lvgl's native font format if the font is uncompressed.
  * @param g_dsc         the glyph descriptor including which font to use, which supply the glyph_index and format.
@@ -220,6 +237,15 @@ typedef struct {
  */
 const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf);
 
+/**
+ * Used as `release_glyph` callback in lvgl's native font format.
+ * Releases the cached bitmap returned by `lv_font_get_bitmap_fmt_txt`.
+ * Fonts without `release_glyph` but with `lv_font_get_bitmap_fmt_txt` are released by this function too.
+ * @param font      pointer to font
+ * @param g_dsc     the glyph descriptor passed to `lv_font_get_bitmap_fmt_txt`
+ */
+void lv_font_fmt_txt_release_glyph(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc);
+
 /**
  * Used as `get_glyph_dsc` callback in lvgl's native font format if the font is uncompressed.
  * @param font pointer to font
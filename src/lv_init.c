@@ -96,10 +96,6 @@ static inline void lv_global_init(lv_global_t * global)
     global->event_last_register_id = _LV_EVENT_LAST;
     lv_rand_set_seed(0x1234ABCD);
 
-#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    global->sw_shadow_cache.cache_size = -1;
-    global->sw_shadow_cache.cache_r = -1;
-#endif
 }
 
 static inline void _lv_cleanup_devices(lv_global_t * global)
@@ -167,6 +163,8 @@ void lv_init(void)
 
     lv_draw_init();
 
+    _lv_font_fmt_txt_init();
+
 #if LV_USE_DRAW_SW
     lv_draw_sw_init();
 #endif
@@ -388,6 +386,8 @@ void lv_deinit(void)
 
     lv_draw_deinit();
 
+    _lv_font_fmt_txt_deinit();
+
     _lv_group_deinit();
 
     _lv_anim_core_deinit();
@@ -123,6 +123,7 @@ lv_result_t lv_snapshot_take_to_draw_buf(lv_obj_t * obj, lv_color_format_t cf, l
         lv_draw_dispatch_wait_for_request();
         lv_draw_dispatch_layer(NULL, &layer);
     }
+    lv_draw_layer_deinit(&layer);
 
     disp_new->layer_head = layer_old;
     _lv_refr_set_disp_refreshing(disp_old);
@@ -199,6 +199,15 @@ static void perf_update_timer_cb(lv_timer_t * t)
                                                                      info->measured.flush_in_render_elaps_sum) /
                                                                     info->measured.render_cnt) : 0;
 
+#if LV_DRAW_CULL_OCCLUDED_TASKS
+    lv_draw_cull_monitor_t cull_mon;
+    lv_draw_cull_monitor(&cull_mon);
+    info->calculated.culled_px_avg = info->measured.render_cnt ? ((cull_mon.culled_px_cnt -
+                                                                   info->measured.culled_px_cnt_start) /
+                                                                  info->measured.render_cnt) : 0;
+    info->measured.culled_px_cnt_start = cull_mon.culled_px_cnt;
+#endif
+
     info->calculated.cpu_avg_total = ((info->calculated.cpu_avg_total * (info->calculated.run_cnt - 1)) +
                                       info->calculated.cpu) / info->calculated.run_cnt;
     info->calculated.fps_avg_total = ((info->calculated.fps_avg_total * (info->calculated.run_cnt - 1)) +
@@ -209,6 +218,7 @@ static void perf_update_timer_cb(lv_timer_t * t)
     lv_sysmon_perf_info_t prev_info = *info;
     lv_memzero(info, sizeof(lv_sysmon_perf_info_t));
     info->measured.refr_start = prev_info.measured.refr_start;
+    info->measured.culled_px_cnt_start = prev_info.measured.culled_px_cnt_start;
     info->calculated.cpu_avg_total = prev_info.calculated.cpu_avg_total;
     info->calculated.fps_avg_total = prev_info.calculated.fps_avg_total;
     info->calculated.run_cnt = prev_info.calculated.run_cnt;
@@ -226,10 +236,23 @@ static void perf_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
     LV_LOG("sysmon: "
            "%" LV_PRIu32 " FPS (refr_cnt: %" LV_PRIu32 " | redraw_cnt: %" LV_PRIu32"), "
            "refr %" LV_PRIu32 "ms (render %" LV_PRIu32 "ms | flush %" LV_PRIu32 "ms), "
-           "CPU %" LV_PRIu32 "%%\n",
+           "CPU %" LV_PRIu32 "%%, "
+           "culled %" LV_PRIu32 " px/render\n",
            perf->calculated.fps, perf->measured.refr_cnt, perf->measured.render_cnt,
            perf->calculated.refr_avg_time, perf->calculated.render_avg_time, perf->calculated.flush_avg_time,
-           perf->calculated.cpu);
+           perf->calculated.cpu, perf->calculated.culled_px_avg);
+#else
+#if LV_DRAW_CULL_OCCLUDED_TASKS
+    lv_label_set_text_fmt(
+        label,
+        "%" LV_PRIu32" FPS, %" LV_PRIu32 "%% CPU\n"
+        "%" LV_PRIu32" ms (%" LV_PRIu32" | %" LV_PRIu32")\n"
+        "%" LV_PRIu32" px culled",
+        perf->calculated.fps, perf->calculated.cpu,
+        perf->calculated.render_avg_time + perf->calculated.flush_avg_time,
+        perf->calculated.render_avg_time, perf->calculated.flush_avg_time,
+        perf->calculated.culled_px_avg
+    );
 #else
     lv_label_set_text_fmt(
         label,
@@ -239,6 +262,7 @@ static void perf_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
         perf->calculated.render_avg_time + perf->calculated.flush_avg_time,
         perf->calculated.render_avg_time, perf->calculated.flush_avg_time
     );
+#endif
 #endif /*LV_USE_PERF_MONITOR_LOG_MODE*/
 }
 
@@ -57,6 +57,7 @@ typedef struct {
         uint32_t flush_not_in_render_start;
         uint32_t flush_not_in_render_elaps_sum;
         uint32_t last_report_timestamp;
+        uint32_t culled_px_cnt_start;   /*Value of the cumulative culled pixel count at the last report*/
         uint32_t render_in_progress : 1;
     } measured;
 
@@ -66,6 +67,7 @@ typedef struct {
         uint32_t refr_avg_time;
         uint32_t render_avg_time;       /**< Pure rendering time without flush time*/
         uint32_t flush_avg_time;        /**< Pure flushing time without rendering time*/
+        uint32_t culled_px_avg;         /**< Pixels per rendering not rendered due to `LV_DRAW_CULL_OCCLUDED_TASKS`*/
         uint32_t cpu_avg_total;
         uint32_t fps_avg_total;
         uint32_t run_cnt;
@@ -369,11 +369,16 @@ void lv_canvas_init_layer(lv_obj_t * obj, lv_layer_t * layer)
 
 void lv_canvas_finish_layer(lv_obj_t * canvas, lv_layer_t * layer)
 {
-    if(layer->draw_task_head == NULL) return;
+    if(layer->draw_task_head == NULL) {
+        lv_draw_layer_deinit(layer);
+        return;
+    }
+
     while(layer->draw_task_head) {
         lv_draw_dispatch_wait_for_request();
         lv_draw_dispatch_layer(lv_obj_get_display(canvas), layer);
     }
+    lv_draw_layer_deinit(layer);
     lv_obj_invalidate(canvas);
 }
 
@@ -0,0 +1,630 @@
+/**
+ * @file lv_perf.c
+ * Micro-benchmarks of the software renderer.
+ * The kernels are called directly (without objects, styles and draw tasks) over a matrix of
+ * sizes, color formats, opacities and masks, and the results are printed as JSON.
+ * The dispatcher is measured separately with a growing number of draw tasks.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lvgl.h"
+#include "src/draw/sw/lv_draw_sw.h"
+#include "lv_perf_common.h"
+#include "src/draw/sw/lv_draw_sw_mask.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MAX_W               480
+#define MAX_H               272
+#define SHADOW_MAX_WIDTH    64
+#define DEST_W              (MAX_W + 2 * SHADOW_MAX_WIDTH)
+#define DEST_H              (MAX_H + 2 * SHADOW_MAX_WIDTH)
+#define PANEL_W             1280    /*Size of a full display rotated on flush*/
+#define PANEL_H             800
+
+#define DEFAULT_MIN_TIME_MS 20
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    const char * kernel;            /**< Name of the benchmarked function group*/
+    const char * variant;           /**< Kernel specific parameters, e.g. "rot30" or "radius16"*/
+    lv_color_format_t dest_cf;
+    lv_color_format_t src_cf;       /**< `LV_COLOR_FORMAT_UNKNOWN` if there is no source image*/
+    int32_t w;                      /**< Width of the processed area*/
+    int32_t h;                      /**< Height of the processed area*/
+    lv_opa_t opa;
+    bool mask;
+    int32_t param;                  /**< Kernel specific parameter*/
+} perf_case_t;
+
+typedef void (*perf_cb_t)(const perf_case_t * c);
+
+typedef struct {
+    lv_draw_unit_t draw_unit;
+    lv_layer_t layer;
+    lv_area_t clip_area;
+    lv_draw_buf_t * dest;           /**< Destination buffer of the blending and the shadows*/
+    uint8_t * src;                  /**< Source image, large enough for `MAX_W x MAX_H` pixels in any format*/
+    uint8_t * tr_buf;               /**< Output of the transformations*/
+    lv_opa_t * mask;                /**< Mask for `MAX_W x MAX_H` pixels*/
+    const char * filter;
+    uint32_t min_time_ms;
+    uint32_t case_cnt;
+    FILE * out;
+} perf_state_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void bench_blend_fill(void);
+static void bench_blend_image(void);
+static void bench_blend_mode(void);
+static void bench_transform(void);
+static void bench_box_shadow(void);
+static void bench_mask(void);
+static void bench_rotate(void);
+static void bench_dispatch(void);
+static void run_case(const perf_case_t * c, perf_cb_t cb);
+static void set_dest(lv_color_format_t cf);
+static void blend_cb(const perf_case_t * c);
+static void transform_cb(const perf_case_t * c);
+static void box_shadow_cb(const perf_case_t * c);
+static void mask_cb(const perf_case_t * c);
+static void rotate_cb(const perf_case_t * c);
+static void dispatch_cb(const perf_case_t * c);
+static const char * cf_to_str(lv_color_format_t cf);
+static void print_usage(const char * prog);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static perf_state_t state;
+
+static const lv_color_format_t dest_cfs[] = {
+    LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB888, LV_COLOR_FORMAT_XRGB8888, LV_COLOR_FORMAT_ARGB8888
+};
+
+static const lv_color_format_t src_cfs[] = {
+    LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB888, LV_COLOR_FORMAT_XRGB8888, LV_COLOR_FORMAT_ARGB8888
+};
+
+/*Small areas show the per-call overhead, large ones the throughput of the inner loops*/
+static const lv_point_t sizes[] = {{8, 8}, {64, 64}, {MAX_W, MAX_H}};
+
+/*Opacity and mask combinations handled by separate code paths of the blend functions*/
+static const struct {
+    lv_opa_t opa;
+    bool mask;
+} opa_masks[] = {{LV_OPA_COVER, false}, {LV_OPA_50, false}, {LV_OPA_COVER, true}, {LV_OPA_50, true}};
+
+/*Rotation in 0.1 degree and scale in 1/256 units. Selected by `perf_case_t::param`*/
+static const struct {
+    const char * name;
+    int32_t rotation;
+    int32_t scale;
+} transforms[] = {
+    {"rot30", 300, LV_SCALE_NONE}, {"scale150", 0, 384}, {"scale50", 0, 128}, {"rot30_scale150", 300, 384},
+    {"rot90", 900, LV_SCALE_NONE}, {"scale200", 0, 512},
+};
+
+/*Selected by `perf_case_t::param`*/
+static const struct {
+    const char * name;
+    int32_t width;
+    int32_t radius;
+} shadows[] = {
+    {"w8_r0", 8, 0}, {"w8_r16", 8, 16}, {"w32_r0", 32, 0}, {"w32_r16", 32, 16}, {"w48_r16", 48, 16}, {"w60_r16", 60, 16},
+};
+
+/**********************
+ *      MACROS
+ **********************/
+#define ARRAY_LEN(a) (sizeof(a) / sizeof((a)[0]))
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    const char * out_path = NULL;
+    const char * features_arg = "all";
+    state.min_time_ms = DEFAULT_MIN_TIME_MS;
+
+    int i;
+    for(i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--filter") == 0 && i + 1 < argc) state.filter = argv[++i];
+        else if(strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) state.min_time_ms = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--features") == 0 && i + 1 < argc) features_arg = argv[++i];
+        else if(strcmp(argv[i], "--out") == 0 && i + 1 < argc) out_path = argv[++i];
+        else {
+            print_usage(argv[0]);
+            return strcmp(argv[i], "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    lv_init();
+
+    uint32_t features;
+    if(!lv_perf_parse_features(features_arg, &features)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    lv_draw_sw_set_kernel_features(features);
+
+    state.out = stdout;
+    if(out_path) {
+        state.out = fopen(out_path, "w");
+        if(state.out == NULL) {
+            fprintf(stderr, "Couldn't open %s\n", out_path);
+            return 1;
+        }
+    }
+
+    /*The rotation needs a full panel, the rest of the cases use only the beginning of the buffers*/
+    state.src = calloc(PANEL_W * PANEL_H, 4);
+    state.tr_buf = malloc(PANEL_W * PANEL_H * 4);     /*Also large enough for color and alpha of RGB565*/
+    state.mask = malloc(MAX_W * MAX_H);
+
+    /*Pseudo random colors and alpha with fully transparent and opaque runs as in real images*/
+    uint32_t seed = 0x12345678;
+    for(i = 0; i < MAX_W * MAX_H * 4; i++) {
+        seed = seed * 1103515245 + 12345;
+        state.src[i] = (uint8_t)(seed >> 16);
+        if((i & 3) == 3) {
+            int32_t x = (i / 4) % MAX_W;
+            if(x < MAX_W / 4) state.src[i] = 0;
+            else if(x > MAX_W / 2) state.src[i] = 0xff;
+        }
+    }
+
+    for(i = 0; i < MAX_W * MAX_H; i++) {
+        int32_t x = i % MAX_W;
+        if(x < MAX_W / 4) state.mask[i] = LV_OPA_TRANSP;
+        else if(x > MAX_W / 2) state.mask[i] = LV_OPA_COVER;
+        else state.mask[i] = (lv_opa_t)(x * 3 + i / MAX_W);
+    }
+
+    state.clip_area.x1 = 0;
+    state.clip_area.y1 = 0;
+    state.clip_area.x2 = DEST_W - 1;
+    state.clip_area.y2 = DEST_H - 1;
+    state.layer.buf_area = state.clip_area;
+    state.draw_unit.target_layer = &state.layer;
+    state.draw_unit.clip_area = &state.clip_area;
+
+    char cpu_features_str[32];
+    char kernel_features_str[32];
+    fprintf(state.out, "{\n");
+    fprintf(state.out, "  \"lvgl\": \"%d.%d.%d%s%s\",\n", lv_version_major(), lv_version_minor(), lv_version_patch(),
+            lv_version_info()[0] ? "-" : "", lv_version_info());
+    fprintf(state.out, "  \"cpu_features\": \"%s\",\n", lv_perf_features_to_str(lv_draw_sw_get_cpu_features(), cpu_features_str));
+    fprintf(state.out, "  \"kernel_features\": \"%s\",\n",
+            lv_perf_features_to_str(lv_draw_sw_get_cpu_features() & features, kernel_features_str));
+    fprintf(state.out, "  \"min_time_ms\": %u,\n", (unsigned)state.min_time_ms);
+    fprintf(state.out, "  \"results\": [");
+
+    bench_blend_fill();
+    bench_blend_image();
+    bench_blend_mode();
+    bench_transform();
+    bench_box_shadow();
+    bench_mask();
+    bench_rotate();
+    bench_dispatch();
+
+    fprintf(state.out, "\n  ]\n}\n");
+    if(state.out != stdout) fclose(state.out);
+
+    if(state.dest) lv_draw_buf_destroy(state.dest);
+    free(state.src);
+    free(state.tr_buf);
+    free(state.mask);
+    lv_deinit();
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void bench_blend_fill(void)
+{
+    uint32_t d, s, o;
+    for(d = 0; d < ARRAY_LEN(dest_cfs); d++) {
+        set_dest(dest_cfs[d]);
+        for(o = 0; o < ARRAY_LEN(opa_masks); o++) {
+            for(s = 0; s < ARRAY_LEN(sizes); s++) {
+                perf_case_t c = {"blend_fill", "", dest_cfs[d], LV_COLOR_FORMAT_UNKNOWN, sizes[s].x, sizes[s].y,
+                                 opa_masks[o].opa, opa_masks[o].mask, LV_BLEND_MODE_NORMAL
+                                };
+                run_case(&c, blend_cb);
+            }
+        }
+    }
+}
+
+static void bench_blend_image(void)
+{
+    uint32_t d, src, s, o;
+    for(d = 0; d < ARRAY_LEN(dest_cfs); d++) {
+        set_dest(dest_cfs[d]);
+        for(src = 0; src < ARRAY_LEN(src_cfs); src++) {
+            for(o = 0; o < ARRAY_LEN(opa_masks); o++) {
+                for(s = 0; s < ARRAY_LEN(sizes); s++) {
+                    perf_case_t c = {"blend_image", "", dest_cfs[d], src_cfs[src], sizes[s].x, sizes[s].y,
+                                     opa_masks[o].opa, opa_masks[o].mask, LV_BLEND_MODE_NORMAL
+                                    };
+                    run_case(&c, blend_cb);
+                }
+            }
+        }
+    }
+}
+
+static void bench_blend_mode(void)
+{
+    static const struct {
+        const char * name;
+        lv_blend_mode_t mode;
+    } modes[] = {
+        {"additive", LV_BLEND_MODE_ADDITIVE}, {"subtractive", LV_BLEND_MODE_SUBTRACTIVE}, {"multiply", LV_BLEND_MODE_MULTIPLY}
+    };
+
+    uint32_t d, m, s;
+    for(d = 0; d < ARRAY_LEN(dest_cfs); d++) {
+        set_dest(dest_cfs[d]);
+        for(m = 0; m < ARRAY_LEN(modes); m++) {
+            for(s = 0; s < ARRAY_LEN(sizes); s++) {
+                perf_case_t c = {"blend_mode", modes[m].name, dest_cfs[d], LV_COLOR_FORMAT_ARGB8888, sizes[s].x, sizes[s].y,
+                                 LV_OPA_COVER, false, modes[m].mode
+                                };
+                run_case(&c, blend_cb);
+            }
+        }
+    }
+}
+
+static void bench_transform(void)
+{
+    static const lv_color_format_t cfs[] = {
+        LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB888, LV_COLOR_FORMAT_XRGB8888, LV_COLOR_FORMAT_ARGB8888,
+        LV_COLOR_FORMAT_A8
+    };
+
+    uint32_t cf, t, s;
+    for(cf = 0; cf < ARRAY_LEN(cfs); cf++) {
+        for(t = 0; t < ARRAY_LEN(transforms); t++) {
+            for(s = 1; s < ARRAY_LEN(sizes); s++) {
+                perf_case_t c = {"transform", transforms[t].name, LV_COLOR_FORMAT_UNKNOWN, cfs[cf], sizes[s].x, sizes[s].y,
+                                 LV_OPA_COVER, false, t
+                                };
+                run_case(&c, transform_cb);
+            }
+        }
+    }
+}
+
+static void bench_box_shadow(void)
+{
+    uint32_t d, sh, s;
+    for(d = 0; d < ARRAY_LEN(dest_cfs); d++) {
+        set_dest(dest_cfs[d]);
+        for(sh = 0; sh < ARRAY_LEN(shadows); sh++) {
+            for(s = 1; s < ARRAY_LEN(sizes); s++) {
+                /*Count the pixels of the whole shadow*/
+                int32_t sw = shadows[sh].width;
+                perf_case_t c = {"box_shadow", shadows[sh].name, dest_cfs[d], LV_COLOR_FORMAT_UNKNOWN,
+                                 sizes[s].x + sw, sizes[s].y + sw, LV_OPA_COVER, false, sh
+                                };
+                run_case(&c, box_shadow_cb);
+            }
+        }
+    }
+}
+
+static void bench_mask(void)
+{
+    static const char * masks[] = {"radius16", "radius16_inv", "line30", "angle0_135", "fade", "radius16_angle"};
+
+    uint32_t m, s;
+    for(m = 0; m < ARRAY_LEN(masks); m++) {
+        for(s = 1; s < ARRAY_LEN(sizes); s++) {
+            perf_case_t c = {"mask", masks[m], LV_COLOR_FORMAT_A8, LV_COLOR_FORMAT_UNKNOWN, sizes[s].x, sizes[s].y,
+                             LV_OPA_COVER, true, m
+                            };
+            run_case(&c, mask_cb);
+        }
+    }
+}
+
+static void bench_rotate(void)
+{
+    static const char * rotations[] = {"rot90", "rot180", "rot270"};
+    static const lv_point_t rotate_sizes[] = {{64, 64}, {MAX_W, MAX_H}, {PANEL_W, PANEL_H}};
+
+    uint32_t cf, r, s;
+    for(cf = 0; cf < ARRAY_LEN(src_cfs); cf++) {
+        for(r = 0; r < ARRAY_LEN(rotations); r++) {
+            for(s = 0; s < ARRAY_LEN(rotate_sizes); s++) {
+                perf_case_t c = {"rotate", rotations[r], src_cfs[cf], src_cfs[cf], rotate_sizes[s].x, rotate_sizes[s].y,
+                                 LV_OPA_COVER, false, LV_DISPLAY_ROTATION_90 + r
+                                };
+                run_case(&c, rotate_cb);
+            }
+        }
+    }
+}
+
+static void bench_dispatch(void)
+{
+    /*`w` is the number of draw tasks and `h` is 1, so "ns_per_px" is the time spent on one draw task*/
+    static const int32_t task_cnts[] = {250, 500, 1000, 2000, 4000};
+
+    set_dest(LV_COLOR_FORMAT_ARGB8888);
+    uint32_t t;
+    for(t = 0; t < ARRAY_LEN(task_cnts); t++) {
+        perf_case_t c = {"dispatch", "rects", LV_COLOR_FORMAT_ARGB8888, LV_COLOR_FORMAT_UNKNOWN, task_cnts[t], 1,
+                         LV_OPA_COVER, false, 0
+                        };
+        run_case(&c, dispatch_cb);
+    }
+}
+
+/**
+ * Run a benchmark case at least `min_time_ms` long and print its result
+ * @param c         the case to run
+ * @param cb        function to run one iteration of the case
+ */
+static void run_case(const perf_case_t * c, perf_cb_t cb)
+{
+    char name[128];
+    snprintf(name, sizeof(name), "%s%s%s/%s%s%s/%dx%d/opa%d%s", c->kernel, c->variant[0] ? "/" : "", c->variant,
+             cf_to_str(c->src_cf),
+             c->src_cf != LV_COLOR_FORMAT_UNKNOWN && c->dest_cf != LV_COLOR_FORMAT_UNKNOWN ? "->" : "", cf_to_str(c->dest_cf),
+             (int)c->w, (int)c->h, c->opa, c->mask ? "/mask" : "");
+
+    if(state.filter && strstr(name, state.filter) == NULL) return;
+
+    fprintf(stderr, "%s\n", name);
+
+    /*Warm up the caches and the branch predictor*/
+    cb(c);
+
+    /*Run in batches to not measure the timer*/
+    uint64_t min_time_ns = (uint64_t)state.min_time_ms * 1000000;
+    uint64_t iterations = 0;
+    uint64_t batch = 1;
+    uint64_t start = lv_perf_time_ns();
+    uint64_t elapsed;
+    while(1) {
+        uint64_t i;
+        for(i = 0; i < batch; i++) cb(c);
+        iterations += batch;
+        elapsed = lv_perf_time_ns() - start;
+        if(elapsed >= min_time_ns) break;
+        if(elapsed < min_time_ns / 16) batch *= 2;
+    }
+
+    double px = (double)iterations * c->w * c->h;
+    fprintf(state.out, "%s\n    {\"name\": \"%s\", \"kernel\": \"%s\", \"variant\": \"%s\", "
+            "\"dest_cf\": \"%s\", \"src_cf\": \"%s\", \"w\": %d, \"h\": %d, \"opa\": %d, \"mask\": %s, "
+            "\"iterations\": %llu, \"ns_per_px\": %.4f, \"mpx_per_s\": %.2f}",
+            state.case_cnt ? "," : "", name, c->kernel, c->variant, cf_to_str(c->dest_cf), cf_to_str(c->src_cf),
+            (int)c->w, (int)c->h, c->opa, c->mask ? "true" : "false", (unsigned long long)iterations,
+            (double)elapsed / px, px * 1000.0 / (double)elapsed);
+    state.case_cnt++;
+}
+
+/**
+ * Create the destination buffer of the blend and shadow benchmarks
+ * @param cf        the color format of the destination
+ */
+static void set_dest(lv_color_format_t cf)
+{
+    if(state.dest) lv_draw_buf_destroy(state.dest);
+    state.dest = lv_draw_buf_create(DEST_W, DEST_H, cf, LV_STRIDE_AUTO);
+    lv_draw_buf_clear(state.dest, NULL);
+    state.layer.draw_buf = state.dest;
+    state.layer.color_format = cf;
+}
+
+static void blend_cb(const perf_case_t * c)
+{
+    lv_area_t area = {0, 0, c->w - 1, c->h - 1};
+    lv_draw_sw_blend_dsc_t dsc;
+    lv_memzero(&dsc, sizeof(dsc));
+    dsc.blend_area = &area;
+    dsc.opa = c->opa;
+    dsc.color = lv_color_hex(0x3060c0);
+    dsc.blend_mode = (lv_blend_mode_t)c->param;
+    if(c->src_cf != LV_COLOR_FORMAT_UNKNOWN) {
+        dsc.src_buf = state.src;
+        dsc.src_area = &area;
+        dsc.src_color_format = c->src_cf;
+        dsc.src_stride = lv_draw_buf_width_to_stride(c->w, c->src_cf);
+    }
+    if(c->mask) {
+        dsc.mask_buf = state.mask;
+        dsc.mask_area = &area;
+        dsc.mask_stride = MAX_W;
+        dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+    }
+    lv_draw_sw_blend(&state.draw_unit, &dsc);
+}
+
+static void transform_cb(const perf_case_t * c)
+{
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    dsc.rotation = transforms[c->param].rotation;
+    dsc.scale_x = transforms[c->param].scale;
+    dsc.scale_y = transforms[c->param].scale;
+    dsc.pivot.x = c->w / 2;
+    dsc.pivot.y = c->h / 2;
+    dsc.antialias = 1;
+
+    /*Only the area where the image is drawn as the image drawing does. It makes the steps of 0.5x whole pixels*/
+    lv_area_t dest_area = {0, 0, c->w - 1, c->h - 1};
+    lv_area_t img_area;
+    _lv_image_buf_get_transformed_area(&img_area, c->w, c->h, dsc.rotation, dsc.scale_x, dsc.scale_y, &dsc.pivot);
+    _lv_area_intersect(&dest_area, &dest_area, &img_area);
+    int32_t src_stride = lv_draw_buf_width_to_stride(c->w, c->src_cf);
+    lv_draw_sw_transform(&state.draw_unit, &dest_area, state.src, c->w, c->h, src_stride, &dsc, NULL, c->src_cf,
+                         state.tr_buf);
+}
+
+static void box_shadow_cb(const perf_case_t * c)
+{
+    lv_draw_box_shadow_dsc_t dsc;
+    lv_memzero(&dsc, sizeof(dsc));
+    dsc.width = shadows[c->param].width;
+    dsc.radius = shadows[c->param].radius;
+    dsc.color = lv_color_hex(0x202020);
+    dsc.opa = c->opa;
+
+    /*`c->w` and `c->h` include the shadow*/
+    lv_area_t coords;
+    coords.x1 = SHADOW_MAX_WIDTH;
+    coords.y1 = SHADOW_MAX_WIDTH;
+    coords.x2 = coords.x1 + c->w - dsc.width - 1;
+    coords.y2 = coords.y1 + c->h - dsc.width - 1;
+    lv_draw_sw_box_shadow(&state.draw_unit, &dsc, &coords);
+}
+
+static void mask_cb(const perf_case_t * c)
+{
+    lv_area_t area = {0, 0, c->w - 1, c->h - 1};
+    lv_draw_sw_mask_radius_param_t radius;
+    lv_draw_sw_mask_line_param_t line;
+    lv_draw_sw_mask_angle_param_t angle;
+    lv_draw_sw_mask_fade_param_t fade;
+    void * masks[3] = {NULL, NULL, NULL};
+
+    switch(c->param) {
+        case 0:
+        case 1:
+            lv_draw_sw_mask_radius_init(&radius, &area, 16, c->param == 1);
+            masks[0] = &radius;
+            break;
+        case 2:
+            lv_draw_sw_mask_line_angle_init(&line, c->w / 2, c->h / 2, 30, LV_DRAW_SW_MASK_LINE_SIDE_LEFT);
+            masks[0] = &line;
+            break;
+        case 3:
+            lv_draw_sw_mask_angle_init(&angle, c->w / 2, c->h / 2, 0, 135);
+            masks[0] = &angle;
+            break;
+        case 4:
+            lv_draw_sw_mask_fade_init(&fade, &area, LV_OPA_COVER, c->h / 4, LV_OPA_TRANSP, c->h * 3 / 4);
+            masks[0] = &fade;
+            break;
+        default:
+            lv_draw_sw_mask_radius_init(&radius, &area, 16, false);
+            lv_draw_sw_mask_angle_init(&angle, c->w / 2, c->h / 2, 0, 135);
+            masks[0] = &radius;
+            masks[1] = &angle;
+            break;
+    }
+
+    /*The same way as the renderer applies the masks: row by row, starting from a fully opaque row*/
+    int32_t y;
+    for(y = 0; y < c->h; y++) {
+        lv_opa_t * mask_row = state.tr_buf + y * c->w;
+        lv_memset(mask_row, 0xff, c->w);
+        lv_draw_sw_mask_apply(masks, mask_row, 0, y, c->w);
+    }
+
+    lv_draw_sw_mask_free_param(masks[0]);
+    if(masks[1]) lv_draw_sw_mask_free_param(masks[1]);
+}
+
+static void rotate_cb(const perf_case_t * c)
+{
+    lv_display_rotation_t rotation = (lv_display_rotation_t)c->param;
+    int32_t src_stride = lv_draw_buf_width_to_stride(c->w, c->src_cf);
+    int32_t dest_stride = lv_draw_buf_width_to_stride(rotation == LV_DISPLAY_ROTATION_180 ? c->w : c->h, c->src_cf);
+    lv_draw_sw_rotate(state.src, state.tr_buf, c->w, c->h, src_stride, dest_stride, rotation, c->src_cf);
+}
+
+/**
+ * Add `c->w` small rectangles to a layer, then dispatch and render them.
+ * The dependency checks of the dispatcher grow with the number of overlapping tasks.
+ * @param c         the case to run
+ */
+static void dispatch_cb(const perf_case_t * c)
+{
+    lv_layer_t layer;
+    lv_memzero(&layer, sizeof(layer));
+    layer.draw_buf = state.dest;
+    layer.color_format = c->dest_cf;
+    layer.buf_area = state.clip_area;
+    layer._clip_area = state.clip_area;
+
+    /*The same pseudo random rectangles in each iteration*/
+    uint32_t seed = 1;
+    int32_t i;
+    for(i = 0; i < c->w; i++) {
+        lv_area_t a;
+        seed = seed * 1103515245 + 12345;
+        a.x1 = (int32_t)((seed >> 16) % DEST_W) - 20;
+        seed = seed * 1103515245 + 12345;
+        a.y1 = (int32_t)((seed >> 16) % DEST_H) - 20;
+        a.x2 = a.x1 + (int32_t)(seed % 60);
+        a.y2 = a.y1 + (int32_t)((seed >> 8) % 40);
+
+        lv_draw_rect_dsc_t dsc;
+        lv_draw_rect_dsc_init(&dsc);
+        dsc.bg_color = lv_color_hex(seed);
+        dsc.radius = 0;
+        lv_draw_rect(&layer, &dsc, &a);
+    }
+
+    /*There is no display to dispatch the layer on adding the tasks, so start with dispatching*/
+    while(1) {
+        lv_draw_dispatch_layer(NULL, &layer);
+        if(layer.draw_task_head == NULL) break;
+        lv_draw_dispatch_wait_for_request();
+    }
+    lv_draw_layer_deinit(&layer);
+}
+
+static const char * cf_to_str(lv_color_format_t cf)
+{
+    switch(cf) {
+        case LV_COLOR_FORMAT_RGB565:
+            return "RGB565";
+        case LV_COLOR_FORMAT_RGB888:
+            return "RGB888";
+        case LV_COLOR_FORMAT_XRGB8888:
+            return "XRGB8888";
+        case LV_COLOR_FORMAT_ARGB8888:
+            return "ARGB8888";
+        case LV_COLOR_FORMAT_A8:
+            return "A8";
+        default:
+            return "";
+    }
+}
+
+static void print_usage(const char * prog)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  --filter <text>      run only the cases whose name contains <text>, e.g. \"blend_image/ARGB8888->RGB565\"\n"
+            "  --features <set>     c, sse2, avx2, neon or all (default) to select the optimized kernels\n"
+            "  --min-time <ms>      minimum run time of a case (default %d)\n"
+            "  --out <file>         write the JSON result to <file> instead of stdout\n",
+            prog, DEFAULT_MIN_TIME_MS);
+}
@@ -0,0 +1,246 @@
+/**
+ * @file lv_perf_benchmark.c
+ * Headless runner of the scenes of `lv_demo_benchmark`.
+ * The display flushes to memory and the tick is simulated, so each scene renders exactly the same
+ * frames on every run. The render and flush times and the deterministic work counters
+ * are printed as JSON. Compare two results with `perf_compare.py`.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lvgl.h"
+#include "demos/lv_demos.h"
+#include "src/draw/sw/lv_draw_sw.h"
+#include "lv_perf_common.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define DEFAULT_HOR_RES     800
+#define DEFAULT_VER_RES     480
+#define DEFAULT_FRAMES      100
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t tick;                  /**< The simulated time*/
+    uint64_t flush_ns;              /**< Time spent in `flush_cb` in the current scene*/
+    uint32_t rendered_frames;       /**< Number of frames flushed completely in the current scene*/
+    uint8_t * fb;                   /**< The simulated frame buffer*/
+    int32_t hor_res;
+    int32_t ver_res;
+} runner_state_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void run_scene(uint32_t scene, uint32_t frames, FILE * out, bool first);
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+static uint32_t tick_cb(void);
+static void print_usage(const char * prog);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static runner_state_t state;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    const char * out_path = NULL;
+    const char * filter = NULL;
+    const char * features_arg = "all";
+    uint32_t frames = DEFAULT_FRAMES;
+    state.hor_res = DEFAULT_HOR_RES;
+    state.ver_res = DEFAULT_VER_RES;
+
+    int i;
+    for(i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--frames") == 0 && i + 1 < argc) frames = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--res") == 0 && i + 1 < argc) {
+            int w, h;
+            if(sscanf(argv[++i], "%dx%d", &w, &h) != 2 || w <= 0 || h <= 0) {
+                print_usage(argv[0]);
+                return 1;
+            }
+            state.hor_res = w;
+            state.ver_res = h;
+        }
+        else if(strcmp(argv[i], "--scene") == 0 && i + 1 < argc) filter = argv[++i];
+        else if(strcmp(argv[i], "--features") == 0 && i + 1 < argc) features_arg = argv[++i];
+        else if(strcmp(argv[i], "--out") == 0 && i + 1 < argc) out_path = argv[++i];
+        else {
+            print_usage(argv[0]);
+            return strcmp(argv[i], "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    lv_init();
+    lv_tick_set_cb(tick_cb);
+
+    uint32_t features;
+    if(!lv_perf_parse_features(features_arg, &features)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    lv_draw_sw_set_kernel_features(features);
+
+    FILE * out = stdout;
+    if(out_path) {
+        out = fopen(out_path, "w");
+        if(out == NULL) {
+            fprintf(stderr, "Couldn't open %s\n", out_path);
+            return 1;
+        }
+    }
+
+    /*A typical setup: partial rendering to a buffer of 1/10 screen*/
+    lv_display_t * disp = lv_display_create(state.hor_res, state.ver_res);
+    uint32_t px_size = lv_color_format_get_size(lv_display_get_color_format(disp));
+    uint32_t buf_size = lv_draw_buf_width_to_stride(state.hor_res, lv_display_get_color_format(disp)) *
+                        (state.ver_res / 10 + 1);
+    void * buf = malloc(buf_size + LV_DRAW_BUF_ALIGN);
+    state.fb = malloc(state.hor_res * state.ver_res * px_size);
+    lv_display_set_buffers(disp, lv_draw_buf_align(buf, lv_display_get_color_format(disp)), NULL, buf_size,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"lvgl\": \"%d.%d.%d%s%s\",\n", lv_version_major(), lv_version_minor(), lv_version_patch(),
+            lv_version_info()[0] ? "-" : "", lv_version_info());
+    fprintf(out, "  \"hor_res\": %d,\n", (int)state.hor_res);
+    fprintf(out, "  \"ver_res\": %d,\n", (int)state.ver_res);
+    fprintf(out, "  \"frames\": %u,\n", (unsigned)frames);
+    fprintf(out, "  \"refr_period_ms\": %d,\n", LV_DEF_REFR_PERIOD);
+    char features_str[32];
+    fprintf(out, "  \"kernel_features\": \"%s\",\n",
+            lv_perf_features_to_str(lv_draw_sw_get_cpu_features() & features, features_str));
+    fprintf(out, "  \"results\": [");
+
+    bool first = true;
+    uint32_t scene_cnt = lv_demo_benchmark_get_scene_count();
+    uint32_t s;
+    for(s = 0; s < scene_cnt; s++) {
+        if(filter && strstr(lv_demo_benchmark_get_scene_name(s), filter) == NULL) continue;
+        run_scene(s, frames, out, first);
+        first = false;
+    }
+
+    fprintf(out, "\n  ]\n}\n");
+    if(out != stdout) fclose(out);
+
+    lv_deinit();
+    free(buf);
+    free(state.fb);
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Render a fixed number of frames of a scene and print the measured values
+ * @param scene     index of the scene
+ * @param frames    number of refresh periods to simulate
+ * @param out       print the result here
+ * @param first     true: it's the first result (no separator is required)
+ */
+static void run_scene(uint32_t scene, uint32_t frames, FILE * out, bool first)
+{
+    const char * name = lv_demo_benchmark_get_scene_name(scene);
+    fprintf(stderr, "%s\n", name);
+
+    lv_demo_benchmark_load_scene(scene);
+
+    state.flush_ns = 0;
+    state.rendered_frames = 0;
+    lv_draw_task_monitor_reset();
+    lv_draw_sw_blend_monitor_reset();
+
+    uint64_t total_ns = 0;
+    uint32_t f;
+    for(f = 0; f < frames; f++) {
+        state.tick += LV_DEF_REFR_PERIOD;
+        uint64_t start = lv_perf_time_ns();
+        lv_timer_handler();
+        total_ns += lv_perf_time_ns() - start;
+    }
+
+    lv_draw_task_monitor_t task_mon;
+    lv_draw_task_monitor(&task_mon);
+    lv_draw_sw_blend_monitor_t blend_mon;
+    lv_draw_sw_blend_monitor(&blend_mon);
+    lv_mem_monitor_t mem_mon;
+    lv_mem_monitor(&mem_mon);
+
+    /*The render time contains everything else done by LVGL, e.g. the animations and the layout*/
+    uint64_t render_ns = total_ns - state.flush_ns;
+    fprintf(out, "%s\n    {\"name\": \"%s\", \"frames\": %u, \"rendered_frames\": %u, "
+            "\"render_us_per_frame\": %.1f, \"flush_us_per_frame\": %.1f, "
+            "\"draw_tasks\": %u, \"draw_task_px\": %u, \"blended_px\": %u, \"blend_calls\": %u, "
+            "\"mem_used\": %u, \"mem_max_used\": %u}",
+            first ? "" : ",", name, (unsigned)frames, (unsigned)state.rendered_frames,
+            (double)render_ns / 1000.0 / frames, (double)state.flush_ns / 1000.0 / frames,
+            (unsigned)task_mon.task_cnt, (unsigned)task_mon.task_px_cnt,
+            (unsigned)(blend_mon.fill_px_cnt + blend_mon.image_px_cnt), (unsigned)blend_mon.call_cnt,
+            (unsigned)(mem_mon.total_size - mem_mon.free_size), (unsigned)mem_mon.max_used);
+}
+
+/**
+ * Copy the rendered area to the simulated frame buffer
+ */
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    uint64_t start = lv_perf_time_ns();
+
+    lv_color_format_t cf = lv_display_get_color_format(disp);
+    uint32_t px_size = lv_color_format_get_size(cf);
+    uint32_t src_stride = lv_draw_buf_width_to_stride(lv_area_get_width(area), cf);
+    uint32_t dest_stride = state.hor_res * px_size;
+    uint32_t row_size = lv_area_get_width(area) * px_size;
+    uint8_t * dest = state.fb + area->y1 * dest_stride + area->x1 * px_size;
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(dest, px_map, row_size);
+        dest += dest_stride;
+        px_map += src_stride;
+    }
+
+    if(lv_display_flush_is_last(disp)) state.rendered_frames++;
+    lv_display_flush_ready(disp);
+
+    state.flush_ns += lv_perf_time_ns() - start;
+}
+
+static uint32_t tick_cb(void)
+{
+    return state.tick;
+}
+
+static void print_usage(const char * prog)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  --frames <n>         number of refresh periods to render in each scene (default %d)\n"
+            "  --res <w>x<h>        resolution of the display (default %dx%d)\n"
+            "  --scene <text>       run only the scenes whose name contains <text>\n"
+            "  --features <set>     c, sse2, avx2, neon or all (default) to select the optimized kernels\n"
+            "  --out <file>         write the JSON result to <file> instead of stdout\n",
+            prog, DEFAULT_FRAMES, DEFAULT_HOR_RES, DEFAULT_VER_RES);
+}
@@ -0,0 +1,49 @@
+/**
+ * @file lv_perf_common.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#define _POSIX_C_SOURCE 199309L
+#include <string.h>
+#include <time.h>
+
+#include "lv_perf_common.h"
+#include "lvgl.h"
+#include "src/draw/sw/lv_draw_sw.h"
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+uint64_t lv_perf_time_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+bool lv_perf_parse_features(const char * str, uint32_t * features)
+{
+    if(strcmp(str, "all") == 0) *features = LV_DRAW_SW_CPU_FEATURE_ALL;
+    else if(strcmp(str, "c") == 0) *features = LV_DRAW_SW_CPU_FEATURE_NONE;
+    else if(strcmp(str, "sse2") == 0) *features = LV_DRAW_SW_CPU_FEATURE_SSE2;
+    else if(strcmp(str, "avx2") == 0) *features = LV_DRAW_SW_CPU_FEATURE_SSE2 | LV_DRAW_SW_CPU_FEATURE_AVX2;
+    else if(strcmp(str, "neon") == 0) *features = LV_DRAW_SW_CPU_FEATURE_NEON;
+    else return false;
+
+    return true;
+}
+
+const char * lv_perf_features_to_str(uint32_t features, char * buf)
+{
+    buf[0] = '\0';
+    if(features & LV_DRAW_SW_CPU_FEATURE_SSE2) strcat(buf, " sse2");
+    if(features & LV_DRAW_SW_CPU_FEATURE_AVX2) strcat(buf, " avx2");
+    if(features & LV_DRAW_SW_CPU_FEATURE_NEON) strcat(buf, " neon");
+
+    /*Skip the leading space*/
+    return buf[0] ? buf + 1 : buf;
+}
@@ -0,0 +1,41 @@
+/**
+ * @file lv_perf_common.h
+ * Helpers shared by the benchmark programs
+ */
+
+#ifndef LV_PERF_COMMON_H
+#define LV_PERF_COMMON_H
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get a monotonic time stamp
+ * @return          the time in nanoseconds
+ */
+uint64_t lv_perf_time_ns(void);
+
+/**
+ * Convert the value of the `--features` option to CPU features
+ * @param str       "c", "sse2", "avx2", "neon" or "all"
+ * @param features  store the OR-ed `lv_draw_sw_cpu_feature_t` values here
+ * @return          false if `str` is invalid
+ */
+bool lv_perf_parse_features(const char * str, uint32_t * features);
+
+/**
+ * Convert CPU features to a space separated list, e.g. "sse2 avx2"
+ * @param features  OR-ed `lv_draw_sw_cpu_feature_t` values
+ * @param buf       a buffer of at least 32 bytes
+ * @return          the list in `buf`
+ */
+const char * lv_perf_features_to_str(uint32_t features, char * buf);
+
+#endif /*LV_PERF_COMMON_H*/
@@ -0,0 +1,57 @@
+/**
+ * @file lv_perf_conf.h
+ * Configuration of the software renderer micro-benchmarks
+ */
+
+#ifndef LV_PERF_CONF_H
+#define LV_PERF_CONF_H
+
+#define LV_CONF_SUPPRESS_DEFINE_CHECK 1
+
+/*Same as a typical release build: no logging, no asserts, no profiling*/
+#define LV_COLOR_DEPTH              32
+#define LV_USE_STDLIB_MALLOC        LV_STDLIB_BUILTIN   /*To know the memory high-water mark*/
+#define LV_MEM_SIZE                 (16 * 1024 * 1024)
+#define LV_USE_STDLIB_STRING        LV_STDLIB_CLIB
+#define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
+#define LV_USE_OS                   LV_OS_NONE
+
+#define LV_USE_DRAW_SW              1
+#define LV_DRAW_SW_COMPLEX          1
+#define LV_DRAW_SW_DRAW_UNIT_CNT    1
+#define LV_DRAW_SW_GRADIENT_CACHE_SIZE  (16 * 1024)
+
+/*Set by CMake, see `LV_PERF_SHADOW_BLUR_PASSES`*/
+#ifndef LV_DRAW_SW_SHADOW_BLUR_PASSES
+#define LV_DRAW_SW_SHADOW_BLUR_PASSES   0
+#endif
+
+/*Set by CMake, see `LV_PERF_ASM`*/
+#ifndef LV_USE_DRAW_SW_ASM
+#define LV_USE_DRAW_SW_ASM          LV_DRAW_SW_ASM_NONE
+#endif
+
+#define LV_USE_LOG                  0
+#define LV_USE_ASSERT_NULL          0
+#define LV_USE_ASSERT_MALLOC        0
+#define LV_USE_ASSERT_STYLE         0
+#define LV_USE_ASSERT_MEM_INTEGRITY 0
+#define LV_USE_ASSERT_OBJ           0
+
+/*For the draw task and blend counters in the results*/
+#define LV_USE_DRAW_MONITOR         1
+
+#define LV_BUILD_EXAMPLES           0
+#define LV_USE_THORVG_INTERNAL      0
+
+/*For the scenes of lv_perf_benchmark*/
+#define LV_USE_DEMO_BENCHMARK       1
+#define LV_USE_DEMO_WIDGETS         1
+#define LV_FONT_MONTSERRAT_12       1
+#define LV_FONT_MONTSERRAT_14       1
+#define LV_FONT_MONTSERRAT_16       1
+#define LV_FONT_MONTSERRAT_18       1
+#define LV_FONT_MONTSERRAT_20       1
+#define LV_FONT_MONTSERRAT_24       1
+
+#endif /*LV_PERF_CONF_H*/
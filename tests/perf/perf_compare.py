@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+
+"""
+Compare the JSON result of lv_perf or lv_perf_benchmark with a saved baseline.
+
+The results are matched by their "name". Every known metric is "lower is better".
+The times are compared with a relative threshold. The work counters of lv_perf_benchmark
+(draw tasks, blended pixels, memory) are deterministic, so any change of them is reported too.
+
+Exits with 1 if any metric is worse than the baseline by more than the threshold.
+"""
+
+import argparse
+import json
+import sys
+
+# Measured times: compared with the threshold.
+# The flush time is not compared as it's only a memcpy to the simulated frame buffer.
+TIME_METRICS = ['ns_per_px', 'render_us_per_frame']
+
+# Deterministic counters: compared with the threshold, changes below it are only reported
+COUNT_METRICS = ['draw_tasks', 'draw_task_px', 'blended_px', 'blend_calls', 'mem_max_used']
+
+
+def load_results(path):
+    with open(path) as f:
+        data = json.load(f)
+    return {r['name']: r for r in data['results']}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare benchmark results with a baseline')
+    parser.add_argument('baseline', help='JSON result saved earlier')
+    parser.add_argument('result', help='JSON result to check')
+    parser.add_argument('--threshold', type=float, default=10.0,
+                        help='allowed slowdown in percent (default: %(default)s)')
+    parser.add_argument('--verbose', action='store_true', help='print all compared values, not only the changes')
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline)
+    result = load_results(args.result)
+
+    regressions = 0
+    for name, res in result.items():
+        base = baseline.get(name)
+        if base is None:
+            print('NEW   %s' % name)
+            continue
+
+        for metric in TIME_METRICS + COUNT_METRICS:
+            if metric not in res or metric not in base:
+                continue
+
+            old = base[metric]
+            new = res[metric]
+            change = (new - old) * 100.0 / old if old else 0.0
+
+            if change > args.threshold:
+                status = 'WORSE'
+                regressions += 1
+            elif change < -args.threshold:
+                status = 'BETTER'
+            elif metric in COUNT_METRICS and new != old:
+                status = 'CHANGED'
+            elif args.verbose:
+                status = 'SAME'
+            else:
+                continue
+
+            print('%-7s %s: %s %s -> %s (%+.1f%%)' % (status, name, metric, old, new, change))
+
+    for name in baseline:
+        if name not in result:
+            print('MISSING %s' % name)
+
+    print('%d regression(s) above %.1f%%' % (regressions, args.threshold))
+    return 1 if regressions else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -1,6 +1,19 @@
 #define LV_MEM_SIZE                     (32 * 1024 * 1024)
-#define LV_DRAW_SW_SHADOW_CACHE_SIZE    8
+#define LV_DRAW_SW_SHADOW_CACHE_SIZE    64
+#define LV_DRAW_SW_GRADIENT_CACHE_SIZE  (16 * 1024)
 #define LV_DRAW_THREAD_STACK_SIZE    (64 * 1024) /*Increase stack size to 64KB in order to run ThorVG*/
+#define LV_DRAW_LAYER_ARENA_SIZE        (16 * 1024)
+#define LV_DRAW_LAYER_POOL_SIZE         (256 * 1024)
+#define LV_DRAW_CULL_OCCLUDED_TASKS     1
+#define LV_USE_DRAW_MONITOR             1
+#define LV_REFR_SCROLL_BLIT             1
+#if defined(LVGL_CI_USING_SYS_HEAP)
+    /*Render with parallel threads (LV_OS_PTHREAD) and split the large tasks into stripes*/
+    #define LV_DRAW_SW_DRAW_UNIT_CNT    2
+#endif
+#if defined(__SSE2__)
+    #define LV_USE_DRAW_SW_ASM          LV_DRAW_SW_ASM_X86
+#endif
 #define LV_USE_LOG              1
 #define LV_LOG_LEVEL            LV_LOG_LEVEL_TRACE
 #define LV_LOG_PRINTF           1
@@ -41,6 +54,7 @@
 #define LV_FONT_DEFAULT         &lv_font_montserrat_14
 #define LV_FONT_FMT_TXT_LARGE   1
 #define LV_USE_FONT_COMPRESSED  1
+#define LV_FONT_FMT_TXT_CACHE_SIZE  (64 * 1024)
 #define LV_USE_BIDI 1
 #define LV_USE_ARABIC_PERSIAN_CHARS 1
 #define LV_USE_PERF_MONITOR         1
@@ -0,0 +1,124 @@
+#if LV_BUILD_TEST
+
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define RADIUS_CNT  15
+
+void setUp(void)
+{
+    _lv_draw_sw_mask_cleanup();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_circle_cache_hit(void)
+{
+    lv_area_t a1 = {10, 10, 109, 59};
+    lv_area_t a2 = {200, 100, 239, 179};
+    lv_draw_sw_mask_radius_param_t p1;
+    lv_draw_sw_mask_radius_param_t p2;
+
+    /*The position and size of the rectangle don't matter*/
+    lv_draw_sw_mask_radius_init(&p1, &a1, 12, false);
+    lv_draw_sw_mask_radius_init(&p2, &a2, 12, true);
+    TEST_ASSERT_NOT_NULL(p1.circle);
+    TEST_ASSERT_NOT_NULL(p1.circle->cache_entry);
+    TEST_ASSERT_EQUAL_PTR(p1.circle, p2.circle);
+    TEST_ASSERT_EQUAL_INT32(12, p1.circle->radius);
+
+    lv_draw_sw_mask_free_param(&p1);
+    lv_draw_sw_mask_free_param(&p2);
+    TEST_ASSERT_NULL(p1.circle);
+}
+
+void test_circle_cache_many_radii(void)
+{
+    /*Many small circles fit into the size of a few large ones*/
+    lv_area_t a = {0, 0, 99, 99};
+    lv_draw_sw_mask_radius_param_t p1[RADIUS_CNT];
+    lv_draw_sw_mask_radius_param_t p2[RADIUS_CNT];
+    int32_t i;
+    for(i = 0; i < RADIUS_CNT; i++) {
+        lv_draw_sw_mask_radius_init(&p1[i], &a, i + 1, false);
+        TEST_ASSERT_NOT_NULL(p1[i].circle->cache_entry);
+    }
+
+    for(i = 0; i < RADIUS_CNT; i++) {
+        lv_draw_sw_mask_radius_init(&p2[i], &a, i + 1, false);
+        TEST_ASSERT_EQUAL_PTR(p1[i].circle, p2[i].circle);
+    }
+
+    for(i = 0; i < RADIUS_CNT; i++) {
+        lv_draw_sw_mask_free_param(&p1[i]);
+        lv_draw_sw_mask_free_param(&p2[i]);
+    }
+}
+
+void test_circle_cache_kept_across_refreshes(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_radius(obj, 12, 0);
+    lv_refr_now(NULL);
+
+    lv_area_t a = {0, 0, 99, 99};
+    lv_draw_sw_mask_radius_param_t p;
+    lv_draw_sw_mask_radius_init(&p, &a, 12, false);
+    lv_cache_entry_t * entry = p.circle->cache_entry;
+    TEST_ASSERT_NOT_NULL(entry);
+    lv_draw_sw_mask_free_param(&p);
+
+    lv_cache_t * cache = LV_GLOBAL_DEFAULT()->sw_circle_cache;
+    size_t size = lv_cache_get_size(cache, NULL);
+    TEST_ASSERT_GREATER_THAN(0, size);
+
+    /*The end of a refresh doesn't drop the circles*/
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_obj_invalidate(obj);
+        lv_refr_now(NULL);
+        TEST_ASSERT_EQUAL(size, lv_cache_get_size(cache, NULL));
+    }
+
+    lv_draw_sw_mask_radius_init(&p, &a, 12, false);
+    TEST_ASSERT_EQUAL_PTR(entry, p.circle->cache_entry);
+    lv_draw_sw_mask_free_param(&p);
+}
+
+void test_circle_cache_not_cacheable(void)
+{
+    /*Larger than the whole cache. It's calculated temporarily and gives the same mask*/
+    lv_area_t a = {0, 0, 1999, 1999};
+    lv_draw_sw_mask_radius_param_t p;
+    lv_draw_sw_mask_radius_init(&p, &a, 1000, false);
+    TEST_ASSERT_NOT_NULL(p.circle);
+    TEST_ASSERT_NULL(p.circle->cache_entry);
+
+    lv_opa_t mask_buf[100];
+    lv_memset(mask_buf, 0xff, sizeof(mask_buf));
+    lv_draw_sw_mask_res_t res = p.dsc.cb(mask_buf, 0, 10, sizeof(mask_buf), &p);
+    TEST_ASSERT_EQUAL(LV_DRAW_SW_MASK_RES_CHANGED, res);
+    TEST_ASSERT_EQUAL_UINT8(0, mask_buf[0]);
+
+    lv_draw_sw_mask_free_param(&p);
+}
+
+void test_circle_cache_render(void)
+{
+    /*Rounded rectangles with more radii than `LV_DRAW_SW_CIRCLE_CACHE_SIZE`*/
+    uint32_t i;
+    for(i = 0; i < RADIUS_CNT; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_screen_active());
+        lv_obj_set_size(obj, 140, 80);
+        lv_obj_set_pos(obj, 10 + (i % 5) * 155, 10 + (i / 5) * 100);
+        lv_obj_set_style_radius(obj, 2 + i * 2, 0);
+    }
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/circle_cache_radii.png");
+}
+
+#endif
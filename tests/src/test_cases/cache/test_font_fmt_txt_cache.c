@@ -0,0 +1,152 @@
+#if LV_BUILD_TEST
+
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+extern uint8_t const test_font_1_buf[6876];
+extern uint8_t const test_font_2_buf[7252];
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static lv_cache_t * get_glyph_cache(void)
+{
+    return LV_GLOBAL_DEFAULT()->font_fmt_txt_cache;
+}
+
+/*Get the bitmap of a letter and release it. Returns the cache entry which holds it or NULL if not cached.*/
+static lv_cache_entry_t * touch_glyph(const lv_font_t * font, uint32_t letter)
+{
+    lv_font_glyph_dsc_t g;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g, letter, 0));
+    TEST_ASSERT_NOT_NULL(lv_font_get_glyph_bitmap(&g, NULL));
+
+    lv_cache_entry_t * entry = g.entry;
+    lv_font_glyph_release_draw_data(&g);
+    TEST_ASSERT_NULL(g.entry);
+    return entry;
+}
+
+void test_font_fmt_txt_cache_entry_is_reused(void)
+{
+    lv_cache_entry_t * entry = touch_glyph(&lv_font_montserrat_14, 'A');
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL_PTR(entry, touch_glyph(&lv_font_montserrat_14, 'A'));
+
+    /*A copy of the font shares the glyphs*/
+    lv_font_t font_copy;
+    lv_memcpy(&font_copy, &lv_font_montserrat_14, sizeof(lv_font_t));
+    TEST_ASSERT_EQUAL_PTR(entry, touch_glyph(&font_copy, 'A'));
+
+    /*An other font or letter has its own entry*/
+    TEST_ASSERT_NOT_EQUAL(entry, touch_glyph(&lv_font_montserrat_16, 'A'));
+    TEST_ASSERT_NOT_EQUAL(entry, touch_glyph(&lv_font_montserrat_14, 'B'));
+}
+
+void test_font_fmt_txt_cache_bitmap_matches_unpacked(void)
+{
+    /*Plain 4 bpp, compressed and 1 bpp fonts*/
+    const lv_font_t * fonts[] = {&lv_font_montserrat_14, &lv_font_montserrat_28_compressed, &lv_font_unscii_8};
+    const char * letters = "Ag@%";
+    lv_cache_t * cache = get_glyph_cache();
+
+    uint32_t f;
+    uint32_t i;
+    for(f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++) {
+        for(i = 0; letters[i]; i++) {
+            lv_font_glyph_dsc_t g;
+            TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(fonts[f], &g, letters[i], 0));
+            lv_draw_buf_t * unpacked = lv_draw_buf_create(g.box_w, g.box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+
+            /*Unpacked to the draw buffer while there is no cache*/
+            LV_GLOBAL_DEFAULT()->font_fmt_txt_cache = NULL;
+            TEST_ASSERT_EQUAL_PTR(unpacked, lv_font_get_glyph_bitmap(&g, unpacked));
+            TEST_ASSERT_NULL(g.entry);
+            LV_GLOBAL_DEFAULT()->font_fmt_txt_cache = cache;
+
+            const lv_draw_buf_t * cached = lv_font_get_glyph_bitmap(&g, NULL);
+            TEST_ASSERT_NOT_NULL(g.entry);
+            TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_A8, cached->header.cf);
+            TEST_ASSERT_EQUAL_UINT32(g.box_w, cached->header.w);
+            TEST_ASSERT_EQUAL_UINT32(g.box_h, cached->header.h);
+
+            uint32_t y;
+            for(y = 0; y < g.box_h; y++) {
+                TEST_ASSERT_EQUAL_MEMORY(unpacked->data + y * unpacked->header.stride,
+                                         cached->data + y * cached->header.stride, g.box_w);
+            }
+
+            lv_font_glyph_release_draw_data(&g);
+            lv_draw_buf_destroy(unpacked);
+        }
+    }
+}
+
+void test_font_fmt_txt_cache_size_is_limited(void)
+{
+    lv_cache_t * cache = get_glyph_cache();
+    size_t max_size = lv_cache_get_max_size(cache, NULL);
+
+    /*The large glyphs of all the letters need more memory than what the cache can use*/
+    size_t total_size = 0;
+    uint32_t letter;
+    for(letter = 'A'; letter <= 'z'; letter++) {
+        lv_font_glyph_dsc_t g;
+        TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&lv_font_montserrat_48, &g, letter, 0));
+        total_size += lv_draw_buf_width_to_stride(g.box_w, LV_COLOR_FORMAT_A8) * g.box_h;
+
+        TEST_ASSERT_NOT_NULL(touch_glyph(&lv_font_montserrat_48, letter));
+        TEST_ASSERT_LESS_OR_EQUAL(max_size, lv_cache_get_size(cache, NULL));
+    }
+
+    TEST_ASSERT_GREATER_THAN(max_size, total_size);
+}
+
+void test_font_fmt_txt_cache_binfont_destroy(void)
+{
+    /*Nothing is evicted while the glyphs below are added*/
+    lv_cache_t * cache = get_glyph_cache();
+    lv_cache_drop_all(cache, NULL);
+
+    lv_font_t * font_1 = lv_binfont_create_from_buffer((void *)test_font_1_buf, sizeof(test_font_1_buf));
+    lv_font_t * font_2 = lv_binfont_create_from_buffer((void *)test_font_2_buf, sizeof(test_font_2_buf));
+    TEST_ASSERT_NOT_NULL(font_1);
+    TEST_ASSERT_NOT_NULL(font_2);
+
+    lv_cache_entry_t * entry_2 = touch_glyph(font_2, 'A');
+    lv_cache_entry_t * entry_builtin = touch_glyph(&lv_font_montserrat_14, 'A');
+    size_t size_before = lv_cache_get_size(cache, NULL);
+    TEST_ASSERT_NOT_NULL(touch_glyph(font_1, 'A'));
+    TEST_ASSERT_NOT_NULL(touch_glyph(font_1, 'g'));
+    TEST_ASSERT_GREATER_THAN(size_before, lv_cache_get_size(cache, NULL));
+
+    /*Only the glyphs of the destroyed font are freed*/
+    lv_binfont_destroy(font_1);
+    TEST_ASSERT_EQUAL(size_before, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_EQUAL_PTR(entry_2, touch_glyph(font_2, 'A'));
+    TEST_ASSERT_EQUAL_PTR(entry_builtin, touch_glyph(&lv_font_montserrat_14, 'A'));
+
+    lv_binfont_destroy(font_2);
+}
+
+void test_font_fmt_txt_cache_label_from_cache(void)
+{
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_label_set_text(label, "Cached glyphs are drawn the same way\nCached glyphs are drawn the same way");
+    lv_obj_center(label);
+
+    /*Cache the glyphs first so that the screenshot is drawn from the cache*/
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/font_fmt_txt_cache.png");
+}
+
+#endif
@@ -0,0 +1,176 @@
+#if LV_BUILD_TEST
+
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+static void init_grad(lv_grad_dsc_t * g, lv_color_t c1, lv_color_t c2)
+{
+    lv_memzero(g, sizeof(*g));
+    g->dir = LV_GRAD_DIR_VER;
+    g->stops_count = 2;
+    g->stops[0].color = c1;
+    g->stops[0].opa = LV_OPA_COVER;
+    g->stops[0].frac = 0;
+    g->stops[1].color = c2;
+    g->stops[1].opa = LV_OPA_50;
+    g->stops[1].frac = 255;
+}
+
+void setUp(void)
+{
+    lv_gradient_cache_resize(LV_DRAW_SW_GRADIENT_CACHE_SIZE);
+    lv_gradient_cache_drop_all();
+    lv_gradient_cache_monitor_reset();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_gradient_cache_hit(void)
+{
+    lv_grad_dsc_t g;
+    init_grad(&g, lv_color_hex(0xff0000), lv_color_hex(0x0000ff));
+
+    lv_grad_t * grad1 = lv_gradient_get(&g, 100, 50);
+    TEST_ASSERT_NOT_NULL(grad1);
+    TEST_ASSERT_NOT_NULL(grad1->cache_entry);
+    TEST_ASSERT_EQUAL_UINT32(50, grad1->size);
+
+    /*The width doesn't matter for vertical gradients*/
+    lv_grad_t * grad2 = lv_gradient_get(&g, 30, 50);
+    TEST_ASSERT_EQUAL_PTR(grad1, grad2);
+
+    uint32_t i;
+    for(i = 0; i < grad1->size; i++) {
+        lv_color_t c;
+        lv_opa_t opa;
+        lv_gradient_color_calculate(&g, grad1->size, i, &c, &opa);
+        TEST_ASSERT_EQUAL_HEX32(lv_color_to_u32(c), lv_color_to_u32(grad1->color_map[i]));
+        TEST_ASSERT_EQUAL_UINT8(opa, grad1->opa_map[i]);
+    }
+
+    lv_gradient_cleanup(grad1);
+    lv_gradient_cleanup(grad2);
+
+    lv_gradient_cache_monitor_t mon;
+    lv_gradient_cache_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(1, mon.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, mon.miss_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(50 * 4, mon.size);
+    TEST_ASSERT_EQUAL_UINT32(LV_DRAW_SW_GRADIENT_CACHE_SIZE, mon.max_size);
+}
+
+void test_gradient_cache_miss(void)
+{
+    lv_grad_dsc_t g;
+    init_grad(&g, lv_color_hex(0xff0000), lv_color_hex(0x0000ff));
+    lv_grad_t * grad1 = lv_gradient_get(&g, 100, 50);
+
+    /*Different size*/
+    lv_grad_t * grad2 = lv_gradient_get(&g, 100, 51);
+    TEST_ASSERT_NOT_EQUAL(grad1, grad2);
+    lv_gradient_cleanup(grad2);
+
+    /*Different color*/
+    g.stops[1].color = lv_color_hex(0x00ff00);
+    grad2 = lv_gradient_get(&g, 100, 50);
+    TEST_ASSERT_NOT_EQUAL(grad1, grad2);
+    lv_gradient_cleanup(grad2);
+
+    /*Different direction*/
+    init_grad(&g, lv_color_hex(0xff0000), lv_color_hex(0x0000ff));
+    g.dir = LV_GRAD_DIR_HOR;
+    grad2 = lv_gradient_get(&g, 50, 100);
+    TEST_ASSERT_NOT_EQUAL(grad1, grad2);
+    lv_gradient_cleanup(grad2);
+
+    /*The unused stops don't matter*/
+    g.dir = LV_GRAD_DIR_VER;
+    g.stops[LV_GRADIENT_MAX_STOPS - 1].frac = 123;
+    if(LV_GRADIENT_MAX_STOPS > 2) {
+        grad2 = lv_gradient_get(&g, 100, 50);
+        TEST_ASSERT_EQUAL_PTR(grad1, grad2);
+        lv_gradient_cleanup(grad2);
+    }
+
+    lv_gradient_cleanup(grad1);
+
+    lv_gradient_cache_monitor_t mon;
+    lv_gradient_cache_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(4, mon.miss_cnt);
+}
+
+void test_gradient_cache_disabled(void)
+{
+    lv_gradient_cache_resize(0);
+
+    lv_grad_dsc_t g;
+    init_grad(&g, lv_color_hex(0xff0000), lv_color_hex(0x0000ff));
+    lv_grad_t * grad = lv_gradient_get(&g, 100, 50);
+    TEST_ASSERT_NOT_NULL(grad);
+    TEST_ASSERT_NULL(grad->cache_entry);
+    lv_gradient_cleanup(grad);
+
+    /*Larger than the whole cache*/
+    lv_gradient_cache_resize(LV_DRAW_SW_GRADIENT_CACHE_SIZE);
+    grad = lv_gradient_get(&g, 100, LV_DRAW_SW_GRADIENT_CACHE_SIZE);
+    TEST_ASSERT_NOT_NULL(grad);
+    TEST_ASSERT_NULL(grad->cache_entry);
+    lv_gradient_cleanup(grad);
+
+    lv_gradient_cache_monitor_t mon;
+    lv_gradient_cache_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, mon.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.size);
+}
+
+void test_gradient_cache_evict(void)
+{
+    /*Fill the cache with many different gradients. The least recently used ones are dropped*/
+    lv_grad_dsc_t g;
+    init_grad(&g, lv_color_hex(0xff0000), lv_color_hex(0x0000ff));
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        lv_grad_t * grad = lv_gradient_get(&g, 10, 100 + i);
+        TEST_ASSERT_NOT_NULL(grad);
+        lv_gradient_cleanup(grad);
+    }
+
+    lv_gradient_cache_monitor_t mon;
+    lv_gradient_cache_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(100, mon.miss_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(mon.max_size, mon.size);
+
+    /*The most recent one is still cached*/
+    lv_grad_t * grad = lv_gradient_get(&g, 10, 199);
+    lv_gradient_cleanup(grad);
+    lv_gradient_cache_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(1, mon.hit_cnt);
+}
+
+void test_gradient_cache_render(void)
+{
+    /*The same gradient is used on all the buttons, so it needs to be calculated only once*/
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_screen_active());
+        lv_obj_set_size(obj, 100, 40);
+        lv_obj_set_pos(obj, 10 + (i % 5) * 120, 10 + (i / 5) * 60);
+        lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0000), 0);
+        lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0x0000ff), 0);
+        lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, 0);
+    }
+
+    lv_refr_now(NULL);
+
+    lv_gradient_cache_monitor_t mon;
+    lv_gradient_cache_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(1, mon.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(9, mon.hit_cnt);
+}
+
+#endif
@@ -0,0 +1,152 @@
+#if LV_BUILD_TEST
+
+#include "../lvgl.h"
+#include "../../../src/misc/cache/lv_cache_private.h"
+
+#include "unity/unity.h"
+
+#if LV_DRAW_SW_SHADOW_CACHE_MEM_SIZE
+    #define SHADOW_CACHE_MEM_SIZE LV_DRAW_SW_SHADOW_CACHE_MEM_SIZE
+#else
+    #define SHADOW_CACHE_MEM_SIZE (4 * LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE)
+#endif
+
+static lv_cache_create_cb_t create_cb_ori;
+static uint32_t create_cnt;
+
+/*Count how many corners are calculated*/
+static bool create_cb_count(void * data, void * user_data)
+{
+    create_cnt++;
+    return create_cb_ori(data, user_data);
+}
+
+static lv_cache_t * get_cache(void)
+{
+    return LV_GLOBAL_DEFAULT()->sw_shadow_cache;
+}
+
+static lv_obj_t * card_create(int32_t w, int32_t h, int32_t shadow_width, int32_t radius)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0xf0f0f0), 0);
+    lv_obj_set_style_radius(obj, radius, 0);
+    lv_obj_set_style_shadow_width(obj, shadow_width, 0);
+    lv_obj_set_style_shadow_color(obj, lv_color_hex(0x303060), 0);
+    return obj;
+}
+
+/*Render the shadow of a card alone and delete the card*/
+static void render_shadow(int32_t shadow_width, int32_t radius)
+{
+    lv_obj_t * obj = card_create(200, 200, shadow_width, radius);
+    lv_obj_center(obj);
+    lv_refr_now(NULL);
+    lv_obj_delete(obj);
+}
+
+void setUp(void)
+{
+    lv_cache_t * cache = get_cache();
+    lv_cache_drop_all(cache, NULL);
+    lv_cache_set_max_size(cache, SHADOW_CACHE_MEM_SIZE, NULL);
+    create_cb_ori = cache->ops.create_cb;
+    lv_cache_set_create_cb(cache, create_cb_count, NULL);
+    create_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_cache_set_create_cb(get_cache(), create_cb_ori, NULL);
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_shadow_cache_variants(void)
+{
+    /*Corners of 20 + 10 and 30 + 20 px*/
+    lv_obj_t * obj = card_create(200, 150, 20, 10);
+    lv_obj_align(obj, LV_ALIGN_LEFT_MID, 100, 0);
+    obj = card_create(200, 150, 30, 20);
+    lv_obj_align(obj, LV_ALIGN_RIGHT_MID, -100, 0);
+
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, create_cnt);
+    TEST_ASSERT_EQUAL(30 * 30 + 50 * 50, lv_cache_get_size(get_cache(), NULL));
+
+    /*Both are kept for the next refreshes*/
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+        TEST_ASSERT_EQUAL_UINT32(2, create_cnt);
+        TEST_ASSERT_EQUAL(30 * 30 + 50 * 50, lv_cache_get_size(get_cache(), NULL));
+    }
+}
+
+void test_shadow_cache_evict_least_recently_used(void)
+{
+    /*Different corners of LV_DRAW_SW_SHADOW_CACHE_SIZE, one more than what fits into the cache*/
+    const int32_t corner_size = LV_DRAW_SW_SHADOW_CACHE_SIZE;
+    int32_t fit_cnt = SHADOW_CACHE_MEM_SIZE / (corner_size * corner_size);
+    TEST_ASSERT_GREATER_OR_EQUAL_INT32(2, fit_cnt);
+    TEST_ASSERT_LESS_THAN_INT32((corner_size - 4) / 2, fit_cnt);
+    TEST_ASSERT_EQUAL(SHADOW_CACHE_MEM_SIZE, lv_cache_get_max_size(get_cache(), NULL));
+
+    int32_t i;
+    for(i = 0; i < fit_cnt; i++) {
+        render_shadow(corner_size - 4 - 2 * i, 4 + 2 * i);
+    }
+    TEST_ASSERT_EQUAL_UINT32(fit_cnt, create_cnt);
+    TEST_ASSERT_EQUAL(fit_cnt * corner_size * corner_size, lv_cache_get_size(get_cache(), NULL));
+
+    /*Use the first one again so the second one becomes the least recently used*/
+    render_shadow(corner_size - 4, 4);
+    TEST_ASSERT_EQUAL_UINT32(fit_cnt, create_cnt);
+
+    /*A new one evicts the second one*/
+    render_shadow(corner_size - 4 - 2 * fit_cnt, 4 + 2 * fit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(fit_cnt + 1, create_cnt);
+    TEST_ASSERT_EQUAL(fit_cnt * corner_size * corner_size, lv_cache_get_size(get_cache(), NULL));
+
+    /*All the others are still cached*/
+    render_shadow(corner_size - 4, 4);
+    for(i = 2; i <= fit_cnt; i++) {
+        render_shadow(corner_size - 4 - 2 * i, 4 + 2 * i);
+    }
+    TEST_ASSERT_EQUAL_UINT32(fit_cnt + 1, create_cnt);
+
+    /*The evicted one is calculated again*/
+    render_shadow(corner_size - 6, 6);
+    TEST_ASSERT_EQUAL_UINT32(fit_cnt + 2, create_cnt);
+}
+
+void test_shadow_cache_shared_by_sizes(void)
+{
+    /*The sides are far enough from the corners, so all these cards use the same corner*/
+    lv_obj_t * obj = card_create(200, 150, 20, 10);
+    lv_obj_set_pos(obj, 40, 40);
+    obj = card_create(360, 100, 20, 10);
+    lv_obj_set_pos(obj, 320, 40);
+    obj = card_create(100, 200, 20, 10);
+    lv_obj_set_pos(obj, 40, 240);
+
+    /*Small enough to make the sides affect the corner*/
+    obj = card_create(30, 30, 20, 10);
+    lv_obj_set_pos(obj, 320, 240);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/shadow_cache_shared.png");
+    TEST_ASSERT_EQUAL_UINT32(2, create_cnt);
+    TEST_ASSERT_EQUAL(2 * 30 * 30, lv_cache_get_size(get_cache(), NULL));
+
+    /*Without the cache the corners are calculated for each card in the same way*/
+    lv_cache_drop_all(get_cache(), NULL);
+    lv_cache_set_max_size(get_cache(), 0, NULL);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/shadow_cache_shared.png");
+    TEST_ASSERT_EQUAL_UINT32(2, create_cnt);
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(get_cache(), NULL));
+}
+
+#endif
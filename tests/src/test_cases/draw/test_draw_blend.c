@@ -166,4 +166,168 @@ void test_rgb565(void)
     canvas_draw("rgb565", LV_COLOR_FORMAT_RGB565);
 }
 
+/**
+ * Draw rectangles and images of many widths to have all kind of
+ * remainders at the end of the lines if the rows are processed in blocks
+ */
+static void canvas_draw_widths(lv_obj_t * canvas, lv_color_format_t cf, uint8_t * buf)
+{
+    lv_canvas_set_buffer(canvas, buf, 190, 110, cf);
+    lv_canvas_fill_bg(canvas, lv_palette_lighten(LV_PALETTE_BLUE_GREY, 2), LV_OPA_70);
+
+    static uint8_t img_buf[CANVAS_WIDTH_TO_STRIDE(37, 4) * 9 + LV_DRAW_BUF_ALIGN];
+    lv_draw_buf_t img;
+    lv_draw_buf_init(&img, 37, 9, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO,
+                     lv_draw_buf_align(img_buf, LV_COLOR_FORMAT_ARGB8888), sizeof(img_buf) - LV_DRAW_BUF_ALIGN);
+    uint32_t x;
+    uint32_t y;
+    for(y = 0; y < 9; y++) {
+        lv_color32_t * row = (lv_color32_t *)(img.data + y * img.header.stride);
+        for(x = 0; x < 37; x++) {
+            row[x].red = x * 7;
+            row[x].green = y * 28;
+            row[x].blue = 255 - x * 6;
+            row[x].alpha = (x * 13 + y * 31) & 0xFF;
+        }
+    }
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.src = &img;
+
+    lv_area_t area;
+    uint32_t i;
+    for(i = 0; i < 19; i++) {
+        area.x1 = 2 + (i % 5) * 37;
+        area.y1 = 2 + (i / 5) * 27;
+        area.x2 = area.x1 + i + 16;
+        area.y2 = area.y1 + 12;
+
+        rect_dsc.bg_color = lv_palette_main((lv_palette_t)i);
+        rect_dsc.bg_opa = (i % 3) == 0 ? LV_OPA_COVER : 255 * i / 19;
+        rect_dsc.radius = i % 4 == 1 ? 0 : i / 2;
+        lv_draw_rect(&layer, &rect_dsc, &area);
+
+        area.y1 += 13;
+        area.y2 = area.y1 + 8;
+        img_dsc.opa = (i % 2) ? LV_OPA_COVER : LV_OPA_60;
+        /*Clip the image to the width of the rectangle*/
+        lv_area_t clip = layer._clip_area;
+        lv_area_t img_area = area;
+        img_area.x2 = img_area.x1 + 36;
+        layer._clip_area.x2 = area.x2;
+        lv_draw_image(&layer, &img_dsc, &img_area);
+        layer._clip_area = clip;
+    }
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+static void canvas_draw_blend_modes(lv_obj_t * canvas, lv_color_format_t cf, uint8_t * buf)
+{
+    lv_canvas_set_buffer(canvas, buf, 190, 110, cf);
+    lv_canvas_fill_bg(canvas, lv_color_hex(0x808080), LV_OPA_COVER);
+
+    /*A glow like ARGB8888 image and an RGB565 image*/
+    static uint8_t argb_buf[CANVAS_WIDTH_TO_STRIDE(48, 4) * 22 + LV_DRAW_BUF_ALIGN];
+    static uint8_t rgb565_buf[CANVAS_WIDTH_TO_STRIDE(48, 2) * 22 + LV_DRAW_BUF_ALIGN];
+    lv_draw_buf_t argb_img;
+    lv_draw_buf_t rgb565_img;
+    lv_draw_buf_init(&argb_img, 48, 22, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO,
+                     lv_draw_buf_align(argb_buf, LV_COLOR_FORMAT_ARGB8888), sizeof(argb_buf) - LV_DRAW_BUF_ALIGN);
+    lv_draw_buf_init(&rgb565_img, 48, 22, LV_COLOR_FORMAT_RGB565, LV_STRIDE_AUTO,
+                     lv_draw_buf_align(rgb565_buf, LV_COLOR_FORMAT_RGB565), sizeof(rgb565_buf) - LV_DRAW_BUF_ALIGN);
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < 22; y++) {
+        lv_color32_t * argb_row = (lv_color32_t *)(argb_img.data + y * argb_img.header.stride);
+        uint16_t * rgb565_row = (uint16_t *)(rgb565_img.data + y * rgb565_img.header.stride);
+        for(x = 0; x < 48; x++) {
+            int32_t d = LV_ABS(x - 24) * 5 + LV_ABS(y - 11) * 11;
+            argb_row[x].red = 255 - x * 2;
+            argb_row[x].green = 40 + y * 8;
+            argb_row[x].blue = x * 5;
+            argb_row[x].alpha = d < 255 ? 255 - d : 0;
+            rgb565_row[x] = lv_color_to_u16(lv_color_make(x * 5, 255 - y * 11, 128));
+        }
+    }
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    /*Colorful, partly transparent background*/
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    lv_area_t area;
+    uint32_t i;
+    for(i = 0; i < 6; i++) {
+        area.x1 = i * 32;
+        area.y1 = 0;
+        area.x2 = area.x1 + 31;
+        area.y2 = 109;
+        rect_dsc.bg_color = lv_palette_main((lv_palette_t)(i * 3));
+        rect_dsc.bg_opa = cf == LV_COLOR_FORMAT_ARGB8888 && i % 2 ? LV_OPA_50 : LV_OPA_COVER;
+        lv_draw_rect(&layer, &rect_dsc, &area);
+    }
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+
+    /*A column for each blend mode and a row for each image and opacity*/
+    for(i = 0; i < 12; i++) {
+        img_dsc.blend_mode = LV_BLEND_MODE_ADDITIVE + i % 3;
+        img_dsc.src = i < 6 ? &argb_img : &rgb565_img;
+        img_dsc.opa = (i / 3) % 2 ? LV_OPA_50 : LV_OPA_COVER;
+        area.x1 = 6 + (i % 3) * 62;
+        area.y1 = 4 + (i / 3) * 27;
+        area.x2 = area.x1 + 47;
+        area.y2 = area.y1 + 21;
+        lv_draw_image(&layer, &img_dsc, &area);
+    }
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+void test_line_remainders(void)
+{
+    lv_obj_clean(lv_screen_active());
+
+    static uint8_t bufs[4][CANVAS_WIDTH_TO_STRIDE(190, 4) * 110 + LV_DRAW_BUF_ALIGN];
+    static const lv_color_format_t cfs[4] = {LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB888,
+                                             LV_COLOR_FORMAT_XRGB8888, LV_COLOR_FORMAT_ARGB8888
+                                            };
+
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+        canvas_draw_widths(canvas, cfs[i], lv_draw_buf_align(bufs[i], cfs[i]));
+    }
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/blend_line_remainders.png");
+}
+
+void test_blend_modes(void)
+{
+    lv_obj_clean(lv_screen_active());
+
+    static uint8_t bufs[4][CANVAS_WIDTH_TO_STRIDE(190, 4) * 110 + LV_DRAW_BUF_ALIGN];
+    static const lv_color_format_t cfs[4] = {LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB888,
+                                             LV_COLOR_FORMAT_XRGB8888, LV_COLOR_FORMAT_ARGB8888
+                                            };
+
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+        canvas_draw_blend_modes(canvas, cfs[i], lv_draw_buf_align(bufs[i], cfs[i]));
+    }
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/blend_modes.png");
+}
+
 #endif
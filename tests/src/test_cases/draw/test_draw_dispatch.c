@@ -0,0 +1,336 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include "../../../src/display/lv_display_private.h"
+
+#define CANVAS_W    400
+#define CANVAS_H    300
+
+static lv_obj_t * canvas;
+static uint32_t rnd_seed;
+
+static uint32_t rnd(void)
+{
+    rnd_seed = rnd_seed * 1103515245 + 12345;
+    return (rnd_seed >> 16) & 0x7fff;
+}
+
+static lv_color_t rect_color(uint32_t i)
+{
+    return lv_color_hex((i * 0x2f6b1d + 0x10) & 0xffffff);
+}
+
+static void get_rect_area(uint32_t i, lv_area_t * a)
+{
+    LV_UNUSED(i);
+    a->x1 = (int32_t)(rnd() % CANVAS_W) - 20;
+    a->y1 = (int32_t)(rnd() % CANVAS_H) - 20;
+    a->x2 = a->x1 + (int32_t)(rnd() % 60);
+    a->y2 = a->y1 + (int32_t)(rnd() % 40);
+}
+
+static void add_rects(lv_layer_t * layer, uint32_t cnt, bool shadow)
+{
+    rnd_seed = 1;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_area_t a;
+        get_rect_area(i, &a);
+
+        lv_draw_rect_dsc_t dsc;
+        lv_draw_rect_dsc_init(&dsc);
+        dsc.bg_color = rect_color(i);
+        dsc.radius = 0;
+        if(shadow && i % 7 == 0) {
+            dsc.shadow_width = 10;
+            dsc.shadow_offset_x = 30;
+            dsc.shadow_opa = LV_OPA_50;
+        }
+        lv_draw_rect(layer, &dsc, &a);
+    }
+}
+
+static uint32_t get_dependent_count_ref(lv_draw_task_t * t_check)
+{
+    uint32_t cnt = 0;
+    lv_draw_task_t * t = t_check->next;
+    while(t) {
+        if((t->state == LV_DRAW_TASK_STATE_QUEUED || t->state == LV_DRAW_TASK_STATE_WAITING) &&
+           _lv_area_is_on(&t_check->area, &t->area)) {
+            cnt++;
+        }
+        t = t->next;
+    }
+    return cnt;
+}
+
+void setUp(void)
+{
+    static uint8_t buf[LV_CANVAS_BUF_SIZE(CANVAS_W, CANVAS_H, 32, LV_DRAW_BUF_STRIDE_ALIGN)];
+    canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_buffer(canvas, buf, CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_ARGB8888);
+    lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_COVER);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_draw_dispatch_dependent_count(void)
+{
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    add_rects(&layer, 1000, true);
+
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        TEST_ASSERT_EQUAL_UINT32(get_dependent_count_ref(t), lv_draw_get_dependent_count(t));
+        t = t->next;
+    }
+
+    lv_canvas_finish_layer(canvas, &layer);
+    TEST_ASSERT_NULL(layer.draw_task_head);
+    TEST_ASSERT_NULL(layer._task_index);
+}
+
+void test_draw_dispatch_keeps_order(void)
+{
+    const uint32_t cnt = 2000;
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+    add_rects(&layer, cnt, false);
+    lv_canvas_finish_layer(canvas, &layer);
+
+    /*The color of each pixel needs to be the color of the last rectangle covering it*/
+    lv_area_t * areas = lv_malloc(cnt * sizeof(lv_area_t));
+    rnd_seed = 1;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) get_rect_area(i, &areas[i]);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < CANVAS_H; y += 3) {
+        for(x = 0; x < CANVAS_W; x += 3) {
+            lv_color_t c_exp = lv_color_black();
+            lv_point_t p = {x, y};
+            for(i = cnt; i > 0; i--) {
+                if(_lv_area_is_point_on(&areas[i - 1], &p, 0)) {
+                    c_exp = rect_color(i - 1);
+                    break;
+                }
+            }
+
+            lv_color32_t c_act = lv_canvas_get_px(canvas, x, y);
+            TEST_ASSERT_EQUAL_HEX32(lv_color_to_u32(c_exp), lv_color_to_u32(lv_color_make(c_act.red, c_act.green,
+                                                                                          c_act.blue)));
+        }
+    }
+
+    lv_free(areas);
+}
+
+void test_draw_dispatch_arena_monitor(void)
+{
+    lv_draw_arena_monitor_reset();
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+    add_rects(&layer, 10, false);
+
+    lv_draw_arena_monitor_t mon;
+    lv_draw_arena_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(LV_DRAW_LAYER_ARENA_SIZE, mon.size);
+    TEST_ASSERT_GREATER_THAN_UINT32(10 * sizeof(lv_draw_task_t), mon.max_required);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.fallback_cnt);
+    TEST_ASSERT_EQUAL_UINT32(mon.max_required, mon.max_used);
+
+    lv_canvas_finish_layer(canvas, &layer);
+    TEST_ASSERT_NULL(layer._arena.buf);
+
+    /*Much more than what fits into the arena, so the heap needs to be used too*/
+    lv_canvas_init_layer(canvas, &layer);
+    add_rects(&layer, 1000, false);
+    lv_canvas_finish_layer(canvas, &layer);
+
+    lv_draw_arena_monitor(&mon);
+    TEST_ASSERT_GREATER_THAN_UINT32(LV_DRAW_LAYER_ARENA_SIZE, mon.max_required);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_DRAW_LAYER_ARENA_SIZE, mon.max_used);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, mon.fallback_cnt);
+}
+
+void test_draw_dispatch_task_monitor(void)
+{
+    lv_draw_task_monitor_reset();
+    lv_draw_sw_blend_monitor_reset();
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_area_t a = {10, 10, 59, 29};
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = lv_color_hex(0xff0000);
+    lv_draw_rect(&layer, &dsc, &a);
+
+    /*Partially out of the canvas, only the visible part is counted*/
+    lv_area_t b = {CANVAS_W - 10, 0, CANVAS_W + 9, 9};
+    lv_draw_rect(&layer, &dsc, &b);
+
+    lv_draw_task_monitor_t mon;
+    lv_draw_task_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(2, mon.task_cnt);
+    TEST_ASSERT_EQUAL_UINT32(50 * 20 + 10 * 10, mon.task_px_cnt);
+
+    lv_canvas_finish_layer(canvas, &layer);
+
+    lv_draw_sw_blend_monitor_t blend_mon;
+    lv_draw_sw_blend_monitor(&blend_mon);
+    TEST_ASSERT_EQUAL_UINT32(50 * 20 + 10 * 10, blend_mon.fill_px_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, blend_mon.image_px_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(2, blend_mon.call_cnt);
+
+    lv_draw_task_monitor_reset();
+    lv_draw_task_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.task_cnt);
+}
+
+static void add_rounded_arc(lv_layer_t * layer)
+{
+    lv_draw_arc_dsc_t dsc;
+    lv_draw_arc_dsc_init(&dsc);
+    dsc.center.x = 100;
+    dsc.center.y = 100;
+    dsc.radius = 80;
+    dsc.width = 60;
+    dsc.start_angle = 0;
+    dsc.end_angle = 270;
+    dsc.rounded = 1;
+    lv_draw_arc(layer, &dsc);
+}
+
+void test_draw_dispatch_scratch_monitor(void)
+{
+    lv_draw_sw_scratch_monitor_reset();
+
+    /*The row mask is allocated first and fits into the buffer, but the large circle mask doesn't*/
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+    add_rounded_arc(&layer);
+    lv_canvas_finish_layer(canvas, &layer);
+
+    lv_draw_sw_scratch_monitor_t mon;
+    lv_draw_sw_scratch_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(1, mon.fallback_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(60 * 60, mon.max_required);
+    TEST_ASSERT_LESS_THAN_UINT32(mon.max_required, mon.size);
+
+    /*The buffer is enlarged to the size required by the previous task so no heap is used*/
+    lv_draw_sw_scratch_monitor_reset();
+    lv_canvas_init_layer(canvas, &layer);
+    add_rounded_arc(&layer);
+    add_rounded_arc(&layer);
+    lv_canvas_finish_layer(canvas, &layer);
+
+    lv_draw_sw_scratch_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(1, mon.grow_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.fallback_cnt);
+    TEST_ASSERT_EQUAL_UINT32(mon.max_required, mon.max_used);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(mon.max_used, mon.size);
+}
+
+void test_draw_dispatch_scratch_free_in_loop(void)
+{
+    /*Allocating and freeing in a loop requires only one buffer, also with heap fallbacks*/
+    lv_draw_unit_t * u;
+    for(u = LV_GLOBAL_DEFAULT()->draw_info.unit_head; u; u = u->next) {
+        lv_draw_sw_scratch_monitor_reset();
+        uint32_t i;
+        for(i = 0; i < 20; i++) {
+            void * p1 = lv_draw_sw_scratch_alloc(u, 1000);
+            void * p2 = lv_draw_sw_scratch_alloc(u, 100000);
+            TEST_ASSERT_NOT_NULL(p1);
+            TEST_ASSERT_NOT_NULL(p2);
+            lv_draw_sw_scratch_free(u, p2);
+            lv_draw_sw_scratch_free(u, p1);
+        }
+
+        lv_draw_sw_scratch_monitor_t mon;
+        lv_draw_sw_scratch_monitor(&mon);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(101000 + 16, mon.max_required);
+    }
+}
+
+static void add_fill(lv_layer_t * layer, int32_t x1, int32_t y1, int32_t x2, int32_t y2, lv_color_t color,
+                     lv_opa_t opa)
+{
+    lv_area_t a = {x1, y1, x2, y2};
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = color;
+    dsc.bg_opa = opa;
+    lv_draw_rect(layer, &dsc, &a);
+}
+
+void test_draw_dispatch_cull_occluded(void)
+{
+    lv_draw_cull_monitor_reset();
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    /*Covered by the last fill*/
+    add_fill(&layer, 10, 10, 109, 109, lv_color_hex(0xff0000), LV_OPA_COVER);
+    add_fill(&layer, 20, 20, 59, 59, lv_color_hex(0x00ff00), LV_OPA_50);
+
+    /*Its bottom 10 rows are not covered*/
+    add_fill(&layer, 0, 0, 199, 129, lv_color_hex(0x0000ff), LV_OPA_COVER);
+
+    /*Transparent so it doesn't cover anything, but its top 120 rows are covered*/
+    add_fill(&layer, 0, 0, 149, 149, lv_color_hex(0x00ffff), LV_OPA_50);
+
+    add_fill(&layer, 0, 0, 199, 119, lv_color_hex(0xffffff), LV_OPA_COVER);
+
+    lv_draw_cull_monitor_t mon;
+    lv_draw_cull_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(2, mon.culled_task_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, mon.clipped_task_cnt);
+    TEST_ASSERT_EQUAL_UINT32(100 * 100 + 40 * 40 + 200 * 120 + 150 * 120, mon.culled_px_cnt);
+
+    lv_canvas_finish_layer(canvas, &layer);
+
+    /*Only the visible parts need to be rendered*/
+    lv_color32_t c = lv_canvas_get_px(canvas, 50, 50);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_to_u32(lv_color_white()), lv_color_to_u32(lv_color_make(c.red, c.green, c.blue)));
+    c = lv_canvas_get_px(canvas, 160, 125);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_to_u32(lv_color_hex(0x0000ff)),
+                            lv_color_to_u32(lv_color_make(c.red, c.green, c.blue)));
+    c = lv_canvas_get_px(canvas, 50, 125);
+    TEST_ASSERT_UINT8_WITHIN(2, 0x80, c.green);
+    TEST_ASSERT_UINT8_WITHIN(2, 0xff, c.blue);
+}
+
+void test_draw_dispatch_index_kept_for_display(void)
+{
+    /*Overlapping objects on the screen to have some draw tasks in the display's layer*/
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_screen_active());
+        lv_obj_set_pos(obj, i * 20, i * 10);
+    }
+
+    lv_display_t * disp = lv_display_get_default();
+    lv_refr_now(disp);
+    lv_draw_task_index_t * index = disp->layer_head->_task_index;
+    TEST_ASSERT_NOT_NULL(index);
+
+    /*Reused by the next refresh instead of allocating a new one*/
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_PTR(index, disp->layer_head->_task_index);
+}
+
+#endif
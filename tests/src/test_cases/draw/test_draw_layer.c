@@ -68,5 +68,44 @@ void test_draw_layer_bitmap_mask_from_image_not_found(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("draw/draw_layer_bitmap_mask_not_masked.png");
 }
 
+void test_draw_layer_pool_reuses_buffers(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 200, 150);
+    lv_obj_set_pos(obj, 50, 50);
+    lv_obj_set_style_bg_color(obj, lv_color_hex3(0xf88), 0);
+    lv_obj_set_style_opa(obj, LV_OPA_50, 0);
+
+    obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 200, 150);
+    lv_obj_set_pos(obj, 400, 200);
+    lv_obj_set_style_bg_color(obj, lv_color_hex3(0x88f), 0);
+    lv_obj_set_style_transform_rotation(obj, 200, 0);
+
+    /*The first frame fills the pool*/
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/draw_layer_pool.png");
+
+    /*The same layers again, each buffer should come from the pool and be cleared*/
+    lv_draw_layer_pool_monitor_reset();
+    lv_obj_invalidate(lv_screen_active());
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/draw_layer_pool.png");
+
+    lv_draw_layer_pool_monitor_t mon;
+    lv_draw_layer_pool_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(LV_DRAW_LAYER_POOL_SIZE, mon.size);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.miss_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, mon.hit_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, mon.idle_size);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_DRAW_LAYER_POOL_SIZE, mon.idle_size);
+
+    /*The idle buffers are counted as layer memory, rounded to kB one by one*/
+    TEST_ASSERT_UINT32_WITHIN(LV_DRAW_LAYER_POOL_SLOT_CNT, mon.idle_size / 1024,
+                              LV_GLOBAL_DEFAULT()->draw_info.used_memory_for_layers_kb);
+
+    lv_draw_layer_pool_flush();
+    lv_draw_layer_pool_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.idle_size);
+    TEST_ASSERT_EQUAL_UINT32(0, LV_GLOBAL_DEFAULT()->draw_info.used_memory_for_layers_kb);
+}
 
 #endif
@@ -0,0 +1,202 @@
+#if LV_BUILD_TEST
+/*The test builds use the default blur of the shadows, so build the shadow drawing with the box blur into this test*/
+#define LV_DRAW_SW_SHADOW_BLUR_PASSES   3
+
+#include "../lvgl.h"
+#include "../../../src/draw/sw/lv_draw_sw.h"
+
+#include "unity/unity.h"
+
+static uint32_t alloc_cnt;
+static uint32_t alloc_fail;
+
+/*Return NULL for the `alloc_fail`th allocation*/
+static void * scratch_alloc_may_fail(lv_draw_unit_t * draw_unit, size_t size)
+{
+    alloc_cnt++;
+    if(alloc_cnt == alloc_fail) return NULL;
+    return lv_draw_sw_scratch_alloc(draw_unit, size);
+}
+
+/*Different names than in the library*/
+#define lv_draw_sw_box_shadow           box_shadow_box_blur
+#define lv_draw_sw_shadow_cache_init    box_shadow_box_blur_cache_init
+#define lv_draw_sw_shadow_cache_deinit  box_shadow_box_blur_cache_deinit
+#define lv_draw_sw_box_shadow_is_cached box_shadow_box_blur_is_cached
+#define lv_draw_sw_scratch_alloc        scratch_alloc_may_fail
+void box_shadow_box_blur(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords);
+lv_result_t box_shadow_box_blur_cache_init(void);
+void box_shadow_box_blur_cache_deinit(void);
+bool box_shadow_box_blur_is_cached(const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords);
+
+#include "../../../src/draw/sw/lv_draw_sw_box_shadow.c"
+
+#undef lv_draw_sw_box_shadow
+#undef lv_draw_sw_shadow_cache_init
+#undef lv_draw_sw_shadow_cache_deinit
+#undef lv_draw_sw_box_shadow_is_cached
+#undef lv_draw_sw_scratch_alloc
+
+#define BUF_W   240
+#define BUF_H   200
+
+/*The corners are larger than `LV_DRAW_SW_SHADOW_CACHE_SIZE`,
+ *else the cache would calculate them with the default blur*/
+static const struct {
+    int32_t width;
+    int32_t radius;
+} shadows[] = {{60, 16}, {65, 0}, {50, 40}};
+
+static lv_draw_buf_t * draw_bufs[2];
+static lv_layer_t layer;
+static lv_area_t clip_area;
+static lv_draw_unit_t draw_unit;
+
+void setUp(void)
+{
+    alloc_cnt = 0;
+    alloc_fail = 0;
+
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        draw_bufs[i] = lv_draw_buf_create(BUF_W, BUF_H, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    }
+
+    lv_area_set(&clip_area, 0, 0, BUF_W - 1, BUF_H - 1);
+    lv_memzero(&layer, sizeof(layer));
+    layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+    layer.buf_area = clip_area;
+    lv_memzero(&draw_unit, sizeof(draw_unit));
+    draw_unit.target_layer = &layer;
+    draw_unit.clip_area = &clip_area;
+}
+
+void tearDown(void)
+{
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_draw_buf_destroy(draw_bufs[i]);
+    }
+}
+
+/**
+ * Draw a black shadow on a transparent buffer so the alpha of the pixels is the opacity of the shadow
+ * @param box_blur  true: use the box blur; false: use the default blur of the library
+ * @param s         index in `shadows`
+ * @return          the draw buffer
+ */
+static lv_draw_buf_t * draw_shadow(bool box_blur, uint32_t s)
+{
+    lv_draw_buf_t * draw_buf = draw_bufs[box_blur];
+    lv_draw_buf_clear(draw_buf, NULL);
+    layer.draw_buf = draw_buf;
+
+    lv_draw_box_shadow_dsc_t dsc;
+    lv_memzero(&dsc, sizeof(dsc));
+    dsc.width = shadows[s].width;
+    dsc.radius = shadows[s].radius;
+    dsc.color = lv_color_black();
+    dsc.opa = LV_OPA_COVER;
+
+    lv_area_t coords;
+    lv_area_set(&coords, 80, 70, BUF_W - 1 - 80, BUF_H - 1 - 70);
+
+    if(box_blur) box_shadow_box_blur(&draw_unit, &dsc, &coords);
+    else lv_draw_sw_box_shadow(&draw_unit, &dsc, &coords);
+
+    return draw_buf;
+}
+
+static int32_t get_opa(const lv_draw_buf_t * draw_buf, int32_t x, int32_t y)
+{
+    return ((const lv_color32_t *)(draw_buf->data + y * draw_buf->header.stride))[x].alpha;
+}
+
+void test_box_blur_shadow_is_symmetric(void)
+{
+    uint32_t s;
+    for(s = 0; s < sizeof(shadows) / sizeof(shadows[0]); s++) {
+        lv_draw_buf_t * draw_buf = draw_shadow(true, s);
+
+        /*The rectangle is centered. The shadow drawing rounds a little differently on the sides (with both blurs)*/
+        int32_t x;
+        int32_t y;
+        for(y = 0; y < BUF_H; y++) {
+            for(x = 0; x < BUF_W; x++) {
+                int32_t opa = get_opa(draw_buf, x, y);
+                TEST_ASSERT_INT32_WITHIN(1, opa, get_opa(draw_buf, BUF_W - 1 - x, y));
+                TEST_ASSERT_INT32_WITHIN(1, opa, get_opa(draw_buf, x, BUF_H - 1 - y));
+            }
+        }
+    }
+}
+
+void test_box_blur_shadow_fades_out(void)
+{
+    uint32_t s;
+    for(s = 0; s < sizeof(shadows) / sizeof(shadows[0]); s++) {
+        lv_draw_buf_t * draw_buf = draw_shadow(true, s);
+
+        /*Fading out from the left edge of the rectangle*/
+        int32_t y = BUF_H / 2;
+        TEST_ASSERT_GREATER_THAN(LV_OPA_40, get_opa(draw_buf, 79, y));
+        TEST_ASSERT_EQUAL(0, get_opa(draw_buf, 0, y));
+
+        int32_t x;
+        for(x = 1; x < 80; x++) {
+            TEST_ASSERT_LESS_OR_EQUAL(get_opa(draw_buf, x, y), get_opa(draw_buf, x - 1, y));
+        }
+    }
+}
+
+void test_box_blur_shadow_matches_default_blur(void)
+{
+    uint32_t s;
+    for(s = 0; s < sizeof(shadows) / sizeof(shadows[0]); s++) {
+        lv_draw_buf_t * box = draw_shadow(true, s);
+        lv_draw_buf_t * def = draw_shadow(false, s);
+
+        /*Both approximate a Gaussian blur, only the profile of the fading is a little different*/
+        int32_t sum_box = 0;
+        int32_t sum_def = 0;
+        int32_t x;
+        int32_t y;
+        for(y = 0; y < BUF_H; y++) {
+            for(x = 0; x < BUF_W; x++) {
+                TEST_ASSERT_INT32_WITHIN(24, get_opa(def, x, y), get_opa(box, x, y));
+                sum_box += get_opa(box, x, y);
+                sum_def += get_opa(def, x, y);
+            }
+        }
+
+        TEST_ASSERT_INT32_WITHIN(sum_def / 6, sum_def, sum_box);
+    }
+}
+
+void test_box_blur_shadow_out_of_memory(void)
+{
+    /*The 3rd and 4th allocations are the buffers of the blur*/
+    uint32_t f;
+    for(f = 3; f <= 4; f++) {
+        alloc_cnt = 0;
+        alloc_fail = f;
+        lv_draw_buf_t * draw_buf = draw_shadow(true, 0);
+        TEST_ASSERT_GREATER_OR_EQUAL(f, alloc_cnt);
+
+        /*Not drawn at all*/
+        int32_t x;
+        int32_t y;
+        for(y = 0; y < BUF_H; y++) {
+            for(x = 0; x < BUF_W; x++) {
+                TEST_ASSERT_EQUAL(0, get_opa(draw_buf, x, y));
+            }
+        }
+    }
+
+    /*Drawn again with enough memory*/
+    alloc_fail = 0;
+    lv_draw_buf_t * draw_buf = draw_shadow(true, 0);
+    TEST_ASSERT_GREATER_THAN(LV_OPA_40, get_opa(draw_buf, 79, BUF_H / 2));
+}
+
+#endif
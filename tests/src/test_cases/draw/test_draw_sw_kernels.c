@@ -0,0 +1,240 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define CANVAS_W    97
+#define CANVAS_H    61
+#define IMG_W       37
+#define IMG_H       23
+
+static lv_draw_buf_t * img;
+
+void setUp(void)
+{
+    img = lv_draw_buf_create(IMG_W, IMG_H, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    uint32_t x;
+    uint32_t y;
+    for(y = 0; y < IMG_H; y++) {
+        lv_color32_t * row = (lv_color32_t *)(img->data + y * img->header.stride);
+        for(x = 0; x < IMG_W; x++) {
+            row[x].red = x * 7;
+            row[x].green = y * 11;
+            row[x].blue = 255 - x * 5;
+            row[x].alpha = (x * 13 + y * 31) & 0xFF;
+        }
+    }
+}
+
+void tearDown(void)
+{
+    lv_draw_sw_set_kernel_features(LV_DRAW_SW_CPU_FEATURE_ALL);
+    lv_draw_buf_destroy(img);
+    lv_obj_clean(lv_screen_active());
+}
+
+static void render(lv_obj_t * canvas, lv_draw_buf_t * buf)
+{
+    lv_canvas_set_draw_buf(canvas, buf);
+    lv_canvas_fill_bg(canvas, lv_color_hex(0x3080c0), LV_OPA_60);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.src = img;
+
+    uint32_t i;
+    for(i = 0; i < 6; i++) {
+        lv_area_t area = {(int32_t)i * 13 - 5, (int32_t)i * 7 - 3, (int32_t)i * 13 + 17 + (int32_t)i, (int32_t)i * 7 + 19};
+        rect_dsc.bg_color = lv_palette_main((lv_palette_t)(i * 3));
+        rect_dsc.bg_opa = i % 2 ? LV_OPA_COVER : (lv_opa_t)(40 + i * 30);
+        rect_dsc.radius = i * 3;
+        lv_draw_rect(&layer, &rect_dsc, &area);
+
+        lv_area_t img_area = {(int32_t)i * 15 - 7, (int32_t)i * 9, 0, 0};
+        img_area.x2 = img_area.x1 + IMG_W - 1;
+        img_area.y2 = img_area.y1 + IMG_H - 1;
+        img_dsc.opa = i % 3 ? LV_OPA_COVER : LV_OPA_70;
+        img_dsc.rotation = i == 4 ? 300 : 0;
+        lv_draw_image(&layer, &img_dsc, &img_area);
+
+        /*Additive, subtractive and multiply*/
+        lv_area_t mode_area = {CANVAS_W - 1 - img_area.x2, img_area.y1 + 5, CANVAS_W - 1 - img_area.x1, img_area.y2 + 5};
+        img_dsc.blend_mode = LV_BLEND_MODE_ADDITIVE + i % 3;
+        img_dsc.rotation = 0;
+        lv_draw_image(&layer, &img_dsc, &mode_area);
+        img_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    }
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+static void render_and_compare(lv_color_format_t cf)
+{
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+    lv_draw_buf_t * ref = lv_draw_buf_create(CANVAS_W, CANVAS_H, cf, LV_STRIDE_AUTO);
+    lv_draw_buf_t * res = lv_draw_buf_create(CANVAS_W, CANVAS_H, cf, LV_STRIDE_AUTO);
+
+    lv_draw_sw_set_kernel_features(LV_DRAW_SW_CPU_FEATURE_NONE);
+    render(canvas, ref);
+
+    /*All supported instruction sets one by one*/
+    static const uint32_t features[] = {LV_DRAW_SW_CPU_FEATURE_SSE2, LV_DRAW_SW_CPU_FEATURE_ALL};
+    uint32_t i;
+    for(i = 0; i < sizeof(features) / sizeof(features[0]); i++) {
+        lv_draw_sw_set_kernel_features(features[i]);
+        render(canvas, res);
+        TEST_ASSERT_EQUAL_MEMORY(ref->data, res->data, ref->data_size);
+    }
+
+    lv_obj_delete(canvas);
+    lv_draw_buf_destroy(ref);
+    lv_draw_buf_destroy(res);
+}
+
+void test_cpu_features(void)
+{
+#if defined(__x86_64__)
+    TEST_ASSERT_TRUE(lv_draw_sw_get_cpu_features() & LV_DRAW_SW_CPU_FEATURE_SSE2);
+#endif
+
+    lv_draw_sw_set_kernel_features(LV_DRAW_SW_CPU_FEATURE_NONE);
+    const lv_draw_sw_kernels_t * kernels = lv_draw_sw_get_kernels();
+    TEST_ASSERT_NULL(kernels->color_blend_to_argb8888);
+    TEST_ASSERT_NULL(kernels->rgb565_swap);
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+    lv_draw_sw_set_kernel_features(LV_DRAW_SW_CPU_FEATURE_ALL);
+    TEST_ASSERT_NOT_NULL(kernels->color_blend_to_argb8888);
+    TEST_ASSERT_NOT_NULL(kernels->rgb565_swap);
+#endif
+}
+
+void test_blend_kernels_match_c(void)
+{
+    render_and_compare(LV_COLOR_FORMAT_RGB565);
+    render_and_compare(LV_COLOR_FORMAT_RGB888);
+    render_and_compare(LV_COLOR_FORMAT_XRGB8888);
+    render_and_compare(LV_COLOR_FORMAT_ARGB8888);
+}
+
+void test_rgb565_swap_matches_c(void)
+{
+    uint16_t ref[103];
+    uint16_t res[103];
+    uint32_t i;
+    for(i = 0; i < 103; i++) ref[i] = (uint16_t)(i * 0x9e37);
+    lv_memcpy(res, ref, sizeof(ref));
+
+    lv_draw_sw_set_kernel_features(LV_DRAW_SW_CPU_FEATURE_NONE);
+    lv_draw_sw_rgb565_swap(ref, 103);
+    lv_draw_sw_set_kernel_features(LV_DRAW_SW_CPU_FEATURE_ALL);
+    lv_draw_sw_rgb565_swap(res, 103);
+
+    TEST_ASSERT_EQUAL_HEX16(0x37 << 8 | 0x9e, ref[1]);
+    TEST_ASSERT_EQUAL_MEMORY(ref, res, sizeof(ref));
+}
+
+void test_rotate_matches_c(void)
+{
+    /*Smaller and larger than a tile with edges not divisible by the transposed blocks*/
+    static const lv_point_t sizes[] = {{23, 13}, {75, 41}, {8, 64}};
+    static const lv_color_format_t cfs[] = {LV_COLOR_FORMAT_ARGB8888, LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB888,
+                                            LV_COLOR_FORMAT_L8
+                                           };
+    static const lv_display_rotation_t rotations[] = {LV_DISPLAY_ROTATION_90, LV_DISPLAY_ROTATION_180, LV_DISPLAY_ROTATION_270};
+    static const uint32_t features[] = {LV_DRAW_SW_CPU_FEATURE_SSE2, LV_DRAW_SW_CPU_FEATURE_ALL};
+    static uint8_t src[80 * 80 * 4];
+    static uint8_t ref[80 * 80 * 4];
+    static uint8_t res[80 * 80 * 4];
+    uint32_t i;
+    for(i = 0; i < sizeof(src); i++) src[i] = (uint8_t)((i * 0x9E3779B1u) >> 24);
+
+    uint32_t s;
+    for(s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        int32_t w = sizes[s].x;
+        int32_t h = sizes[s].y;
+        uint32_t cf;
+        for(cf = 0; cf < sizeof(cfs) / sizeof(cfs[0]); cf++) {
+            /*Padded strides to see that nothing is written after the rows*/
+            int32_t px_size = lv_color_format_get_size(cfs[cf]);
+            int32_t src_stride = w * px_size + 4;
+            uint32_t r;
+            for(r = 0; r < 3; r++) {
+                int32_t dest_w = rotations[r] == LV_DISPLAY_ROTATION_180 ? w : h;
+                int32_t dest_stride = dest_w * px_size + 8;
+                lv_memset(ref, 0xA5, sizeof(ref));
+                lv_draw_sw_set_kernel_features(LV_DRAW_SW_CPU_FEATURE_NONE);
+                lv_draw_sw_rotate(src, ref, w, h, src_stride, dest_stride, rotations[r], cfs[cf]);
+
+                uint32_t f;
+                for(f = 0; f < sizeof(features) / sizeof(features[0]); f++) {
+                    lv_memset(res, 0xA5, sizeof(res));
+                    lv_draw_sw_set_kernel_features(features[f]);
+                    lv_draw_sw_rotate(src, res, w, h, src_stride, dest_stride, rotations[r], cfs[cf]);
+                    TEST_ASSERT_EQUAL_MEMORY(ref, res, sizeof(ref));
+                }
+            }
+        }
+    }
+}
+
+void test_transform_kernels_match_c(void)
+{
+    const int32_t w = 37;
+    const int32_t h = 23;
+    static uint8_t src[37 * 23 * 5];
+    uint32_t i;
+    for(i = 0; i < sizeof(src); i++) {
+        /*Runs of the same bytes to have equal neighbors, and some zero bytes for transparent pixels*/
+        src[i] = (i / 12) % 7 == 0 ? 0 : (uint8_t)(((i / 12) * 0x9E3779B1u) >> 24);
+    }
+
+    lv_area_t dest_area = {-9, -7, w + 8, h + 6};
+    int32_t dest_w = lv_area_get_width(&dest_area);
+    int32_t dest_h = lv_area_get_height(&dest_area);
+    static uint8_t ref[(37 + 18) * (23 + 14) * 5];
+    static uint8_t res[(37 + 18) * (23 + 14) * 5];
+
+    static const lv_color_format_t cfs[] = {LV_COLOR_FORMAT_ARGB8888, LV_COLOR_FORMAT_XRGB8888, LV_COLOR_FORMAT_RGB888,
+                                            LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB565A8
+                                           };
+    /*Rotation and scale*/
+    static const int32_t transforms[][2] = {{300, 256}, {900, 256}, {1235, 300}, {0, 384}, {0, 128}, {2700, 200}};
+    static const uint32_t features[] = {LV_DRAW_SW_CPU_FEATURE_SSE2, LV_DRAW_SW_CPU_FEATURE_ALL};
+
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    dsc.antialias = 1;
+    dsc.pivot.x = w / 2;
+    dsc.pivot.y = h / 3;
+
+    uint32_t cf;
+    for(cf = 0; cf < sizeof(cfs) / sizeof(cfs[0]); cf++) {
+        int32_t src_stride = w * (cfs[cf] == LV_COLOR_FORMAT_RGB565A8 ? 2 : lv_color_format_get_size(cfs[cf]));
+        uint32_t t;
+        for(t = 0; t < sizeof(transforms) / sizeof(transforms[0]); t++) {
+            dsc.rotation = transforms[t][0];
+            dsc.scale_x = transforms[t][1];
+            dsc.scale_y = transforms[t][1];
+            lv_memset(ref, 0xA5, sizeof(ref));
+
+            lv_draw_sw_set_kernel_features(LV_DRAW_SW_CPU_FEATURE_NONE);
+            lv_draw_sw_transform(NULL, &dest_area, src, w, h, src_stride, &dsc, NULL, cfs[cf], ref);
+
+            uint32_t f;
+            for(f = 0; f < sizeof(features) / sizeof(features[0]); f++) {
+                lv_memset(res, 0xA5, sizeof(res));
+                lv_draw_sw_set_kernel_features(features[f]);
+                lv_draw_sw_transform(NULL, &dest_area, src, w, h, src_stride, &dsc, NULL, cfs[cf], res);
+                TEST_ASSERT_EQUAL_MEMORY(ref, res, dest_w * dest_h * 5);
+            }
+        }
+    }
+}
+
+#endif
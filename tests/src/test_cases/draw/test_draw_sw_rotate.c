@@ -224,4 +224,121 @@ void test_rotate270_ARGB8888(void)
     TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedArray, dstArray, sizeof(dstArray));
 }
 
+void test_rotate90_A8(void)
+{
+    uint8_t srcArray[3 * 2] = {
+        0x11, 0x22, 0x33,
+        0x44, 0x55, 0x66
+    };
+    uint8_t dstArray[2 * 3] = {0};
+
+    uint8_t expectedArray[2 * 3] = {
+        0x33, 0x66,
+        0x22, 0x55,
+        0x11, 0x44,
+    };
+
+    lv_draw_sw_rotate(srcArray, dstArray,
+                      3, 2,
+                      3 * sizeof(uint8_t),
+                      2 * sizeof(uint8_t),
+                      LV_DISPLAY_ROTATION_90,
+                      LV_COLOR_FORMAT_A8);
+
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedArray, dstArray, sizeof(dstArray));
+}
+
+void test_rotate180_A8(void)
+{
+    uint8_t srcArray[3 * 2] = {
+        0x11, 0x22, 0x33,
+        0x44, 0x55, 0x66
+    };
+    uint8_t dstArray[3 * 2] = {0};
+    uint8_t expectedArray[3 * 2] = {
+        0x66, 0x55, 0x44,
+        0x33, 0x22, 0x11,
+    };
+    lv_draw_sw_rotate(srcArray, dstArray,
+                      3, 2,
+                      3 * sizeof(uint8_t),
+                      3 * sizeof(uint8_t),
+                      LV_DISPLAY_ROTATION_180,
+                      LV_COLOR_FORMAT_A8);
+
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedArray, dstArray, sizeof(dstArray));
+}
+
+void test_rotate270_A8(void)
+{
+    uint8_t srcArray[3 * 2] = {
+        0x11, 0x22, 0x33,
+        0x44, 0x55, 0x66
+    };
+    uint8_t dstArray[2 * 3] = {0};
+    uint8_t expectedArray[2 * 3] = {
+        0x44, 0x11,
+        0x55, 0x22,
+        0x66, 0x33
+    };
+    lv_draw_sw_rotate(srcArray, dstArray,
+                      3, 2,
+                      3 * sizeof(uint8_t),
+                      2 * sizeof(uint8_t),
+                      LV_DISPLAY_ROTATION_270,
+                      LV_COLOR_FORMAT_A8);
+
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedArray, dstArray, sizeof(dstArray));
+}
+
+void test_rotate_larger_than_a_tile(void)
+{
+    /*Rotated in tiles, with partial tiles on the right and bottom*/
+    const int32_t w = 53;
+    const int32_t h = 37;
+    static const lv_color_format_t cfs[] = {LV_COLOR_FORMAT_ARGB8888, LV_COLOR_FORMAT_RGB888, LV_COLOR_FORMAT_RGB565,
+                                            LV_COLOR_FORMAT_A8
+                                           };
+    static uint8_t src[53 * 37 * 4];
+    static uint8_t dst[53 * 37 * 4];
+    uint32_t i;
+    for(i = 0; i < sizeof(src); i++) src[i] = (uint8_t)((i * 0x9E3779B1u) >> 24);
+
+    uint32_t cf;
+    for(cf = 0; cf < sizeof(cfs) / sizeof(cfs[0]); cf++) {
+        int32_t px_size = lv_color_format_get_size(cfs[cf]);
+        int32_t r;
+        for(r = LV_DISPLAY_ROTATION_90; r <= LV_DISPLAY_ROTATION_270; r++) {
+            int32_t dst_stride = (r == LV_DISPLAY_ROTATION_180 ? w : h) * px_size;
+            lv_memzero(dst, sizeof(dst));
+            lv_draw_sw_rotate(src, dst, w, h, w * px_size, dst_stride, (lv_display_rotation_t)r, cfs[cf]);
+
+            /*RGB888 is rotated in the other direction by 90 and 270 degrees, see test_rotate90_RGB888*/
+            bool ccw = (r == LV_DISPLAY_ROTATION_90) != (cfs[cf] == LV_COLOR_FORMAT_RGB888);
+            int32_t x;
+            int32_t y;
+            for(y = 0; y < h; y++) {
+                for(x = 0; x < w; x++) {
+                    int32_t dst_x;
+                    int32_t dst_y;
+                    if(r == LV_DISPLAY_ROTATION_180) {
+                        dst_x = w - 1 - x;
+                        dst_y = h - 1 - y;
+                    }
+                    else if(ccw) {
+                        dst_x = y;
+                        dst_y = w - 1 - x;
+                    }
+                    else {
+                        dst_x = h - 1 - y;
+                        dst_y = x;
+                    }
+                    uint8_t * dst_px = &dst[dst_y * dst_stride + dst_x * px_size];
+                    TEST_ASSERT_EQUAL_UINT8_ARRAY(&src[(y * w + x) * px_size], dst_px, px_size);
+                }
+            }
+        }
+    }
+}
+
 #endif
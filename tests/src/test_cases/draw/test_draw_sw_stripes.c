@@ -0,0 +1,110 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+/*With `LV_DRAW_SW_DRAW_UNIT_CNT > 1` the large tasks of these tests are split into stripes
+ *which are rendered by the draw units in parallel. The reference images were rendered by a single draw unit,
+ *so the stripes must give exactly the same result.*/
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static lv_obj_t * card_create(int32_t w, int32_t h)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0xf0f0f0), 0);
+    lv_obj_set_style_radius(obj, 16, 0);
+    return obj;
+}
+
+void test_draw_sw_stripes_fill(void)
+{
+    lv_obj_t * obj = card_create(LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_radius(obj, 0, 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x2060c0), 0);
+
+    /*A semi-transparent gradient on it to blend with the fill below*/
+    obj = card_create(700, 400);
+    lv_obj_center(obj);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_70, 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff8000), 0);
+    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0x00ff80), 0);
+    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, 0);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_stripes_fill.png");
+}
+
+void test_draw_sw_stripes_image(void)
+{
+    LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+
+    /*Scaled up to be large enough to be split*/
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, &test_image_cogwheel_argb8888);
+    lv_image_set_scale(img, 1024);
+    lv_obj_align(img, LV_ALIGN_CENTER, -160, 0);
+
+    img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, &test_image_cogwheel_argb8888);
+    lv_image_set_scale(img, 768);
+    lv_image_set_rotation(img, 300);
+    lv_obj_align(img, LV_ALIGN_CENTER, 200, 0);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_stripes_image.png");
+}
+
+void test_draw_sw_stripes_layer(void)
+{
+    lv_obj_t * cont = card_create(600, 360);
+    lv_obj_center(cont);
+    lv_obj_set_style_bg_color(cont, lv_color_hex(0x40a040), 0);
+    lv_obj_set_style_opa(cont, LV_OPA_60, 0);
+    /*Simple layers are rendered in small chunks, but transformed layers are drawn as a whole*/
+    lv_obj_set_style_transform_rotation(cont, 50, 0);
+    lv_obj_set_style_transform_pivot_x(cont, LV_PCT(50), 0);
+    lv_obj_set_style_transform_pivot_y(cont, LV_PCT(50), 0);
+
+    lv_obj_t * obj = card_create(300, 200);
+    lv_obj_set_parent(obj, cont);
+    lv_obj_center(obj);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0xc04040), 0);
+
+    lv_obj_t * label = lv_label_create(cont);
+    lv_label_set_text(label, "Rendered in stripes");
+    lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 20);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_stripes_layer.png");
+}
+
+void test_draw_sw_stripes_box_shadow(void)
+{
+    /*The corner fits into the shadow cache, so the task is split*/
+    lv_obj_t * obj = card_create(300, 360);
+    lv_obj_align(obj, LV_ALIGN_LEFT_MID, 60, 0);
+    lv_obj_set_style_shadow_width(obj, 40, 0);
+    lv_obj_set_style_shadow_spread(obj, 5, 0);
+    lv_obj_set_style_shadow_offset_y(obj, 10, 0);
+    lv_obj_set_style_shadow_color(obj, lv_color_hex(0x202080), 0);
+
+    /*Too large corner for the cache, so it's rendered by a single unit*/
+    obj = card_create(300, 360);
+    lv_obj_align(obj, LV_ALIGN_RIGHT_MID, -60, 0);
+    lv_obj_set_style_shadow_width(obj, 80, 0);
+    lv_obj_set_style_shadow_color(obj, lv_color_hex(0x802020), 0);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_stripes_box_shadow.png");
+}
+
+#endif
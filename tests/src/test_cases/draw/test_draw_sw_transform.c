@@ -0,0 +1,163 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define IMG_W       37
+#define IMG_H       23
+
+static uint8_t src[IMG_W * IMG_H * 5];
+static uint8_t ref[(IMG_W + IMG_H + 20) * (IMG_W + IMG_H + 20) * 5];
+static uint8_t res[(IMG_W + IMG_H + 20) * (IMG_W + IMG_H + 20) * 5];
+
+void setUp(void)
+{
+    uint32_t i;
+    for(i = 0; i < sizeof(src); i++) {
+        /*Runs of the same bytes to have equal neighbors, and some zero bytes for transparent pixels*/
+        src[i] = (i / 12) % 7 == 0 ? 0 : (uint8_t)(((i / 12) * 0x9E3779B1u) >> 24);
+    }
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+void test_transform_rotate_exact_matches_generic(void)
+{
+    static const lv_color_format_t cfs[] = {LV_COLOR_FORMAT_ARGB8888, LV_COLOR_FORMAT_XRGB8888, LV_COLOR_FORMAT_RGB888,
+                                            LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB565A8, LV_COLOR_FORMAT_A8
+                                           };
+    static const lv_point_t pivots[] = {{IMG_W / 2, IMG_H / 3}, {0, 0}, {IMG_W + 3, -4}};
+
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+
+    uint32_t cf;
+    for(cf = 0; cf < sizeof(cfs) / sizeof(cfs[0]); cf++) {
+        int32_t src_stride = IMG_W * (cfs[cf] == LV_COLOR_FORMAT_RGB565A8 ? 2 : lv_color_format_get_size(cfs[cf]));
+        uint32_t p;
+        for(p = 0; p < sizeof(pivots) / sizeof(pivots[0]); p++) {
+            int32_t rotation;
+            for(rotation = 900; rotation <= 2700; rotation += 900) {
+                dsc.pivot = pivots[p];
+                dsc.antialias = rotation != 1800;
+
+                /*The whole transformed image with some margin and a part of it*/
+                lv_area_t dest_areas[2];
+                _lv_image_buf_get_transformed_area(&dest_areas[0], IMG_W, IMG_H, rotation, LV_SCALE_NONE, LV_SCALE_NONE,
+                                                   &dsc.pivot);
+                lv_area_increase(&dest_areas[0], 9, 7);
+                dest_areas[1] = dest_areas[0];
+                dest_areas[1].x1 += 13;
+                dest_areas[1].y2 -= 11;
+
+                uint32_t a;
+                for(a = 0; a < sizeof(dest_areas) / sizeof(dest_areas[0]); a++) {
+                    uint32_t size = lv_area_get_size(&dest_areas[a]) * 5;
+                    TEST_ASSERT_LESS_OR_EQUAL(sizeof(ref), size);
+
+                    /*The same rotation with one more turn is rendered by the generic bilinear transformation*/
+                    lv_memset(ref, 0xA5, size);
+                    dsc.rotation = rotation + 3600;
+                    lv_draw_sw_transform(NULL, &dest_areas[a], src, IMG_W, IMG_H, src_stride, &dsc, NULL, cfs[cf], ref);
+
+                    lv_memset(res, 0xA5, size);
+                    dsc.rotation = rotation;
+                    lv_draw_sw_transform(NULL, &dest_areas[a], src, IMG_W, IMG_H, src_stride, &dsc, NULL, cfs[cf], res);
+
+                    TEST_ASSERT_EQUAL_MEMORY(ref, res, size);
+                }
+            }
+        }
+    }
+}
+
+void test_transform_scale_integer_ratio_matches_generic(void)
+{
+    static const lv_color_format_t cfs[] = {LV_COLOR_FORMAT_ARGB8888, LV_COLOR_FORMAT_XRGB8888, LV_COLOR_FORMAT_RGB888,
+                                            LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB565A8, LV_COLOR_FORMAT_A8
+                                           };
+    static const lv_point_t pivots[] = {{IMG_W / 2, IMG_H / 3}, {0, 0}, {IMG_W + 3, -4}};
+    /*0.5x, 0.25x and downscale in only one direction*/
+    static const lv_point_t scales[] = {{128, 128}, {64, 64}, {128, 256}, {256, 64}};
+
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+
+    uint32_t cf;
+    for(cf = 0; cf < sizeof(cfs) / sizeof(cfs[0]); cf++) {
+        int32_t src_stride = IMG_W * (cfs[cf] == LV_COLOR_FORMAT_RGB565A8 ? 2 : lv_color_format_get_size(cfs[cf]));
+        uint32_t p;
+        for(p = 0; p < sizeof(pivots) / sizeof(pivots[0]); p++) {
+            uint32_t s;
+            for(s = 0; s < sizeof(scales) / sizeof(scales[0]); s++) {
+                uint32_t aa;
+                for(aa = 0; aa <= 1; aa++) {
+                    dsc.pivot = pivots[p];
+                    dsc.scale_x = scales[s].x;
+                    dsc.scale_y = scales[s].y;
+                    dsc.antialias = aa;
+
+                    /*The area where the image is drawn, so the steps on the source image are whole pixels*/
+                    lv_area_t dest_area;
+                    _lv_image_buf_get_transformed_area(&dest_area, IMG_W, IMG_H, 0, dsc.scale_x, dsc.scale_y,
+                                                       &dsc.pivot);
+                    uint32_t size = lv_area_get_size(&dest_area) * 5;
+                    TEST_ASSERT_LESS_OR_EQUAL(sizeof(ref), size);
+
+                    /*A full turn is rendered by the generic bilinear transformation*/
+                    lv_memset(ref, 0xA5, size);
+                    dsc.rotation = 3600;
+                    lv_draw_sw_transform(NULL, &dest_area, src, IMG_W, IMG_H, src_stride, &dsc, NULL, cfs[cf], ref);
+
+                    lv_memset(res, 0xA5, size);
+                    dsc.rotation = 0;
+                    lv_draw_sw_transform(NULL, &dest_area, src, IMG_W, IMG_H, src_stride, &dsc, NULL, cfs[cf], res);
+
+                    TEST_ASSERT_EQUAL_MEMORY(ref, res, size);
+                }
+            }
+        }
+    }
+}
+
+void test_transform_scale_upscale_matches_c(void)
+{
+    static const lv_color_format_t cfs[] = {LV_COLOR_FORMAT_ARGB8888, LV_COLOR_FORMAT_XRGB8888, LV_COLOR_FORMAT_RGB888,
+                                            LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB565A8, LV_COLOR_FORMAT_A8
+                                           };
+
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    dsc.pivot.x = IMG_W / 2;
+    dsc.pivot.y = IMG_H / 3;
+    dsc.scale_x = 512;
+    dsc.scale_y = 512;
+    dsc.antialias = 1;
+
+    lv_area_t dest_area;
+    _lv_image_buf_get_transformed_area(&dest_area, IMG_W, IMG_H, 0, dsc.scale_x, dsc.scale_y, &dsc.pivot);
+    lv_area_set_width(&dest_area, LV_MIN(lv_area_get_width(&dest_area), IMG_W + IMG_H + 20));
+    lv_area_set_height(&dest_area, LV_MIN(lv_area_get_height(&dest_area), IMG_W + IMG_H + 20));
+    uint32_t size = lv_area_get_size(&dest_area) * 5;
+
+    uint32_t cf;
+    for(cf = 0; cf < sizeof(cfs) / sizeof(cfs[0]); cf++) {
+        int32_t src_stride = IMG_W * (cfs[cf] == LV_COLOR_FORMAT_RGB565A8 ? 2 : lv_color_format_get_size(cfs[cf]));
+
+        /*2x samples between the pixels: `transform_scale` without kernels, the SIMD kernels if available*/
+        lv_draw_sw_set_kernel_features(LV_DRAW_SW_CPU_FEATURE_NONE);
+        lv_memset(ref, 0xA5, size);
+        lv_draw_sw_transform(NULL, &dest_area, src, IMG_W, IMG_H, src_stride, &dsc, NULL, cfs[cf], ref);
+
+        lv_draw_sw_set_kernel_features(LV_DRAW_SW_CPU_FEATURE_ALL);
+        lv_memset(res, 0xA5, size);
+        lv_draw_sw_transform(NULL, &dest_area, src, IMG_W, IMG_H, src_stride, &dsc, NULL, cfs[cf], res);
+
+        TEST_ASSERT_EQUAL_MEMORY(ref, res, size);
+    }
+}
+
+#endif
@@ -58,4 +58,74 @@ void test_update_layer_type_on_state_change(void)
 
 }
 
+static uint32_t draw_cnt;
+
+static void draw_cnt_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    draw_cnt++;
+}
+
+static lv_obj_t * create_cached_card(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 200, 150);
+    lv_obj_center(obj);
+    lv_obj_set_style_bg_color(obj, lv_color_hex3(0x8af), 0);
+    lv_obj_set_style_transform_pivot_x(obj, lv_pct(50), 0);
+    lv_obj_set_style_transform_pivot_y(obj, lv_pct(50), 0);
+    lv_obj_set_style_transform_rotation(obj, 300, 0);
+
+    lv_obj_t * label = lv_label_create(obj);
+    lv_label_set_text(label, "Cached layer");
+    lv_obj_center(label);
+    lv_obj_add_event_cb(label, draw_cnt_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    return obj;
+}
+
+void test_layer_cache_same_as_normal_rendering(void)
+{
+    lv_obj_t * obj = create_cached_card();
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/layer_cache_1.png");
+
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_LAYER_CACHE);
+    lv_obj_set_style_opa_layered(obj, LV_OPA_70, 0);
+    lv_obj_set_style_opa_layered(obj, LV_OPA_COVER, 0);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/layer_cache_1.png");
+}
+
+void test_layer_cache_not_rendered_again_on_transform_change(void)
+{
+    lv_obj_t * obj = create_cached_card();
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_LAYER_CACHE);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_NULL(obj->spec_attr->layer_cache);
+
+    /*Only the transformation changes, the cached layer is blended again*/
+    draw_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_obj_set_style_transform_rotation(obj, 300 + i * 100, 0);
+        lv_obj_set_style_transform_scale(obj, 256 + i * 20, 0);
+        lv_refr_now(NULL);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, draw_cnt);
+
+    /*The content changes, so the layer is rendered again*/
+    lv_obj_t * label = lv_obj_get_child(obj, 0);
+    lv_label_set_text(label, "Updated");
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/layer_cache_2.png");
+
+    /*Normal rendering draws the children in every frame*/
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_LAYER_CACHE);
+    TEST_ASSERT_NULL(obj->spec_attr->layer_cache);
+    draw_cnt = 0;
+    lv_obj_set_style_transform_rotation(obj, 500, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+}
+
 #endif
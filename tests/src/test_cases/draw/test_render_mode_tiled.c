@@ -0,0 +1,127 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+static uint32_t flush_cnt;
+static bool flush_area_ok;
+static lv_area_t flush_area_joined;
+
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    /*Used by the screenshot compare*/
+    extern uint8_t * last_flushed_buf;
+    last_flushed_buf = px_map;
+
+    if(lv_area_get_width(area) > LV_DRAW_TILE_SIZE || lv_area_get_height(area) > LV_DRAW_TILE_SIZE) {
+        flush_area_ok = false;
+    }
+
+    if(flush_cnt == 0) flush_area_joined = *area;
+    else _lv_area_join(&flush_area_joined, &flush_area_joined, area);
+
+    flush_cnt++;
+    lv_display_flush_ready(disp);
+}
+
+static void create_ui(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_style_bg_color(scr, lv_palette_lighten(LV_PALETTE_GREY, 3), 0);
+
+    uint32_t i;
+    for(i = 0; i < 6; i++) {
+        lv_obj_t * card = lv_obj_create(scr);
+        lv_obj_set_size(card, 220, 140);
+        lv_obj_set_pos(card, 30 + (i % 3) * 250, 40 + (i / 3) * 200);
+        lv_obj_set_style_shadow_width(card, 30, 0);
+        lv_obj_set_style_radius(card, 20, 0);
+        lv_obj_set_style_bg_grad_color(card, lv_palette_main(LV_PALETTE_BLUE), 0);
+        lv_obj_set_style_bg_grad_dir(card, LV_GRAD_DIR_VER, 0);
+
+        lv_obj_t * label = lv_label_create(card);
+        lv_label_set_text_fmt(label, "Card %" LV_PRIu32 "\nSome text in multiple lines", i);
+        lv_obj_t * slider = lv_slider_create(card);
+        lv_obj_align(slider, LV_ALIGN_BOTTOM_MID, 0, 0);
+        lv_slider_set_value(slider, i * 20, LV_ANIM_OFF);
+
+        /*Use layers too. Transformed layers are not used as their edges are sampled
+         *differently when they are cut into tiles, just like in PARTIAL mode*/
+        if(i % 2) lv_obj_set_style_opa(card, LV_OPA_70, 0);
+    }
+}
+
+void setUp(void)
+{
+    lv_display_set_flush_cb(NULL, flush_cb);
+    flush_cnt = 0;
+    flush_area_ok = true;
+}
+
+void tearDown(void)
+{
+    lv_display_set_render_mode(NULL, LV_DISPLAY_RENDER_MODE_DIRECT);
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_render_mode_tiled_same_as_direct(void)
+{
+    create_ui();
+    lv_refr_now(NULL);
+
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    uint32_t size = buf->header.stride * buf->header.h;
+    uint8_t * ref = lv_malloc(size);
+    lv_memcpy(ref, buf->data, size);
+
+    /*Clear the buffer to be sure everything is rendered again*/
+    lv_memzero(buf->data, size);
+
+    lv_display_set_render_mode(NULL, LV_DISPLAY_RENDER_MODE_TILED);
+    lv_obj_invalidate(lv_screen_active());
+    flush_cnt = 0;
+    flush_area_ok = true;
+    lv_refr_now(NULL);
+
+    /*Allow a small difference due to the rounding in the layers which are cut by the tiles.
+     *The X channel of XRGB8888 is not set where the screen's background is not drawn.*/
+    uint32_t diff_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < size; i++) {
+        if(buf->header.cf == LV_COLOR_FORMAT_XRGB8888 && (i & 0x3) == 3) continue;
+        int32_t diff = (int32_t)ref[i] - buf->data[i];
+        if(diff < -2 || diff > 2) diff_cnt++;
+    }
+    lv_free(ref);
+    TEST_ASSERT_EQUAL_UINT32(0, diff_cnt);
+
+    /*Each tile is flushed separately*/
+    int32_t hor_res = lv_display_get_horizontal_resolution(NULL);
+    int32_t ver_res = lv_display_get_vertical_resolution(NULL);
+    uint32_t tile_cnt = ((hor_res + LV_DRAW_TILE_SIZE - 1) / LV_DRAW_TILE_SIZE) *
+                        ((ver_res + LV_DRAW_TILE_SIZE - 1) / LV_DRAW_TILE_SIZE);
+    TEST_ASSERT_EQUAL_UINT32(tile_cnt, flush_cnt);
+    TEST_ASSERT_TRUE(flush_area_ok);
+}
+
+void test_render_mode_tiled_small_area(void)
+{
+    create_ui();
+    lv_display_set_render_mode(NULL, LV_DISPLAY_RENDER_MODE_TILED);
+    lv_refr_now(NULL);
+
+    /*Touches 3x2 tiles*/
+    lv_area_t a = {LV_DRAW_TILE_SIZE - 4, LV_DRAW_TILE_SIZE - 4, 2 * LV_DRAW_TILE_SIZE + 10, LV_DRAW_TILE_SIZE + 10};
+    lv_obj_invalidate_area(lv_screen_active(), &a);
+    flush_cnt = 0;
+    flush_area_ok = true;
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(6, flush_cnt);
+    TEST_ASSERT_TRUE(flush_area_ok);
+    TEST_ASSERT_TRUE(_lv_area_is_in(&a, &flush_area_joined, 0));
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/render_mode_tiled.png");
+}
+
+#endif
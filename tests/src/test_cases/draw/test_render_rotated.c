@@ -0,0 +1,291 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define HOR_RES     800
+#define VER_RES     480
+
+/*The frame buffer of the display in its native orientation*/
+static uint8_t fb[HOR_RES * VER_RES * 4];
+static uint8_t ref[HOR_RES * VER_RES * 4];
+static bool flush_area_ok;
+static bool partial;
+static lv_area_t flush_area_joined;
+static uint32_t flush_cnt;
+
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    /*Used by the screenshot compare*/
+    extern uint8_t * last_flushed_buf;
+    last_flushed_buf = px_map;
+
+    if(area->x1 < 0 || area->y1 < 0 || area->x2 >= HOR_RES || area->y2 >= VER_RES) {
+        flush_area_ok = false;
+        lv_display_flush_ready(disp);
+        return;
+    }
+
+    /*Copy the area to the frame buffer like a driver without rotation support would do*/
+    lv_color_format_t cf = lv_display_get_color_format(disp);
+    uint32_t px_size = lv_color_format_get_size(cf);
+    uint32_t fb_stride = lv_draw_buf_width_to_stride(HOR_RES, cf);
+    uint32_t px_map_stride = lv_draw_buf_width_to_stride(lv_area_get_width(area), cf);
+    if(!partial) {
+        /*A screen sized buffer*/
+        px_map_stride = lv_draw_buf_width_to_stride(HOR_RES, cf);
+        px_map += area->y1 * px_map_stride + area->x1 * px_size;
+    }
+
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&fb[y * fb_stride + area->x1 * px_size], px_map, lv_area_get_width(area) * px_size);
+        px_map += px_map_stride;
+    }
+
+    if(flush_cnt == 0) flush_area_joined = *area;
+    else _lv_area_join(&flush_area_joined, &flush_area_joined, area);
+    flush_cnt++;
+
+    lv_display_flush_ready(disp);
+}
+
+static void set_partial(bool en)
+{
+    partial = en;
+    lv_display_set_render_mode(NULL, en ? LV_DISPLAY_RENDER_MODE_PARTIAL : LV_DISPLAY_RENDER_MODE_DIRECT);
+}
+
+static void create_ui(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_style_bg_color(scr, lv_palette_lighten(LV_PALETTE_GREY, 3), 0);
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_ROW_WRAP);
+
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_obj_t * card = lv_obj_create(scr);
+        lv_obj_set_size(card, 200, 130);
+        lv_obj_set_style_shadow_width(card, 20, 0);
+        lv_obj_set_style_radius(card, 15, 0);
+        lv_obj_set_style_bg_grad_color(card, lv_palette_main(LV_PALETTE_BLUE), 0);
+        lv_obj_set_style_bg_grad_dir(card, i % 2 ? LV_GRAD_DIR_VER : LV_GRAD_DIR_HOR, 0);
+
+        lv_obj_t * label = lv_label_create(card);
+        lv_label_set_text_fmt(label, "Card %" LV_PRIu32 "\nSome text in multiple lines", i);
+        lv_obj_t * slider = lv_slider_create(card);
+        lv_obj_align(slider, LV_ALIGN_BOTTOM_MID, 0, 0);
+        lv_slider_set_value(slider, i * 20, LV_ANIM_OFF);
+
+        /*Blend images too. Transformed layers are not used as their edges are sampled
+         *differently when they are rendered in parts*/
+        if(i % 2) lv_obj_set_style_opa(card, LV_OPA_70, 0);
+    }
+
+    LV_IMAGE_DECLARE(test_image_cogwheel_rgb565);
+    LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+    lv_obj_t * img = lv_image_create(scr);
+    lv_image_set_src(img, &test_image_cogwheel_rgb565);
+    img = lv_image_create(scr);
+    lv_image_set_src(img, &test_image_cogwheel_argb8888);
+    lv_obj_set_style_image_recolor_opa(img, LV_OPA_50, 0);
+}
+
+/**
+ * Render the screen without rotation in direct mode and rotate it to `ref` as a driver would do
+ */
+static void render_ref(lv_display_rotation_t rotation)
+{
+    lv_display_set_rotation(NULL, rotation);
+    lv_display_set_render_rotated(NULL, false);
+    set_partial(false);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    lv_color_format_t cf = buf->header.cf;
+    int32_t ref_stride = lv_draw_buf_width_to_stride(HOR_RES, cf);
+
+    /*`lv_draw_sw_rotate` turns 24 bit pixels to the other direction by 90 and 270 degrees*/
+    if(lv_color_format_get_bpp(cf) == 24 && rotation != LV_DISPLAY_ROTATION_180) {
+        rotation = rotation == LV_DISPLAY_ROTATION_90 ? LV_DISPLAY_ROTATION_270 : LV_DISPLAY_ROTATION_90;
+    }
+
+    lv_draw_sw_rotate(buf->data, ref, buf->header.w, buf->header.h, buf->header.stride, ref_stride, rotation, cf);
+
+    /*The not rotated areas were flushed so far*/
+    flush_area_ok = true;
+    flush_cnt = 0;
+}
+
+static uint32_t diff_cnt(const uint8_t * res)
+{
+    lv_color_format_t cf = lv_display_get_color_format(NULL);
+    uint32_t size = lv_draw_buf_width_to_stride(HOR_RES, cf) * VER_RES;
+
+    /*Allow a small difference due to the rounding in the layers which are cut into parts.
+     *The X channel of XRGB8888 is not set where the screen's background is not drawn.*/
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < size; i++) {
+        if(cf == LV_COLOR_FORMAT_XRGB8888 && (i & 0x3) == 3) continue;
+        int32_t diff = (int32_t)ref[i] - res[i];
+        if(diff < -2 || diff > 2) cnt++;
+    }
+
+    return cnt;
+}
+
+void setUp(void)
+{
+    lv_display_set_flush_cb(NULL, flush_cb);
+    flush_area_ok = true;
+    flush_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_display_set_rotation(NULL, LV_DISPLAY_ROTATION_0);
+    lv_display_set_render_rotated(NULL, false);
+    set_partial(false);
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_render_rotated_direct(void)
+{
+    create_ui();
+
+    lv_display_rotation_t rotation;
+    for(rotation = LV_DISPLAY_ROTATION_90; rotation <= LV_DISPLAY_ROTATION_270; rotation++) {
+        render_ref(rotation);
+
+        /*Render directly in the native orientation of the display*/
+        lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+        lv_memzero(buf->data, buf->data_size);
+        lv_display_set_render_rotated(NULL, true);
+        lv_refr_now(NULL);
+
+        TEST_ASSERT_EQUAL_INT32(HOR_RES, buf->header.w);
+        TEST_ASSERT_EQUAL_INT32(VER_RES, buf->header.h);
+        TEST_ASSERT_EQUAL_UINT32(0, diff_cnt(buf->data));
+        TEST_ASSERT_TRUE(flush_area_ok);
+    }
+}
+
+void test_render_rotated_partial(void)
+{
+    create_ui();
+
+    lv_display_rotation_t rotation;
+    for(rotation = LV_DISPLAY_ROTATION_90; rotation <= LV_DISPLAY_ROTATION_270; rotation++) {
+        render_ref(rotation);
+
+        /*Render in parts of a few rows (columns of the display)*/
+        lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+        uint32_t data_size = buf->data_size;
+        buf->data_size = HOR_RES * 4 * 37;
+
+        lv_memzero(fb, sizeof(fb));
+        lv_display_set_render_rotated(NULL, true);
+        set_partial(true);
+        lv_refr_now(NULL);
+        buf->data_size = data_size;
+
+        TEST_ASSERT_EQUAL_UINT32(0, diff_cnt(fb));
+        TEST_ASSERT_TRUE(flush_area_ok);
+    }
+}
+
+void test_render_rotated_small_area(void)
+{
+    create_ui();
+    render_ref(LV_DISPLAY_ROTATION_90);
+
+    lv_display_set_render_rotated(NULL, true);
+    set_partial(true);
+    lv_refr_now(NULL);
+
+    /*Only the rotated area is flushed. (The invalidated area might be enlarged a little.)*/
+    lv_memzero(fb, sizeof(fb));
+    flush_cnt = 0;
+    lv_area_t a = {10, 20, 109, 69};
+    lv_obj_invalidate_area(lv_screen_active(), &a);
+    lv_refr_now(NULL);
+
+    lv_area_t rotated = a;
+    lv_display_rotate_area(lv_display_get_default(), &rotated);
+    TEST_ASSERT_EQUAL_INT32(20, rotated.x1);
+    TEST_ASSERT_EQUAL_INT32(VER_RES - 110, rotated.y1);
+    TEST_ASSERT_EQUAL_UINT32(1, flush_cnt);
+    TEST_ASSERT_TRUE(_lv_area_is_in(&rotated, &flush_area_joined, 0));
+    TEST_ASSERT_LESS_THAN_UINT32(lv_area_get_size(&rotated) * 2, lv_area_get_size(&flush_area_joined));
+    TEST_ASSERT_TRUE(flush_area_ok);
+
+    /*The flushed area is the same as in the not rotated rendering*/
+    const lv_area_t * flushed = &flush_area_joined;
+    lv_color_format_t cf = lv_display_get_color_format(NULL);
+    uint32_t px_size = lv_color_format_get_size(cf);
+    uint32_t stride = lv_draw_buf_width_to_stride(HOR_RES, cf);
+    int32_t y;
+    for(y = flushed->y1; y <= flushed->y2; y++) {
+        uint32_t i = y * stride + flushed->x1 * px_size;
+        if(cf == LV_COLOR_FORMAT_XRGB8888) {
+            int32_t x;
+            for(x = 0; x < lv_area_get_width(flushed); x++) {
+                TEST_ASSERT_EQUAL_MEMORY(&ref[i + x * 4], &fb[i + x * 4], 3);
+            }
+        }
+        else {
+            TEST_ASSERT_EQUAL_MEMORY(&ref[i], &fb[i], lv_area_get_width(flushed) * px_size);
+        }
+    }
+}
+
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+
+static void draw_vector_cb(lv_event_t * e)
+{
+    lv_layer_t * layer = lv_event_get_layer(e);
+    lv_vector_dsc_t * ctx = lv_vector_dsc_create(layer);
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+
+    lv_area_t rect = {50, 50, 250, 150};
+    lv_vector_path_append_rect(path, &rect, 20, 20);
+    lv_vector_dsc_set_fill_color(ctx, lv_color_make(0xff, 0x00, 0x00));
+    lv_vector_dsc_add_path(ctx, path);
+
+    lv_fpoint_t pc = {100, 100};
+    lv_vector_path_clear(path);
+    lv_vector_path_append_circle(path, &pc, 50, 30);
+    lv_vector_dsc_translate(ctx, 150, 200);
+    lv_vector_dsc_set_fill_color32(ctx, lv_color_to_32(lv_color_make(0x00, 0x00, 0xff), 0x80));
+    lv_vector_dsc_add_path(ctx, path);
+
+    lv_draw_vector(ctx);
+    lv_vector_path_delete(path);
+    lv_vector_dsc_delete(ctx);
+}
+
+void test_render_rotated_vector(void)
+{
+    lv_obj_add_event_cb(lv_screen_active(), draw_vector_cb, LV_EVENT_DRAW_MAIN_END, NULL);
+
+    lv_display_rotation_t rotation;
+    for(rotation = LV_DISPLAY_ROTATION_90; rotation <= LV_DISPLAY_ROTATION_270; rotation++) {
+        render_ref(rotation);
+
+        lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+        lv_memzero(buf->data, buf->data_size);
+        lv_display_set_render_rotated(NULL, true);
+        lv_refr_now(NULL);
+
+        /*The anti-aliased edges are not exactly the same in every direction*/
+        TEST_ASSERT_LESS_THAN_UINT32(100, diff_cnt(buf->data));
+    }
+
+    lv_obj_remove_event_cb(lv_screen_active(), draw_vector_cb);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,261 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+#define HOR_RES     200
+#define VER_RES     150
+#define PX_SIZE     4
+#define BUF_CNT     3
+#define QUEUE_MAX   8
+
+typedef struct {
+    lv_area_t area;
+    uint8_t * px_map;
+} flush_req_t;
+
+static lv_display_t * disp;
+static lv_display_t * disp_default;
+static lv_draw_buf_t * bufs[BUF_CNT];
+static lv_display_render_mode_t render_mode;
+
+static flush_req_t queue[QUEUE_MAX];
+static uint32_t queue_cnt;
+static uint32_t queue_cnt_max;
+
+/*Call `lv_display_flush_ready()` only in the next `flush_cb`, like a late interrupt*/
+static bool defer_ready;
+static uint32_t deferred_ready_cnt;
+
+/*The simulated content of the display*/
+static uint8_t screen[HOR_RES * VER_RES * PX_SIZE];
+static uint8_t * shown_buf;
+
+static void queue_process(lv_display_t * d)
+{
+    uint32_t i;
+    for(i = 0; i < queue_cnt; i++) {
+        flush_req_t * req = &queue[i];
+        if(render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL) {
+            uint32_t w = lv_area_get_width(&req->area);
+            uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_XRGB8888);
+            int32_t y;
+            for(y = req->area.y1; y <= req->area.y2; y++) {
+                lv_memcpy(&screen[(y * HOR_RES + req->area.x1) * PX_SIZE],
+                          &req->px_map[(y - req->area.y1) * stride], w * PX_SIZE);
+            }
+        }
+        else {
+            shown_buf = req->px_map;
+        }
+        if(defer_ready) deferred_ready_cnt++;
+        else lv_display_flush_ready(d);
+    }
+    queue_cnt = 0;
+}
+
+/*Only queue the flushes, they are finished later in `flush_wait_cb`*/
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    TEST_ASSERT_LESS_THAN_UINT32(QUEUE_MAX, queue_cnt);
+
+    for(; deferred_ready_cnt > 0; deferred_ready_cnt--) {
+        lv_display_flush_ready(d);
+    }
+
+    /*In direct mode only the last area switches to the new frame*/
+    if(render_mode == LV_DISPLAY_RENDER_MODE_DIRECT && !lv_display_flush_is_last(d)) {
+        lv_display_flush_ready(d);
+        return;
+    }
+
+    queue[queue_cnt].area = *area;
+    queue[queue_cnt].px_map = px_map;
+    queue_cnt++;
+    if(queue_cnt > queue_cnt_max) queue_cnt_max = queue_cnt;
+}
+
+static void flush_wait_cb(lv_display_t * d)
+{
+    queue_process(d);
+}
+
+static void create_ui(void)
+{
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_set_style_bg_color(scr, lv_palette_lighten(LV_PALETTE_GREY, 3), 0);
+
+    uint32_t i;
+    for(i = 0; i < 6; i++) {
+        lv_obj_t * obj = lv_obj_create(scr);
+        lv_obj_set_size(obj, 60, 40);
+        lv_obj_set_pos(obj, (i % 3) * 65 + 5, (i / 3) * 70 + 10);
+        lv_obj_set_style_bg_color(obj, lv_palette_main(LV_PALETTE_RED + i * 2), 0);
+        lv_obj_t * label = lv_label_create(obj);
+        lv_label_set_text_fmt(label, "%d", (int)i);
+        lv_obj_center(label);
+    }
+}
+
+static void set_buffers(lv_display_render_mode_t mode, uint32_t h)
+{
+    uint32_t i;
+    for(i = 0; i < BUF_CNT; i++) {
+        bufs[i] = lv_draw_buf_create(HOR_RES, h, LV_COLOR_FORMAT_XRGB8888, LV_STRIDE_AUTO);
+        lv_memzero(bufs[i]->data, bufs[i]->data_size);
+    }
+    lv_display_set_draw_buffer_array(disp, bufs, BUF_CNT);
+    lv_display_set_render_mode(disp, mode);
+    render_mode = mode;
+}
+
+void setUp(void)
+{
+    disp_default = lv_display_get_default();
+    disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_XRGB8888);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_set_flush_wait_cb(disp, flush_wait_cb);
+    lv_memzero(bufs, sizeof(bufs));
+    lv_memzero(screen, sizeof(screen));
+    queue_cnt = 0;
+    queue_cnt_max = 0;
+    shown_buf = NULL;
+    defer_ready = false;
+    deferred_ready_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_display_delete(disp);
+    lv_display_set_default(disp_default);
+
+    uint32_t i;
+    for(i = 0; i < BUF_CNT; i++) {
+        if(bufs[i]) lv_draw_buf_destroy(bufs[i]);
+    }
+}
+
+/**
+ * Get the number of different bytes in two XRGB8888 images. The X channel is ignored.
+ */
+static uint32_t get_diff_cnt(const uint8_t * a, const uint8_t * b, uint32_t stride)
+{
+    uint32_t diff_cnt = 0;
+    uint32_t y;
+    uint32_t i;
+    for(y = 0; y < VER_RES; y++) {
+        for(i = 0; i < HOR_RES * PX_SIZE; i++) {
+            if((i & 0x3) == 3) continue;
+            if(a[y * stride + i] != b[y * stride + i]) diff_cnt++;
+        }
+    }
+    return diff_cnt;
+}
+
+void test_partial_mode_queues_flushes(void)
+{
+    set_buffers(LV_DISPLAY_RENDER_MODE_PARTIAL, 20);
+    create_ui();
+    lv_refr_now(disp);
+    queue_process(disp);
+
+    lv_display_flush_monitor_t mon;
+    lv_display_get_flush_monitor(disp, &mon);
+    TEST_ASSERT_EQUAL_UINT32(VER_RES / 20 + 1, mon.flush_cnt);
+    /*The flushes of 2 buffers can be pending while the third one is being rendered*/
+    TEST_ASSERT_EQUAL_UINT32(BUF_CNT - 1, mon.pending_max);
+    TEST_ASSERT_EQUAL_UINT32(BUF_CNT - 1, queue_cnt_max);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, mon.wait_cnt);
+
+    /*Render the same with a single full screen buffer*/
+    uint8_t * ref = lv_malloc(sizeof(screen));
+    lv_memcpy(ref, screen, sizeof(screen));
+    lv_memzero(screen, sizeof(screen));
+
+    lv_draw_buf_destroy(bufs[0]);
+    bufs[0] = lv_draw_buf_create(HOR_RES, VER_RES, LV_COLOR_FORMAT_XRGB8888, LV_STRIDE_AUTO);
+    lv_display_set_draw_buffer_array(disp, bufs, 1);
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_refr_now(disp);
+    queue_process(disp);
+
+    TEST_ASSERT_EQUAL_UINT32(0, get_diff_cnt(ref, screen, HOR_RES * PX_SIZE));
+    lv_free(ref);
+}
+
+void test_direct_mode_syncs_all_buffers(void)
+{
+    set_buffers(LV_DISPLAY_RENDER_MODE_DIRECT, VER_RES);
+    create_ui();
+    lv_refr_now(disp);
+
+    /*Change a different part of the screen in each frame so that
+     *all buffers need to be synchronized from the other ones*/
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_obj_t * obj = lv_obj_get_child(scr, i % 6);
+        lv_obj_set_x(obj, lv_obj_get_x(obj) + (i % 2 ? -7 : 3));
+        lv_refr_now(disp);
+    }
+    queue_process(disp);
+    TEST_ASSERT_NOT_NULL(shown_buf);
+    TEST_ASSERT_EQUAL_UINT32(BUF_CNT - 1, queue_cnt_max);
+
+    /*Redraw the whole screen and compare it with the last shown frame*/
+    uint32_t stride = bufs[0]->header.stride;
+    uint8_t * ref = lv_malloc(stride * VER_RES);
+    lv_memcpy(ref, shown_buf, stride * VER_RES);
+
+    lv_obj_invalidate(scr);
+    lv_refr_now(disp);
+    queue_process(disp);
+
+    TEST_ASSERT_EQUAL_UINT32(0, get_diff_cnt(ref, shown_buf, stride));
+    lv_free(ref);
+}
+
+void test_flush_ready_after_flush_wait_cb(void)
+{
+    /*The flushes finished by `flush_wait_cb` are reported by `lv_display_flush_ready()` too, but later*/
+    defer_ready = true;
+    set_buffers(LV_DISPLAY_RENDER_MODE_PARTIAL, 20);
+    create_ui();
+
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_obj_invalidate(lv_display_get_screen_active(disp));
+        lv_refr_now(disp);
+    }
+    queue_process(disp);
+
+    lv_display_flush_monitor_t mon;
+    lv_display_get_flush_monitor(disp, &mon);
+    TEST_ASSERT_EQUAL_UINT32(3 * (VER_RES / 20 + 1), mon.flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(BUF_CNT - 1, mon.pending_max);
+    TEST_ASSERT_EQUAL_UINT32(BUF_CNT - 1, queue_cnt_max);
+}
+
+void test_flush_monitor_reset(void)
+{
+    set_buffers(LV_DISPLAY_RENDER_MODE_PARTIAL, 10);
+    create_ui();
+    lv_refr_now(disp);
+    queue_process(disp);
+
+    TEST_ASSERT_EQUAL_UINT32(BUF_CNT, lv_display_get_draw_buffer_count(disp));
+
+    lv_display_flush_monitor_t mon;
+    lv_display_get_flush_monitor(disp, &mon);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, mon.flush_cnt);
+
+    lv_display_reset_flush_monitor(disp);
+    lv_display_get_flush_monitor(disp, &mon);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.pending_max);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.wait_cnt);
+}
+
+#endif
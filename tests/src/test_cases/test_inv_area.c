@@ -0,0 +1,134 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    lv_display_set_inv_area_limit(NULL, LV_DEF_INV_AREA_LIMIT);
+    lv_display_set_inv_area_overhead(NULL, LV_DEF_INV_AREA_OVERHEAD);
+
+    /*Refresh what's pending before measuring*/
+    lv_refr_now(NULL);
+    lv_display_reset_inv_monitor(NULL);
+}
+
+void tearDown(void)
+{
+    lv_display_set_inv_area_limit(NULL, LV_DEF_INV_AREA_LIMIT);
+    lv_display_set_inv_area_overhead(NULL, LV_DEF_INV_AREA_OVERHEAD);
+    lv_obj_clean(lv_screen_active());
+}
+
+static void invalidate(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    lv_area_t a = {x1, y1, x2, y2};
+    _lv_inv_area(NULL, &a);
+}
+
+void test_inv_area_overlapping_areas_are_joined(void)
+{
+    invalidate(10, 10, 59, 59);
+    invalidate(30, 30, 79, 79);
+    invalidate(20, 20, 29, 29);     /*Inside the first one, not stored*/
+    lv_refr_now(NULL);
+
+    lv_display_inv_monitor_t mon;
+    lv_display_get_inv_monitor(NULL, &mon);
+    TEST_ASSERT_EQUAL_UINT32(2, mon.inv_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, mon.joined_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, mon.refr_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(70 * 70, mon.refr_px_cnt);
+}
+
+void test_inv_area_join_uses_overhead(void)
+{
+    /*Two areas with a 1 px gap. The joined area is only 10 px larger.*/
+    lv_display_set_inv_area_overhead(NULL, 0);
+    invalidate(0, 0, 9, 9);
+    invalidate(11, 0, 20, 9);
+    lv_refr_now(NULL);
+
+    lv_display_inv_monitor_t mon;
+    lv_display_get_inv_monitor(NULL, &mon);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.joined_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, mon.refr_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(200, mon.refr_px_cnt);
+
+    lv_display_reset_inv_monitor(NULL);
+    lv_display_set_inv_area_overhead(NULL, 100);
+    invalidate(0, 0, 9, 9);
+    invalidate(11, 0, 20, 9);
+
+    /*Far away, joining would redraw too many extra pixels*/
+    invalidate(0, 200, 9, 209);
+    lv_refr_now(NULL);
+
+    lv_display_get_inv_monitor(NULL, &mon);
+    TEST_ASSERT_EQUAL_UINT32(1, mon.joined_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, mon.refr_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(210 + 100, mon.refr_px_cnt);
+}
+
+void test_inv_area_grows_without_full_redraw(void)
+{
+    /*Many more small areas than the old fixed buffer could store*/
+    lv_display_set_inv_area_overhead(NULL, 0);
+    uint32_t i;
+    for(i = 0; i < 200; i++) {
+        int32_t x = (i % 20) * 40;
+        int32_t y = (i / 20) * 40;
+        invalidate(x, y, x + 3, y + 3);
+    }
+    lv_refr_now(NULL);
+
+    lv_display_inv_monitor_t mon;
+    lv_display_get_inv_monitor(NULL, &mon);
+    TEST_ASSERT_EQUAL_UINT32(200, mon.inv_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(200, mon.inv_area_max);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.overflow_cnt);
+    TEST_ASSERT_EQUAL_UINT32(200, mon.refr_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(200 * 16, mon.refr_px_cnt);
+}
+
+void test_inv_area_overflow_merges_closest(void)
+{
+    lv_display_set_inv_area_overhead(NULL, 0);
+    lv_display_set_inv_area_limit(NULL, 4);
+
+    invalidate(0, 0, 9, 9);
+    invalidate(100, 0, 109, 9);
+    invalidate(0, 100, 9, 109);
+    invalidate(100, 100, 109, 109);
+
+    /*No more place: it should be merged into the closest area instead of redrawing the screen*/
+    invalidate(100, 115, 109, 119);
+    lv_refr_now(NULL);
+
+    lv_display_inv_monitor_t mon;
+    lv_display_get_inv_monitor(NULL, &mon);
+    TEST_ASSERT_EQUAL_UINT32(4, mon.inv_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, mon.overflow_cnt);
+    TEST_ASSERT_EQUAL_UINT32(4, mon.refr_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3 * 100 + 10 * 20, mon.refr_px_cnt);
+}
+
+void test_inv_area_full_mode(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_FULL);
+
+    invalidate(0, 0, 9, 9);
+    invalidate(100, 0, 109, 9);
+    lv_refr_now(NULL);
+
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_DIRECT);
+
+    lv_display_inv_monitor_t mon;
+    lv_display_get_inv_monitor(NULL, &mon);
+    TEST_ASSERT_EQUAL_UINT32(1, mon.refr_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(lv_display_get_horizontal_resolution(disp) * lv_display_get_vertical_resolution(disp),
+                             mon.refr_px_cnt);
+}
+
+#endif
@@ -0,0 +1,195 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+static lv_obj_t * list;
+
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(area);
+
+    /*Used by the screenshot compare*/
+    extern uint8_t * last_flushed_buf;
+    last_flushed_buf = px_map;
+
+    lv_display_flush_ready(disp);
+}
+
+void setUp(void)
+{
+    lv_display_set_flush_cb(NULL, flush_cb);
+
+    list = lv_list_create(lv_screen_active());
+    lv_obj_set_size(list, 300, 360);
+    lv_obj_center(list);
+    lv_obj_set_style_radius(list, 12, 0);
+
+    uint32_t i;
+    for(i = 0; i < 40; i++) {
+        if(i % 8 == 0) lv_list_add_text(list, "Section");
+        lv_obj_t * btn = lv_list_add_button(list, LV_SYMBOL_FILE, "Item");
+        if(i % 3 == 0) lv_obj_set_style_bg_color(btn, lv_palette_lighten(LV_PALETTE_BLUE, 4), 0);
+        /*Make the list scrollable horizontally too*/
+        if(i == 5) lv_obj_set_width(btn, 400);
+    }
+
+    /*Else the list is redrawn in each step as the scrolled state is changed*/
+    lv_obj_remove_style(list, NULL, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+
+    lv_refr_now(NULL);
+    lv_display_reset_inv_monitor(NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+/**
+ * Redraw the whole screen and check if it's the same as the current content of the buffer
+ */
+static void assert_same_as_redraw(void)
+{
+    extern uint8_t * last_flushed_buf;
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    uint32_t size = buf->header.stride * buf->header.h;
+    uint8_t * ref = lv_malloc(size);
+    lv_memcpy(ref, last_flushed_buf, size);
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+
+    /*The X channel of XRGB8888 is not set where the screen's background is not drawn.*/
+    uint32_t diff_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < size; i++) {
+        if(buf->header.cf == LV_COLOR_FORMAT_XRGB8888 && (i & 0x3) == 3) continue;
+        if(ref[i] != last_flushed_buf[i]) diff_cnt++;
+    }
+    lv_free(ref);
+    TEST_ASSERT_EQUAL_UINT32(0, diff_cnt);
+}
+
+static void scroll_and_check(int32_t x, int32_t y)
+{
+    lv_display_reset_inv_monitor(NULL);
+    lv_obj_scroll_by(list, x, y, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+
+    lv_display_inv_monitor_t mon;
+    lv_display_get_inv_monitor(NULL, &mon);
+    TEST_ASSERT_EQUAL_UINT32(1, mon.blit_area_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(mon.refr_px_cnt, mon.blit_px_cnt);
+
+    assert_same_as_redraw();
+}
+
+void test_scroll_blit_same_as_redraw(void)
+{
+    scroll_and_check(0, -37);
+    scroll_and_check(0, -120);
+    scroll_and_check(0, 55);
+    scroll_and_check(-20, 0);
+    scroll_and_check(13, -17);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("scroll_blit_1.png");
+}
+
+void test_scroll_blit_double_buffered(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    lv_draw_buf_t * buf_ori = lv_display_get_buf_active(disp);
+    lv_draw_buf_t * buf1 = lv_draw_buf_create(buf_ori->header.w, buf_ori->header.h, buf_ori->header.cf, 0);
+    lv_draw_buf_t * buf2 = lv_draw_buf_create(buf_ori->header.w, buf_ori->header.h, buf_ori->header.cf, 0);
+    lv_display_set_draw_buffers(disp, buf1, buf2);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+
+    /*The pixels are copied from the other buffer*/
+    scroll_and_check(0, -37);
+    scroll_and_check(0, 55);
+    scroll_and_check(13, -17);
+
+    lv_display_set_draw_buffers(disp, buf_ori, NULL);
+    lv_draw_buf_destroy(buf1);
+    lv_draw_buf_destroy(buf2);
+}
+
+void test_scroll_blit_multiple_steps_in_a_refresh(void)
+{
+    lv_display_reset_inv_monitor(NULL);
+    lv_obj_scroll_by(list, 0, -30, LV_ANIM_OFF);
+    lv_obj_scroll_by(list, 0, -25, LV_ANIM_OFF);
+    lv_obj_scroll_by(list, 0, 10, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+
+    lv_display_inv_monitor_t mon;
+    lv_display_get_inv_monitor(NULL, &mon);
+    TEST_ASSERT_EQUAL_UINT32(1, mon.blit_area_cnt);
+
+    assert_same_as_redraw();
+}
+
+void test_scroll_blit_animated(void)
+{
+    static lv_style_t style_scrolled;
+    lv_style_init(&style_scrolled);
+    lv_style_set_bg_color(&style_scrolled, lv_palette_main(LV_PALETTE_RED));
+    lv_obj_add_style(list, &style_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+
+    lv_obj_scroll_by(list, 0, -300, LV_ANIM_ON);
+
+    /*The list is redrawn while the style of the scrollbar changes because of the scrolled state*/
+    lv_test_wait(100);
+
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_display_reset_inv_monitor(NULL);
+        lv_test_wait(30);
+
+        lv_display_inv_monitor_t mon;
+        lv_display_get_inv_monitor(NULL, &mon);
+        TEST_ASSERT_EQUAL_UINT32(1, mon.blit_area_cnt);
+
+        assert_same_as_redraw();
+    }
+
+    lv_test_wait(1000);
+    assert_same_as_redraw();
+}
+
+void test_scroll_blit_not_used_if_content_changed(void)
+{
+    lv_display_reset_inv_monitor(NULL);
+    lv_obj_scroll_by(list, 0, -40, LV_ANIM_OFF);
+    lv_obj_set_style_bg_color(lv_obj_get_child(list, 3), lv_palette_main(LV_PALETTE_RED), 0);
+    lv_refr_now(NULL);
+
+    lv_display_inv_monitor_t mon;
+    lv_display_get_inv_monitor(NULL, &mon);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.blit_area_cnt);
+
+    assert_same_as_redraw();
+}
+
+void test_scroll_blit_not_used_if_covered(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 100, 100);
+    lv_obj_set_pos(obj, 200, 100);
+    lv_refr_now(NULL);
+
+    lv_display_reset_inv_monitor(NULL);
+    lv_obj_scroll_by(list, 0, -40, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+
+    lv_display_inv_monitor_t mon;
+    lv_display_get_inv_monitor(NULL, &mon);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.blit_area_cnt);
+
+    assert_same_as_redraw();
+}
+
+#endif